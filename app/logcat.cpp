@@ -0,0 +1,115 @@
+#include "../common/binary-log.h"
+#include "../common/logger.h"
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace openmeters;
+
+/**
+ * openmeters-logcat: render binary logs (see common/binary-log.h) as the
+ * same text lines the logger writes.
+ */
+
+namespace {
+
+struct LogcatOptions {
+    common::LogLevel minLevel = common::LogLevel::Debug; // --level
+    bool threadIds = false;                              // --threads
+    std::vector<std::string> files;
+};
+
+void printUsage() {
+    std::cerr << "Usage: openmeters-logcat [--level LEVEL] [--threads] FILE...\n"
+              << "  --level LEVEL  Skip records below debug|info|warning|error|fatal (default: debug)\n"
+              << "  --threads      Prefix each line with the logging thread's number\n";
+}
+
+bool parseLevel(const char* name, common::LogLevel& level) {
+    static constexpr const char* kNames[] = {"debug", "info", "warning", "error", "fatal"};
+    for (int i = 0; i < 5; ++i) {
+        if (std::strcmp(name, kNames[i]) == 0) {
+            level = static_cast<common::LogLevel>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool parseOptions(int argc, char* argv[], LogcatOptions& options) {
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        if (std::strcmp(arg, "--level") == 0 && i + 1 < argc) {
+            if (!parseLevel(argv[++i], options.minLevel)) {
+                return false;
+            }
+        } else if (std::strcmp(arg, "--threads") == 0) {
+            options.threadIds = true;
+        } else if (arg[0] == '-') {
+            return false;
+        } else {
+            options.files.emplace_back(arg);
+        }
+    }
+    return !options.files.empty();
+}
+
+/**
+ * Decode one file to stdout.
+ *
+ * @return false if the file could not be opened or ends in a damaged entry
+ */
+bool decodeFile(const std::string& path, const LogcatOptions& options) {
+    common::BinaryLogReader reader;
+    if (!reader.open(path)) {
+        std::cerr << "openmeters-logcat: " << path << ": not a binary log\n";
+        return false;
+    }
+
+    common::LogLineFormatter formatter(reader.clock());
+    common::BinaryLogEntry entry;
+    std::string out;
+    out.reserve(64 * 1024);
+    while (reader.next(entry)) {
+        if (entry.dropped) {
+            common::LogLineFormatter::appendDropped(out, entry.droppedCount, entry.droppedWhere);
+        } else if (entry.record.level >= static_cast<std::uint8_t>(options.minLevel)) {
+            if (options.threadIds) {
+                out += '#';
+                out += std::to_string(entry.record.threadId);
+                out += ' ';
+            }
+            formatter.append(out, entry.record);
+        }
+        if (out.size() >= 60 * 1024) {
+            std::fwrite(out.data(), 1, out.size(), stdout);
+            out.clear();
+        }
+    }
+    std::fwrite(out.data(), 1, out.size(), stdout);
+
+    if (reader.damaged()) {
+        std::cerr << "openmeters-logcat: " << path << ": stopped at a damaged or incomplete entry\n";
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    LogcatOptions options;
+    if (!parseOptions(argc, argv, options)) {
+        printUsage();
+        return 2;
+    }
+
+    bool ok = true;
+    for (const std::string& file : options.files) {
+        ok = decodeFile(file, options) && ok;
+    }
+    std::fflush(stdout);
+    return ok ? 0 : 1;
+}
@@ -3,9 +3,16 @@
 
 #include "../ui/window.h"
 #include "../core/audio/audio-engine.h"
+#include "../core/net/stream-server.h"
+#include "../core/net/metrics-exporter.h"
+#include "../core/net/osc-sender.h"
+#include "../core/net/websocket-server.h"
 #include "../common/logger.h"
 #include "../common/config.h"
+#include "../common/startup-orchestrator.h"
 #include <windows.h>
+#include <cstring>
+#include <tuple>
 
 using namespace openmeters;
 
@@ -20,12 +27,14 @@ public:
     void onAudioData(
         const float* buffer,
         std::size_t frameCount,
-        const common::AudioFormat& format
+        const common::AudioFormat& format,
+        std::uint32_t flags
     ) override {
         // Silently consume audio data
         (void)buffer;
         (void)frameCount;
         (void)format;
+        (void)flags;
     }
     
     void onMeterData(const common::MeterSnapshot& snapshot) override {
@@ -40,33 +49,91 @@ private:
 
 int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine, int nCmdShow) {
     (void)hPrevInstance;
-    (void)lpCmdLine;
 
     try {
-        // Initialize logger
+        // Initialize logger; --binary-log keeps debug tracing on in logs/openmeters.omlog
         std::string logPath = "logs/openmeters.log";
-        if (!common::Logger::initialize(logPath, common::LogLevel::Info, true)) {
+        const bool binaryLog = lpCmdLine && std::strstr(lpCmdLine, "--binary-log");
+        const bool loggerReady = binaryLog
+            ? common::Logger::initialize(logPath, common::LogLevel::Debug, true, "logs/openmeters.omlog")
+            : common::Logger::initialize(logPath, common::LogLevel::Info, true);
+        if (!loggerReady) {
             MessageBoxA(nullptr, "Failed to initialize logger", "OpenMeters Error", MB_OK | MB_ICONERROR);
             return 1;
         }
         
         LOG_INFO("OpenMeters starting...");
         
-        // Load configuration
-        common::ConfigManager::load();
+        // This thread owns the multithreaded apartment for the whole run. The
+        // audio phase initializes WASAPI on a worker, which is implicitly in
+        // the apartment and so leaves COM setup and teardown to this thread
+        const bool comReady = SUCCEEDED(CoInitializeEx(nullptr, COINIT_MULTITHREADED));
         
-        // Create window
+        // Startup: config first, then the window (UI thread) and audio device
+        // bring-up side by side, then capture once both are up
         ui::Window window;
-        if (!window.initialize(hInstance, nCmdShow)) {
+        core::audio::AudioEngine engine;
+        GuiCallback callback(&window);
+        
+        common::StartupOrchestrator startup;
+        const auto configPhase = startup.addPhase("config", [] {
+            // Load configuration and follow edits to config.json while running
+            common::ConfigManager::load();
+            common::ConfigManager::startWatching();
+            return true;
+        });
+        const auto windowPhase = startup.addPhase("window", [&] {
+            return window.initialize(hInstance, nCmdShow);
+        }, {configPhase}, common::PhaseAffinity::Caller);
+        const auto audioPhase = startup.addPhase("audio", [&] {
+            return engine.initialize();
+        }, {configPhase});
+        startup.addPhase("capture", [&] {
+            const common::ConfigSnapshot config = common::ConfigManager::snapshot();
+            LOG_INFO("Audio format: {} Hz, {} channel(s)",
+                     engine.getFormat().sampleRate, engine.getFormat().channelCount);
+            
+            // Register callback
+            engine.registerCallback(&callback);
+            window.setEventSource(&engine.events());
+            
+            if (config->publishSharedSnapshots) {
+                engine.enableSharedSnapshots();
+            }
+            if (config->publishSharedAudio) {
+                engine.enableSharedAudio();
+            }
+            if (!config->meterPluginDirectory.empty()) {
+                const std::size_t pluginCount = engine.loadMeterPlugins(config->meterPluginDirectory);
+                LOG_INFO("Loaded {} meter plugin(s)", pluginCount);
+            }
+            
+            // Start capture
+            if (!engine.start()) {
+                LOG_WARNING("Failed to start audio capture");
+            } else {
+                LOG_INFO("Audio capture started");
+            }
+            return true;
+        }, {windowPhase, audioPhase}, common::PhaseAffinity::Caller);
+        
+        startup.run();
+        startup.logSummary();
+        const common::ConfigSnapshot config = common::ConfigManager::snapshot();
+        
+        if (!startup.succeeded(windowPhase)) {
             LOG_ERROR("Failed to initialize window");
             MessageBoxA(nullptr, "Failed to initialize window", "OpenMeters Error", MB_OK | MB_ICONERROR);
+            engine.shutdown();
+            common::ConfigManager::stopWatching();
             common::Logger::shutdown();
+            if (comReady) {
+                CoUninitialize();
+            }
             return 1;
         }
         
-        // Create audio engine
-        core::audio::AudioEngine engine;
-        bool audioAvailable = engine.initialize();
+        const bool audioAvailable = startup.succeeded(audioPhase);
         if (!audioAvailable) {
             LOG_WARNING("Audio engine failed to initialize. Meters will show zero until audio is available.");
             MessageBoxA(nullptr, 
@@ -79,37 +146,81 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
                 "OpenMeters - Audio Warning", MB_OK | MB_ICONWARNING);
         }
         
-        GuiCallback callback(&window);
+        // Local meter streaming for headless subscribers
+        core::net::StreamServer streamServer;
+        if (audioAvailable && config->streamServerEnabled) {
+            core::net::StreamServerSettings streamSettings;
+            streamSettings.socketPath = config->streamSocketPath;
+            streamServer.addSource(0, &engine);
+            streamServer.start(streamSettings);
+        }
         
-        if (audioAvailable) {
-            LOG_INFO("Audio format: " + std::to_string(engine.getFormat().sampleRate) + " Hz, " +
-                     std::to_string(engine.getFormat().channelCount) + " channel(s)");
-            
-            // Register callback
-            engine.registerCallback(&callback);
-            
-            // Start capture
-            if (!engine.start()) {
-                LOG_WARNING("Failed to start audio capture");
-            } else {
-                LOG_INFO("Audio capture started");
-            }
+        // Prometheus scrape endpoint
+        core::net::MetricsExporter metricsExporter;
+        if (audioAvailable && config->metricsExporterEnabled) {
+            core::net::MetricsExporterSettings metricsSettings;
+            metricsSettings.port = static_cast<std::uint16_t>(config->metricsPort);
+            metricsExporter.addSource("loopback", &engine);
+            metricsExporter.start(metricsSettings);
+        }
+        
+        // OSC output for lighting and show control
+        core::net::OscSender oscSender;
+        if (audioAvailable && config->oscEnabled) {
+            core::net::OscSenderSettings oscSettings;
+            oscSettings.host = config->oscHost;
+            oscSettings.port = static_cast<std::uint16_t>(config->oscPort);
+            oscSettings.rateHz = config->oscRateHz;
+            oscSender.addSource("loopback", &engine);
+            oscSender.start(oscSettings);
         }
         
+        // Live feed for browser dashboards
+        core::net::WebSocketServer dashboardServer;
+        if (audioAvailable && config->dashboardEnabled) {
+            core::net::WebSocketServerSettings dashboardSettings;
+            dashboardSettings.port = static_cast<std::uint16_t>(config->dashboardPort);
+            dashboardServer.addSource("loopback", &engine);
+            dashboardServer.start(dashboardSettings);
+        }
+        
+        // Audio and service settings apply at startup; the UI follows changes live
+        const auto restartSettings = [](const common::AppConfig& c) {
+            return std::tie(c.publishSharedSnapshots, c.publishSharedAudio, c.meterPluginDirectory,
+                            c.streamServerEnabled, c.streamSocketPath, c.metricsExporterEnabled, c.metricsPort,
+                            c.oscEnabled, c.oscHost, c.oscPort, c.oscRateHz, c.dashboardEnabled, c.dashboardPort);
+        };
+        const std::uint64_t configListener = common::ConfigManager::subscribe(
+            [config, restartSettings](const common::ConfigSnapshot& next) {
+                if (restartSettings(*next) != restartSettings(*config)) {
+                    LOG_WARNING("Audio and streaming setting changes take effect after a restart");
+                }
+            });
+        
         // Run main loop (window always opens)
         window.run();
+        common::ConfigManager::unsubscribe(configListener);
         
         // Cleanup
         LOG_INFO("Shutting down...");
+        dashboardServer.stop();
+        oscSender.stop();
+        metricsExporter.stop();
+        streamServer.stop();
+        window.setEventSource(nullptr);
         engine.stop();
         engine.unregisterCallback(&callback);
         engine.shutdown();
         window.shutdown();
         
         // Save configuration
-        common::ConfigManager::save();
+        common::ConfigManager::stopWatching();
+        common::ConfigManager::flushSaves();
         
         common::Logger::shutdown();
+        if (comReady) {
+            CoUninitialize();
+        }
         return 0;
 
     } catch (const std::exception& e) {
@@ -9,6 +9,10 @@
 #include "../common/meter-values.h"
 #include "../common/logger.h"
 #include "../common/config.h"
+#include "../core/net/line-writer.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
 #include <iomanip>
 #include <chrono>
@@ -25,12 +29,14 @@ public:
     void onAudioData(
         const float* buffer,
         std::size_t frameCount,
-        const common::AudioFormat& format
+        const common::AudioFormat& format,
+        std::uint32_t flags
     ) override {
         // Silently consume audio data (we only care about meters)
         (void)buffer;
         (void)frameCount;
         (void)format;
+        (void)flags;
     }
     
     void onMeterData(const common::MeterSnapshot& snapshot) override {
@@ -43,13 +49,119 @@ public:
     }
 };
 
-int main() {
-    // Initialize logger
+/**
+ * Command-line options.
+ */
+struct ConsoleOptions {
+    bool streaming = false;                   // --ndjson / --csv
+    core::net::LineWriterSettings lines;
+    double durationSeconds = 0.0;             // --duration; 0: until Enter / end of input
+    bool binaryLog = false;                   // --binary-log
+};
+
+void printUsage() {
+    std::cerr << "Usage: openmeters-cli [--ndjson | --csv] [--rate HZ] [--duration SECONDS] [--binary-log]\n"
+              << "  --ndjson, --csv    Stream snapshot lines to stdout (headless)\n"
+              << "  --rate HZ          Lines per second per source when streaming (default 100)\n"
+              << "  --duration SECONDS Stop after this long (default: until Enter)\n"
+              << "  --binary-log       Log everything down to debug to logs/openmeters.omlog\n"
+              << "                     (read with openmeters-logcat)\n";
+}
+
+bool parseOptions(int argc, char* argv[], ConsoleOptions& options) {
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (std::strcmp(arg, "--ndjson") == 0) {
+            options.streaming = true;
+            options.lines.format = core::net::LineFormat::Ndjson;
+        } else if (std::strcmp(arg, "--csv") == 0) {
+            options.streaming = true;
+            options.lines.format = core::net::LineFormat::Csv;
+        } else if (std::strcmp(arg, "--rate") == 0 && hasValue) {
+            options.lines.rateHz = std::strtof(argv[++i], nullptr);
+            if (!(options.lines.rateHz > 0.0f)) {
+                return false;
+            }
+        } else if (std::strcmp(arg, "--duration") == 0 && hasValue) {
+            options.durationSeconds = std::strtod(argv[++i], nullptr);
+            if (options.durationSeconds < 0.0) {
+                return false;
+            }
+        } else if (std::strcmp(arg, "--binary-log") == 0) {
+            options.binaryLog = true;
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Block until the duration elapses, or until Enter / end of input if none.
+ */
+void waitForStop(double durationSeconds) {
+    if (durationSeconds > 0.0) {
+        std::this_thread::sleep_for(std::chrono::duration<double>(durationSeconds));
+    } else {
+        std::cin.get();
+    }
+}
+
+/**
+ * Headless mode: meter the default device and stream lines to stdout.
+ * Diagnostics go to the log file only, so stdout stays machine-readable.
+ */
+int runStreaming(const ConsoleOptions& options) {
+    core::audio::AudioEngine engine;
+    if (!engine.initialize()) {
+        LOG_ERROR("Failed to initialize audio engine");
+        std::cerr << "Failed to initialize audio engine.\n";
+        return 1;
+    }
+    
+    core::net::LineWriter writer;
+    writer.addSource("loopback", &engine);
+    
+    if (!engine.start() || !writer.start(stdout, options.lines)) {
+        LOG_ERROR("Failed to start streaming");
+        std::cerr << "Failed to start streaming.\n";
+        engine.shutdown();
+        return 1;
+    }
+    
+    LOG_INFO("Streaming snapshot lines to stdout");
+    waitForStop(options.durationSeconds);
+    
+    writer.stop();
+    LOG_INFO("Wrote {} lines", writer.linesWritten());
+    engine.shutdown();
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
+    ConsoleOptions options;
+    if (!parseOptions(argc, argv, options)) {
+        printUsage();
+        return 2;
+    }
+    
+    // Initialize logger (console output would corrupt streamed lines)
     std::string logPath = "logs/openmeters.log";
-    common::Logger::initialize(logPath, common::LogLevel::Info, true);
+    if (options.binaryLog) {
+        common::Logger::initialize(logPath, common::LogLevel::Debug, !options.streaming, "logs/openmeters.omlog");
+    } else {
+        common::Logger::initialize(logPath, common::LogLevel::Info, !options.streaming);
+    }
     
     LOG_INFO("OpenMeters starting (console mode)...");
     
+    if (options.streaming) {
+        const int result = runStreaming(options);
+        common::Logger::shutdown();
+        return result;
+    }
+    
     // Load configuration
     common::ConfigManager::load();
     
@@ -93,8 +205,8 @@ int main() {
     
     std::cout << "Capturing audio. Press Enter to stop...\n\n";
     
-    // Run for a bit (or until user presses Enter)
-    std::this_thread::sleep_for(std::chrono::seconds(10));
+    // Run until the user presses Enter (or for --duration)
+    waitForStop(options.durationSeconds);
     
     // Stop
     std::cout << "\n\nStopping audio capture...\n";
@@ -0,0 +1,207 @@
+#include "../ui/frame-writer.h"
+#include "../ui/meter-render.h"
+#include "../ui/meter-smoother.h"
+#include "../ui/software-rasterizer.h"
+#include "../core/ipc/snapshot-reader.h"
+#include <chrono>
+#include <cmath>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#endif
+
+using namespace openmeters;
+
+/**
+ * openmeters-render: draw the meter graphic without a GPU or window, as
+ * raw RGBA video on stdout (for ffmpeg) or as numbered PNG files.
+ */
+
+namespace {
+
+struct RenderOptions {
+    int width = 640;                 // --width
+    int height = 200;                // --height
+    double fps = 60.0;               // --fps
+    std::uint64_t frames = 0;        // --frames; 0: until interrupted (shared) or 600 (demo)
+    int panels = 1;                  // --panels
+    bool shared = false;             // --shared: read the engine's shared snapshots
+    std::string sharedName = core::ipc::kDefaultSnapshotRegionName;
+    std::string pngDirectory;        // --png DIR; otherwise raw frames on stdout
+    bool realtime = false;           // --realtime: pace demo frames at --fps
+    ui::Rgba background = ui::packRgba(31, 31, 31, 217);
+};
+
+void printUsage() {
+    std::cerr << "Usage: openmeters-render [--width W] [--height H] [--fps N] [--frames N] [--panels N]\n"
+              << "                         [--shared [NAME]] [--realtime] [--background RRGGBBAA] [--png DIR]\n"
+              << "  --shared [NAME]  Draw live values published by a running engine (publishSharedSnapshots)\n"
+              << "                   instead of the built-in demo signal\n"
+              << "  --panels N       Meter panels side by side (a meter bridge)\n"
+              << "  --realtime       Pace demo frames at --fps (shared sources always are)\n"
+              << "  --png DIR        Write DIR/frame-000000.png, ... instead of raw RGBA to stdout\n"
+              << "Example:\n"
+              << "  openmeters-render --fps 60 | ffmpeg -f rawvideo -pix_fmt rgba -s 640x200 -r 60 -i - meters.webm\n";
+}
+
+bool parseOptions(int argc, char* argv[], RenderOptions& options) {
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (std::strcmp(arg, "--width") == 0 && hasValue) {
+            options.width = std::atoi(argv[++i]);
+        } else if (std::strcmp(arg, "--height") == 0 && hasValue) {
+            options.height = std::atoi(argv[++i]);
+        } else if (std::strcmp(arg, "--fps") == 0 && hasValue) {
+            options.fps = std::strtod(argv[++i], nullptr);
+        } else if (std::strcmp(arg, "--frames") == 0 && hasValue) {
+            options.frames = std::strtoull(argv[++i], nullptr, 10);
+        } else if (std::strcmp(arg, "--panels") == 0 && hasValue) {
+            options.panels = std::atoi(argv[++i]);
+        } else if (std::strcmp(arg, "--shared") == 0) {
+            options.shared = true;
+            if (hasValue && argv[i + 1][0] != '-') {
+                options.sharedName = argv[++i];
+            }
+        } else if (std::strcmp(arg, "--realtime") == 0) {
+            options.realtime = true;
+        } else if (std::strcmp(arg, "--background") == 0 && hasValue) {
+            const auto rgba = static_cast<std::uint32_t>(std::strtoul(argv[++i], nullptr, 16));
+            options.background = ui::packRgba(static_cast<std::uint8_t>(rgba >> 24), static_cast<std::uint8_t>(rgba >> 16),
+                                              static_cast<std::uint8_t>(rgba >> 8), static_cast<std::uint8_t>(rgba));
+        } else if (std::strcmp(arg, "--png") == 0 && hasValue) {
+            options.pngDirectory = argv[++i];
+        } else {
+            return false;
+        }
+    }
+    return options.width > 0 && options.height > 0 && options.fps > 0.0 && options.panels > 0;
+}
+
+/**
+ * Deterministic demo levels: each panel swings through the scale, out of
+ * phase with its neighbours, clipping briefly at the top.
+ */
+common::MeterSnapshot demoSnapshot(int panel, int panels, double seconds) {
+    const double phase = 2.0 * 3.14159265358979 * (0.4 * seconds + static_cast<double>(panel) / panels);
+    const auto level = static_cast<float>(std::pow(10.0, (-30.0 + 30.0 * (0.5 + 0.5 * std::sin(phase))) / 20.0));
+    common::MeterSnapshot snapshot;
+    snapshot.peak = {level, level * 0.9f};
+    snapshot.rms = {level * 0.5f, level * 0.45f};
+    snapshot.timestampMs = static_cast<std::uint64_t>(seconds * 1000.0);
+    return snapshot;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    RenderOptions options;
+    if (!parseOptions(argc, argv, options)) {
+        printUsage();
+        return 2;
+    }
+    if (options.frames == 0 && !options.shared) {
+        options.frames = 600;
+    }
+
+    core::ipc::SnapshotReader reader;
+    if (options.shared && !reader.open(options.sharedName)) {
+        std::cerr << "openmeters-render: no shared snapshots named " << options.sharedName
+                  << " (is publishSharedSnapshots enabled?)\n";
+        return 1;
+    }
+    if (!options.pngDirectory.empty()) {
+        std::error_code error;
+        std::filesystem::create_directories(options.pngDirectory, error);
+    } else {
+#ifdef _WIN32
+        _setmode(_fileno(stdout), _O_BINARY);
+#else
+        // A closed pipe should fail the write, not kill us before the stats line
+        std::signal(SIGPIPE, SIG_IGN);
+#endif
+    }
+
+    // Panels share the width; the layout itself is the overlay's
+    constexpr float kMargin = 8.0f;
+    ui::MeterRenderStyle style;
+    style.charWidth = ui::SoftwareRasterizer::textWidth("M", style.fontHeight);
+    const float panelWidth = (static_cast<float>(options.width) - kMargin * static_cast<float>(options.panels + 1)) /
+                             static_cast<float>(options.panels);
+
+    ui::SoftwareRasterizer frame(options.width, options.height);
+    ui::DisplayList list;
+    std::vector<ui::MeterView> views(static_cast<std::size_t>(options.panels));
+    std::vector<ui::MeterSmoother> smoothers(views.size());
+    std::vector<ui::MeterPanelCache> caches(views.size());
+
+    using Clock = std::chrono::steady_clock;
+    const auto frameInterval = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / options.fps));
+    const Clock::time_point start = Clock::now();
+    Clock::duration busy{};
+    std::uint64_t written = 0;
+
+    for (std::uint64_t index = 0; options.frames == 0 || index < options.frames; ++index) {
+        // Frame time: wall clock for live sources, frame count for the demo
+        const Clock::time_point frameTime = start + frameInterval * static_cast<Clock::rep>(index);
+        if (options.shared || options.realtime) {
+            std::this_thread::sleep_until(frameTime);
+        }
+        const Clock::time_point workStart = Clock::now();
+
+        for (std::size_t p = 0; p < views.size(); ++p) {
+            common::MeterSnapshot snapshot;
+            if (options.shared) {
+                core::ipc::SharedMeterSnapshot shared;
+                if (reader.read(shared)) {
+                    snapshot.peak = {shared.peak[0], shared.peak[1]};
+                    snapshot.rms = {shared.rms[0], shared.rms[1]};
+                    snapshot.timestampMs = shared.timestampMs;
+                }
+            } else {
+                const double seconds = std::chrono::duration<double>(frameTime - start).count();
+                snapshot = demoSnapshot(static_cast<int>(p), options.panels, seconds);
+            }
+            smoothers[p].push(snapshot, frameTime);
+            views[p].snapshot = smoothers[p].advance(frameTime);
+            views[p].clipLit = snapshot.peak.getMax() >= 0.99f;
+        }
+
+        ui::buildMeterBridge(views, style, panelWidth, kMargin, list, caches);
+        frame.clear(options.background);
+        frame.render(list, kMargin, kMargin);
+        busy += Clock::now() - workStart;
+
+        bool ok = true;
+        if (options.pngDirectory.empty()) {
+            ok = ui::writeRawFrame(stdout, frame);
+        } else {
+            char name[32];
+            std::snprintf(name, sizeof(name), "frame-%06llu.png", static_cast<unsigned long long>(index));
+            ok = ui::writePng((std::filesystem::path(options.pngDirectory) / name).string(), frame);
+        }
+        if (!ok) {
+            break; // Reader went away (e.g. ffmpeg exited)
+        }
+        ++written;
+    }
+    std::fflush(stdout);
+
+    // Drawing cost per frame, and as a share of one core at the target rate
+    if (written > 0) {
+        const double msPerFrame = std::chrono::duration<double, std::milli>(busy).count() / static_cast<double>(written);
+        std::cerr << "openmeters-render: " << written << " frames, " << msPerFrame << " ms per frame to draw ("
+                  << msPerFrame * options.fps / 10.0 << "% of a core at " << options.fps << " fps)\n";
+    }
+    return written > 0 ? 0 : 1;
+}
@@ -0,0 +1,215 @@
+#include "binary-log.h"
+#include <algorithm>
+#include <cstring>
+
+namespace openmeters::common {
+
+namespace {
+
+template <typename T>
+void put(std::string& out, T value) {
+    char bytes[sizeof(T)];
+    std::memcpy(bytes, &value, sizeof(T));
+    out.append(bytes, sizeof(T));
+}
+
+template <typename T>
+bool get(std::ifstream& in, T& value) {
+    return static_cast<bool>(in.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
+
+} // namespace
+
+// BinaryLogWriter
+
+bool BinaryLogWriter::open(const std::string& path, const LogClock& clock, const LogFileSettings& settings) {
+    close();
+    if (!m_file.open(path, settings, false)) {
+        return false;
+    }
+    m_clock = clock;
+    m_buffer.reserve(64 * 1024);
+    appendHeader();
+    write();
+    return true;
+}
+
+void BinaryLogWriter::close() {
+    if (m_file.isOpen()) {
+        write();
+        m_file.close();
+    }
+    m_buffer.clear();
+}
+
+void BinaryLogWriter::append(const LogRecord& record) {
+    rotateIfNeeded();
+    const std::uint32_t formatId = intern(record.format);
+    const std::uint32_t fileId = intern(record.file);
+
+    put(m_buffer, binlog::EntryKind::Record);
+    put(m_buffer, formatId);
+    put(m_buffer, fileId);
+    put(m_buffer, record.timestampTicks);
+    put(m_buffer, record.line);
+    put(m_buffer, record.threadId);
+    put(m_buffer, record.level);
+    put(m_buffer, static_cast<std::uint8_t>(record.truncated ? binlog::kFlagTruncated : 0));
+    put(m_buffer, record.length);
+    m_buffer.append(record.text, record.length);
+}
+
+void BinaryLogWriter::appendDropped(std::uint64_t count, const char* where) {
+    rotateIfNeeded();
+    const std::uint32_t whereId = intern(where);
+    put(m_buffer, binlog::EntryKind::Dropped);
+    put(m_buffer, count);
+    put(m_buffer, whereId);
+}
+
+void BinaryLogWriter::write() {
+    m_file.write(m_buffer.data(), m_buffer.size());
+    m_buffer.clear();
+}
+
+void BinaryLogWriter::appendHeader() {
+    m_ids.clear();
+    m_nextId = 1;
+    put(m_buffer, binlog::kMagic);
+    put(m_buffer, binlog::kVersion);
+    put(m_buffer, static_cast<std::uint16_t>(binlog::kHeaderSize));
+    put(m_buffer, m_clock.tickNumerator);
+    put(m_buffer, m_clock.tickDenominator);
+    put(m_buffer, m_clock.baseTicks);
+    put(m_buffer, m_clock.baseSystemUs);
+}
+
+void BinaryLogWriter::rotateIfNeeded() {
+    // Room for one more full record; new strings may overshoot the limit slightly
+    constexpr std::size_t kRecordEntryBytes = 1 + 28 + LogRecord::kMaxMessage;
+    if (!m_file.shouldRotate(m_buffer.size() + kRecordEntryBytes)) {
+        return;
+    }
+    // Entries so far refer to this segment's string table; finish it first
+    write();
+    if (m_file.rotate()) {
+        appendHeader();
+    }
+}
+
+std::uint32_t BinaryLogWriter::intern(const char* text) {
+    if (!text) {
+        return 0;
+    }
+    const auto [it, inserted] = m_ids.try_emplace(text, m_nextId);
+    if (inserted) {
+        ++m_nextId;
+        const std::size_t length = std::min<std::size_t>(std::strlen(text), UINT16_MAX);
+        put(m_buffer, binlog::EntryKind::String);
+        put(m_buffer, it->second);
+        put(m_buffer, static_cast<std::uint16_t>(length));
+        m_buffer.append(text, length);
+    }
+    return it->second;
+}
+
+// BinaryLogReader
+
+bool BinaryLogReader::open(const std::string& path) {
+    m_file.close();
+    m_strings.clear();
+    m_damaged = false;
+
+    m_file.open(path, std::ios::binary);
+    if (!m_file.is_open()) {
+        return false;
+    }
+
+    std::uint32_t magic = 0;
+    std::uint16_t version = 0;
+    std::uint16_t headerSize = 0;
+    if (!get(m_file, magic) || !get(m_file, version) || !get(m_file, headerSize) ||
+        magic != binlog::kMagic || version != binlog::kVersion || headerSize < binlog::kHeaderSize) {
+        m_file.close();
+        return false;
+    }
+    if (!get(m_file, m_clock.tickNumerator) || !get(m_file, m_clock.tickDenominator) ||
+        !get(m_file, m_clock.baseTicks) || !get(m_file, m_clock.baseSystemUs) ||
+        m_clock.tickDenominator == 0) {
+        m_file.close();
+        return false;
+    }
+    m_file.seekg(headerSize);
+    return true;
+}
+
+bool BinaryLogReader::next(BinaryLogEntry& entry) {
+    while (m_file.is_open()) {
+        binlog::EntryKind kind{};
+        if (!get(m_file, kind)) {
+            return false; // Clean end of file
+        }
+
+        switch (kind) {
+            case binlog::EntryKind::String: {
+                std::uint32_t id = 0;
+                std::uint16_t length = 0;
+                if (!get(m_file, id) || !get(m_file, length)) {
+                    break;
+                }
+                std::string text(length, '\0');
+                if (!m_file.read(text.data(), length)) {
+                    break;
+                }
+                m_strings[id] = std::move(text);
+                continue;
+            }
+
+            case binlog::EntryKind::Record: {
+                std::uint32_t formatId = 0;
+                std::uint32_t fileId = 0;
+                std::uint8_t flags = 0;
+                LogRecord& record = entry.record;
+                if (!get(m_file, formatId) || !get(m_file, fileId) || !get(m_file, record.timestampTicks) ||
+                    !get(m_file, record.line) || !get(m_file, record.threadId) || !get(m_file, record.level) ||
+                    !get(m_file, flags) || !get(m_file, record.length) || record.length > LogRecord::kMaxMessage) {
+                    break;
+                }
+                if (!m_file.read(record.text, record.length)) {
+                    break;
+                }
+                record.format = lookup(formatId);
+                record.file = lookup(fileId);
+                record.truncated = (flags & binlog::kFlagTruncated) != 0;
+                entry.dropped = false;
+                return true;
+            }
+
+            case binlog::EntryKind::Dropped: {
+                std::uint32_t whereId = 0;
+                if (!get(m_file, entry.droppedCount) || !get(m_file, whereId)) {
+                    break;
+                }
+                const char* where = lookup(whereId);
+                entry.droppedWhere = where ? where : "";
+                entry.dropped = true;
+                return true;
+            }
+
+            default:
+                break;
+        }
+
+        // Unknown kind or cut-off entry: nothing after it can be trusted
+        m_damaged = true;
+        m_file.close();
+    }
+    return false;
+}
+
+const char* BinaryLogReader::lookup(std::uint32_t id) const {
+    const auto it = m_strings.find(id);
+    return it != m_strings.end() ? it->second.c_str() : nullptr;
+}
+
+} // namespace openmeters::common
@@ -0,0 +1,160 @@
+#pragma once
+
+#include "logger.h"
+#include "log-file.h"
+#include <cstdint>
+#include <cstddef>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace openmeters::common {
+
+/**
+ * Binary log file written by the logger's binary sink and rendered to text
+ * by openmeters-logcat.
+ *
+ * A file is a fixed header followed by entries:
+ *
+ *   0   u32 magic ('O','M','L','G')
+ *   4   u16 version
+ *   6   u16 headerSize
+ *   8   u32 tickNumerator     seconds per tick = numerator / denominator
+ *   12  u32 tickDenominator
+ *   16  i64 baseTicks         steady-clock reading taken with baseSystemUs
+ *   24  i64 baseSystemUs      system clock, microseconds since the epoch
+ *
+ * Each entry starts with a u8 kind:
+ *
+ *   String   u32 id, u16 length, bytes
+ *   Record   u32 formatId, u32 fileId, i64 ticks, i32 line, u32 threadId,
+ *            u8 level, u8 flags, u16 length, bytes
+ *   Dropped  u64 count, u32 whereId
+ *
+ * Format strings and file names are written once as String entries the
+ * first time they are seen and referred to by id afterwards (0 = none; a
+ * record without a format holds plain text). Record bytes are the
+ * arguments exactly as LogArgWriter encoded them, so nothing is formatted
+ * until the file is decoded. Everything is little-endian, copied as-is.
+ */
+namespace binlog {
+
+inline constexpr std::uint32_t kMagic = 0x474C4D4F; // "OMLG"
+inline constexpr std::uint16_t kVersion = 1;
+inline constexpr std::size_t kHeaderSize = 32;
+
+enum class EntryKind : std::uint8_t {
+    String = 1,
+    Record = 2,
+    Dropped = 3
+};
+
+inline constexpr std::uint8_t kFlagTruncated = 0x01;
+
+} // namespace binlog
+
+/**
+ * Appends records to a binary log.
+ *
+ * Entries collect in a buffer; write() puts the buffer on disk in one call.
+ * Strings are interned by address, which is stable because formats and
+ * file names are literals. The file rotates like the text log; every
+ * segment starts with its own header and string table, so each one
+ * decodes on its own.
+ *
+ * Thread safety: Not thread-safe; the logger's writer thread owns it.
+ */
+class BinaryLogWriter {
+public:
+    BinaryLogWriter() = default;
+    ~BinaryLogWriter() { close(); }
+
+    BinaryLogWriter(const BinaryLogWriter&) = delete;
+    BinaryLogWriter& operator=(const BinaryLogWriter&) = delete;
+
+    /**
+     * Start a new log file and write its header. An existing file at the
+     * path is rotated away rather than overwritten.
+     */
+    bool open(const std::string& path, const LogClock& clock, const LogFileSettings& settings = {});
+
+    /**
+     * Write out what is buffered and close the file.
+     */
+    void close();
+
+    [[nodiscard]] bool isOpen() const { return m_file.isOpen(); }
+
+    void append(const LogRecord& record);
+    void appendDropped(std::uint64_t count, const char* where);
+
+    /**
+     * Write buffered entries to the file.
+     */
+    void write();
+
+    [[nodiscard]] std::size_t bufferedBytes() const noexcept { return m_buffer.size(); }
+
+private:
+    std::uint32_t intern(const char* text);
+    void appendHeader();
+    void rotateIfNeeded();
+
+    RotatingLogFile m_file;
+    LogClock m_clock;
+    std::string m_buffer;
+    std::unordered_map<const char*, std::uint32_t> m_ids;
+    std::uint32_t m_nextId = 1;
+};
+
+/**
+ * One decoded entry of a binary log.
+ */
+struct BinaryLogEntry {
+    bool dropped = false;          // Drop notice rather than a record
+    LogRecord record;              // format/file point into the reader's string table
+    std::uint64_t droppedCount = 0;
+    std::string_view droppedWhere;
+};
+
+/**
+ * Reads a binary log back entry by entry.
+ *
+ * Usage:
+ *   BinaryLogReader reader;
+ *   if (reader.open(path)) {
+ *       LogLineFormatter formatter(reader.clock());
+ *       BinaryLogEntry entry;
+ *       while (reader.next(entry)) { ... }
+ *   }
+ */
+class BinaryLogReader {
+public:
+    bool open(const std::string& path);
+
+    [[nodiscard]] const LogClock& clock() const noexcept { return m_clock; }
+
+    /**
+     * Decode the next record or drop notice. String entries are absorbed.
+     *
+     * @return false at the end of the file or on a damaged entry
+     */
+    bool next(BinaryLogEntry& entry);
+
+    /**
+     * Whether reading stopped on a damaged or cut-off entry rather than at
+     * a clean end of file (a crash can leave a partial last entry).
+     */
+    [[nodiscard]] bool damaged() const noexcept { return m_damaged; }
+
+private:
+    const char* lookup(std::uint32_t id) const;
+
+    std::ifstream m_file;
+    LogClock m_clock;
+    std::unordered_map<std::uint32_t, std::string> m_strings; // Node-based: c_str() stays valid
+    bool m_damaged = false;
+};
+
+} // namespace openmeters::common
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+namespace openmeters::common {
+
+/**
+ * Lock-free single-producer, multi-consumer broadcast ring.
+ * The writer never blocks: when the ring is full the oldest entries are
+ * overwritten. Every reader owns a Cursor and sees every entry exactly once,
+ * unless it falls more than Capacity entries behind, in which case the lost
+ * entries are counted in Cursor::dropped.
+ *
+ * Thread safety: push() from one thread only; read() from any number of
+ * threads, each with its own cursor.
+ */
+template <typename T, std::size_t Capacity>
+class BroadcastRing {
+    static_assert(std::is_trivially_copyable_v<T>, "BroadcastRing requires trivially copyable entries");
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    /**
+     * Per-reader position in the ring.
+     */
+    struct Cursor {
+        std::uint64_t position = 0;
+        std::uint64_t dropped = 0;
+    };
+
+    /**
+     * Append an entry. Wait-free; call from the writer thread only.
+     */
+    void push(const T& value) noexcept {
+        const std::uint64_t position = m_writePosition.load(std::memory_order_relaxed);
+        Slot& slot = m_slots[position & (Capacity - 1)];
+
+        // Odd sequence marks the slot as being written
+        slot.sequence.store(position * 2 + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        std::memcpy(static_cast<void*>(&slot.value), &value, sizeof(T));
+        slot.sequence.store(position * 2 + 2, std::memory_order_release);
+
+        m_writePosition.store(position + 1, std::memory_order_release);
+    }
+
+    /**
+     * Total number of entries ever pushed.
+     */
+    [[nodiscard]] std::uint64_t writePosition() const noexcept {
+        return m_writePosition.load(std::memory_order_acquire);
+    }
+
+    /**
+     * Create a cursor that only sees entries pushed from now on.
+     */
+    [[nodiscard]] Cursor tail() const noexcept {
+        return Cursor{writePosition(), 0};
+    }
+
+    /**
+     * Copy up to maxCount unread entries into out and advance the cursor.
+     *
+     * @return Number of entries copied
+     */
+    std::size_t read(Cursor& cursor, T* out, std::size_t maxCount) const noexcept {
+        std::size_t count = 0;
+
+        while (count < maxCount) {
+            const std::uint64_t written = m_writePosition.load(std::memory_order_acquire);
+            if (cursor.position >= written) {
+                break;
+            }
+
+            // Reader was lapped: skip to the oldest entry still in the ring
+            if (written - cursor.position > Capacity) {
+                const std::uint64_t oldest = written - Capacity;
+                cursor.dropped += oldest - cursor.position;
+                cursor.position = oldest;
+            }
+
+            const Slot& slot = m_slots[cursor.position & (Capacity - 1)];
+            const std::uint64_t expected = cursor.position * 2 + 2;
+
+            const std::uint64_t before = slot.sequence.load(std::memory_order_acquire);
+            std::memcpy(static_cast<void*>(&out[count]), &slot.value, sizeof(T));
+            std::atomic_thread_fence(std::memory_order_acquire);
+            const std::uint64_t after = slot.sequence.load(std::memory_order_relaxed);
+
+            if (before != expected || after != expected) {
+                // Overwritten by the writer while we copied it
+                ++cursor.position;
+                ++cursor.dropped;
+                continue;
+            }
+
+            ++cursor.position;
+            ++count;
+        }
+
+        return count;
+    }
+
+private:
+    struct Slot {
+        std::atomic<std::uint64_t> sequence{0};
+        T value{};
+    };
+
+    alignas(64) std::atomic<std::uint64_t> m_writePosition{0};
+    alignas(64) std::array<Slot, Capacity> m_slots{};
+};
+
+} // namespace openmeters::common
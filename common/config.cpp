@@ -1,34 +1,277 @@
 #include "config.h"
 #include "logger.h"
+#include "file-watcher.h"
 #include <fstream>
 #include <filesystem>
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
 #include <sstream>
+#include <thread>
+#include <utility>
 
 #ifdef _WIN32
 #include <windows.h>
 #include <shlobj.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
 #endif
 
 namespace openmeters::common {
 
-AppConfig ConfigManager::s_config;
+namespace {
 
-AppConfig& ConfigManager::get() {
-    return s_config;
+constexpr auto kSaveDebounce = std::chrono::milliseconds(500); // Coalesce bursts of saveAsync()
+
+/**
+ * Shared state behind ConfigManager.
+ */
+struct ConfigState {
+    std::atomic<ConfigSnapshot> current{std::make_shared<const AppConfig>()};
+    std::atomic<std::uint64_t> version{0};
+    
+    std::mutex publishMutex;    // Serializes publishers and their notifications
+    std::vector<std::pair<std::uint64_t, ConfigManager::Listener>> listeners;
+    std::uint64_t nextListenerId = 1;
+    
+    std::mutex pathMutex;
+    std::string path;
+    FileWatcher watcher;
+    
+    // Background saves
+    std::mutex writeMutex;             // One writer of the config file at a time
+    std::mutex saveMutex;              // Guards the fields below
+    std::condition_variable saveWake;
+    std::thread saver;
+    bool saverRunning = false;
+    bool saveRequested = false;
+    bool lastSaveOk = true;
+    std::chrono::steady_clock::time_point saveDue;
+    
+    ~ConfigState() {
+        {
+            std::lock_guard<std::mutex> lock(saveMutex);
+            saverRunning = false;
+        }
+        saveWake.notify_one();
+        if (saver.joinable()) {
+            saver.join();
+        }
+    }
+};
+
+ConfigState& state() {
+    static ConfigState instance;
+    return instance;
+}
+
+std::string configPath() {
+    ConfigState& s = state();
+    std::lock_guard<std::mutex> lock(s.pathMutex);
+    return s.path.empty() ? AppConfig::getDefaultConfigPath() : s.path;
 }
 
-bool ConfigManager::load() {
-    std::string configPath = AppConfig::getDefaultConfigPath();
-    return s_config.loadFromFile(configPath);
+bool writeCurrent() {
+    ConfigState& s = state();
+    std::lock_guard<std::mutex> lock(s.writeMutex);
+    return ConfigManager::snapshot()->saveToFile(configPath());
+}
+
+void saverLoop() {
+    ConfigState& s = state();
+    std::unique_lock<std::mutex> lock(s.saveMutex);
+    while (true) {
+        s.saveWake.wait(lock, [&s] { return s.saveRequested || !s.saverRunning; });
+        if (!s.saveRequested) {
+            break; // Stopped with nothing pending
+        }
+        
+        // Wait until requests stop arriving; a stop writes at once
+        while (s.saverRunning && s.saveRequested && std::chrono::steady_clock::now() < s.saveDue) {
+            s.saveWake.wait_until(lock, s.saveDue);
+        }
+        if (!s.saveRequested) {
+            continue; // save() got there first
+        }
+        s.saveRequested = false;
+        
+        // Serialize whatever is current by now, once for the whole burst
+        lock.unlock();
+        const bool ok = writeCurrent();
+        lock.lock();
+        s.lastSaveOk = ok;
+    }
+}
+
+/**
+ * Replace a file so that it holds either the old or the new contents, even
+ * if the process or the machine dies part-way: write a temporary file next
+ * to it, push it to disk, then rename it over the original.
+ */
+bool writeFileAtomically(const std::string& path, const std::string& contents) {
+    const std::string temporary = path + ".tmp";
+#ifdef _WIN32
+    HANDLE file = CreateFileA(temporary.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    DWORD written = 0;
+    const bool ok = WriteFile(file, contents.data(), static_cast<DWORD>(contents.size()), &written, nullptr) &&
+                    written == contents.size() && FlushFileBuffers(file);
+    CloseHandle(file);
+    if (!ok || !MoveFileExA(temporary.c_str(), path.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH)) {
+        DeleteFileA(temporary.c_str());
+        return false;
+    }
+    return true;
+#else
+    const int fd = ::open(temporary.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        return false;
+    }
+    std::size_t done = 0;
+    while (done < contents.size()) {
+        const ssize_t written = ::write(fd, contents.data() + done, contents.size() - done);
+        if (written <= 0) {
+            break;
+        }
+        done += static_cast<std::size_t>(written);
+    }
+    const bool ok = done == contents.size() && fsync(fd) == 0;
+    ::close(fd);
+    if (!ok || std::rename(temporary.c_str(), path.c_str()) != 0) {
+        std::remove(temporary.c_str());
+        return false;
+    }
+    return true;
+#endif
+}
+
+} // namespace
+
+ConfigSnapshot ConfigManager::snapshot() {
+    return state().current.load(std::memory_order_acquire);
+}
+
+std::uint64_t ConfigManager::version() noexcept {
+    return state().version.load(std::memory_order_acquire);
+}
+
+bool ConfigManager::publish(AppConfig config) {
+    ConfigState& s = state();
+    std::lock_guard<std::mutex> lock(s.publishMutex);
+    if (*s.current.load(std::memory_order_acquire) == config) {
+        return false;
+    }
+    
+    // Pointer first, then version: a reader that sees the new version gets this snapshot or newer
+    const ConfigSnapshot next = std::make_shared<const AppConfig>(std::move(config));
+    s.current.store(next, std::memory_order_release);
+    s.version.fetch_add(1, std::memory_order_acq_rel);
+    
+    for (const auto& [id, listener] : s.listeners) {
+        listener(next);
+    }
+    return true;
+}
+
+std::uint64_t ConfigManager::subscribe(Listener listener) {
+    ConfigState& s = state();
+    std::lock_guard<std::mutex> lock(s.publishMutex);
+    const std::uint64_t id = s.nextListenerId++;
+    s.listeners.emplace_back(id, std::move(listener));
+    return id;
+}
+
+void ConfigManager::unsubscribe(std::uint64_t id) {
+    ConfigState& s = state();
+    std::lock_guard<std::mutex> lock(s.publishMutex);
+    std::erase_if(s.listeners, [id](const auto& entry) { return entry.first == id; });
+}
+
+bool ConfigManager::load(const std::string& path) {
+    {
+        ConfigState& s = state();
+        std::lock_guard<std::mutex> lock(s.pathMutex);
+        s.path = path.empty() ? AppConfig::getDefaultConfigPath() : path;
+    }
+    
+    AppConfig config;
+    if (!config.loadFromFile(configPath())) {
+        return false;
+    }
+    publish(std::move(config));
+    return true;
 }
 
 bool ConfigManager::save() {
-    std::string configPath = AppConfig::getDefaultConfigPath();
-    return s_config.saveToFile(configPath);
+    {
+        // Writes the latest snapshot, which covers any pending request
+        ConfigState& s = state();
+        std::lock_guard<std::mutex> lock(s.saveMutex);
+        s.saveRequested = false;
+    }
+    return writeCurrent();
+}
+
+void ConfigManager::saveAsync() {
+    ConfigState& s = state();
+    {
+        std::lock_guard<std::mutex> lock(s.saveMutex);
+        s.saveRequested = true;
+        s.saveDue = std::chrono::steady_clock::now() + kSaveDebounce;
+        // While flushSaves() is stopping the saver, it picks the request up instead
+        if (!s.saverRunning && !s.saver.joinable()) {
+            s.saverRunning = true;
+            s.saver = std::thread(saverLoop);
+        }
+    }
+    s.saveWake.notify_one();
+}
+
+bool ConfigManager::flushSaves() {
+    ConfigState& s = state();
+    {
+        std::lock_guard<std::mutex> lock(s.saveMutex);
+        s.saverRunning = false;
+    }
+    s.saveWake.notify_one();
+    if (s.saver.joinable()) {
+        s.saver.join();
+    }
+    
+    std::unique_lock<std::mutex> lock(s.saveMutex);
+    if (s.saveRequested) {
+        s.saveRequested = false;
+        lock.unlock();
+        const bool ok = writeCurrent();
+        lock.lock();
+        s.lastSaveOk = ok;
+    }
+    return s.lastSaveOk;
+}
+
+bool ConfigManager::startWatching() {
+    const std::string path = configPath();
+    return state().watcher.start(path, [path] {
+        AppConfig config;
+        if (!config.loadFromFile(path)) {
+            LOG_WARNING("Keeping current configuration; {} could not be loaded", path);
+            return;
+        }
+        if (publish(std::move(config))) {
+            LOG_INFO("Configuration reloaded from {}", path);
+        }
+    });
+}
+
+void ConfigManager::stopWatching() {
+    state().watcher.stop();
 }
 
 void ConfigManager::reset() {
-    s_config = AppConfig();
+    publish(AppConfig());
 }
 
 std::string AppConfig::getDefaultConfigPath() {
@@ -47,13 +290,13 @@ std::string AppConfig::getDefaultConfigPath() {
 
 bool AppConfig::loadFromFile(const std::string& configPath) {
     if (!std::filesystem::exists(configPath)) {
-        LOG_INFO("Config file not found, using defaults: " + configPath);
+        LOG_INFO("Config file not found, using defaults: {}", configPath);
         return false;
     }
     
     std::ifstream file(configPath);
     if (!file.is_open()) {
-        LOG_ERROR("Failed to open config file: " + configPath);
+        LOG_ERROR("Failed to open config file: {}", configPath);
         return false;
     }
     
@@ -78,15 +321,30 @@ bool AppConfig::loadFromFile(const std::string& configPath) {
         // Audio settings
         if (j.contains("autoStartCapture")) autoStartCapture = j["autoStartCapture"];
         if (j.contains("audioBufferSize")) audioBufferSize = j["audioBufferSize"];
+        if (j.contains("publishSharedSnapshots")) publishSharedSnapshots = j["publishSharedSnapshots"];
+        if (j.contains("publishSharedAudio")) publishSharedAudio = j["publishSharedAudio"];
+        if (j.contains("meterPluginDirectory")) meterPluginDirectory = j["meterPluginDirectory"];
+        
+        // Streaming settings
+        if (j.contains("streamServerEnabled")) streamServerEnabled = j["streamServerEnabled"];
+        if (j.contains("streamSocketPath")) streamSocketPath = j["streamSocketPath"];
+        if (j.contains("metricsExporterEnabled")) metricsExporterEnabled = j["metricsExporterEnabled"];
+        if (j.contains("metricsPort")) metricsPort = j["metricsPort"];
+        if (j.contains("oscEnabled")) oscEnabled = j["oscEnabled"];
+        if (j.contains("oscHost")) oscHost = j["oscHost"];
+        if (j.contains("oscPort")) oscPort = j["oscPort"];
+        if (j.contains("oscRateHz")) oscRateHz = j["oscRateHz"];
+        if (j.contains("dashboardEnabled")) dashboardEnabled = j["dashboardEnabled"];
+        if (j.contains("dashboardPort")) dashboardPort = j["dashboardPort"];
         
         // UI settings
         if (j.contains("uiScale")) uiScale = j["uiScale"];
         if (j.contains("darkMode")) darkMode = j["darkMode"];
         
-        LOG_INFO("Config loaded from: " + configPath);
+        LOG_INFO("Config loaded from: {}", configPath);
         return true;
     } catch (const std::exception& e) {
-        LOG_ERROR("Failed to parse config file: " + std::string(e.what()));
+        LOG_ERROR("Failed to parse config file: {}", e.what());
         return false;
     }
 }
@@ -99,12 +357,6 @@ bool AppConfig::saveToFile(const std::string& configPath) const {
         std::filesystem::create_directories(dir);
     }
     
-    std::ofstream file(configPath);
-    if (!file.is_open()) {
-        LOG_ERROR("Failed to create config file: " + configPath);
-        return false;
-    }
-    
     try {
         nlohmann::json j;
         
@@ -125,18 +377,36 @@ bool AppConfig::saveToFile(const std::string& configPath) const {
         // Audio settings
         j["autoStartCapture"] = autoStartCapture;
         j["audioBufferSize"] = audioBufferSize;
+        j["publishSharedSnapshots"] = publishSharedSnapshots;
+        j["publishSharedAudio"] = publishSharedAudio;
+        j["meterPluginDirectory"] = meterPluginDirectory;
+        
+        // Streaming settings
+        j["streamServerEnabled"] = streamServerEnabled;
+        j["streamSocketPath"] = streamSocketPath;
+        j["metricsExporterEnabled"] = metricsExporterEnabled;
+        j["metricsPort"] = metricsPort;
+        j["oscEnabled"] = oscEnabled;
+        j["oscHost"] = oscHost;
+        j["oscPort"] = oscPort;
+        j["oscRateHz"] = oscRateHz;
+        j["dashboardEnabled"] = dashboardEnabled;
+        j["dashboardPort"] = dashboardPort;
         
         // UI settings
         j["uiScale"] = uiScale;
         j["darkMode"] = darkMode;
         
-        file << j.dump(4); // Pretty print with 4 spaces
-        file.close();
+        // Never truncate in place: a crash mid-write would leave a broken file
+        if (!writeFileAtomically(configPath, j.dump(4))) { // Pretty print with 4 spaces
+            LOG_ERROR("Failed to write config file: {}", configPath);
+            return false;
+        }
         
-        LOG_INFO("Config saved to: " + configPath);
+        LOG_INFO("Config saved to: {}", configPath);
         return true;
     } catch (const std::exception& e) {
-        LOG_ERROR("Failed to save config file: " + std::string(e.what()));
+        LOG_ERROR("Failed to save config file: {}", e.what());
         return false;
     }
 }
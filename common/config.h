@@ -1,6 +1,9 @@
 #pragma once
 
 #include "types.h"
+#include <atomic>
+#include <cstdint>
+#include <functional>
 #include <string>
 #include <memory>
 #include <vector>
@@ -30,11 +33,28 @@ struct AppConfig {
     // Audio settings
     bool autoStartCapture = false;
     float audioBufferSize = 0.1f; // seconds
+    bool publishSharedSnapshots = false; // Expose meters to other processes via shared memory
+    bool publishSharedAudio = false;     // Expose the raw float stream via a shared-memory ring
+    std::string meterPluginDirectory;    // Load meter plugins from here (empty: none)
+    
+    // Streaming settings
+    bool streamServerEnabled = false;    // Serve meters on a local Unix domain socket
+    std::string streamSocketPath;        // Empty: %TEMP%/openmeters.sock
+    bool metricsExporterEnabled = false; // Serve Prometheus metrics on 127.0.0.1
+    int metricsPort = 9464;
+    bool oscEnabled = false;             // Send meters as OSC bundles over UDP
+    std::string oscHost = "127.0.0.1";   // Unicast or multicast destination
+    int oscPort = 9000;
+    float oscRateHz = 30.0f;
+    bool dashboardEnabled = false;       // Push meters to browser dashboards over WebSocket
+    int dashboardPort = 8765;
     
     // UI settings
     float uiScale = 1.0f;
     bool darkMode = true;
     
+    bool operator==(const AppConfig&) const = default;
+    
     /**
      * Load configuration from file.
      * 
@@ -44,7 +64,8 @@ struct AppConfig {
     bool loadFromFile(const std::string& configPath);
     
     /**
-     * Save configuration to file.
+     * Save configuration to file (written to a temporary file, then renamed
+     * over the old one).
      * 
      * @param configPath Path to config file (JSON)
      * @return true if saved successfully, false otherwise
@@ -58,27 +79,96 @@ struct AppConfig {
     static std::string getDefaultConfigPath();
 };
 
+/**
+ * Immutable, shared view of the configuration. A published snapshot never
+ * changes; holders keep theirs alive for as long as they need it.
+ */
+using ConfigSnapshot = std::shared_ptr<const AppConfig>;
+
 /**
  * Configuration manager.
- * Singleton pattern for global configuration access.
+ * 
+ * The current configuration is an immutable snapshot behind an atomic
+ * pointer. Readers take a reference (or use ConfigView to skip even that
+ * until something changes); writers build a new AppConfig and publish() it,
+ * which swaps the pointer and notifies subscribers. With watching enabled,
+ * edits to config.json on disk are loaded and published the same way.
+ * 
+ * Thread safety: All members are thread-safe. Subscriber callbacks run on
+ * the publishing thread (the file watcher's for reloads), one at a time,
+ * and must not call publish(), subscribe() or unsubscribe().
  */
 class ConfigManager {
 public:
+    using Listener = std::function<void(const ConfigSnapshot&)>;
+    
     /**
-     * Get the global configuration instance.
+     * Current configuration.
      */
-    static AppConfig& get();
+    static ConfigSnapshot snapshot();
     
     /**
-     * Load configuration from default location.
+     * Incremented by every publish(); one relaxed-cost load for polling.
      */
-    static bool load();
+    static std::uint64_t version() noexcept;
     
     /**
-     * Save configuration to default location.
+     * Make a configuration current and notify subscribers.
+     * Publishing a configuration equal to the current one does nothing.
+     * 
+     * @return true if the configuration changed
+     */
+    static bool publish(AppConfig config);
+    
+    /**
+     * Call back with each newly published configuration.
+     * 
+     * @return Id for unsubscribe()
+     */
+    static std::uint64_t subscribe(Listener listener);
+    
+    /**
+     * Remove a subscriber. No callback to it runs after this returns.
+     */
+    static void unsubscribe(std::uint64_t id);
+    
+    /**
+     * Load and publish configuration from a file (default location if empty).
+     * The path is remembered for save() and watching.
+     */
+    static bool load(const std::string& configPath = {});
+    
+    /**
+     * Save the current configuration to the loaded path now.
+     * The file is replaced atomically; it is never left half-written.
      */
     static bool save();
     
+    /**
+     * Save in the background. Requests within a short window are coalesced
+     * and the configuration current at the end of it is written once.
+     * Never blocks on file I/O; safe to call from the UI thread.
+     */
+    static void saveAsync();
+    
+    /**
+     * Write any pending background save now and stop the saver thread.
+     * 
+     * @return false if the last background save failed
+     */
+    static bool flushSaves();
+    
+    /**
+     * Reload the loaded path whenever the file changes on disk.
+     * A file that fails to parse leaves the current configuration in place.
+     */
+    static bool startWatching();
+    
+    /**
+     * Stop reloading on file changes.
+     */
+    static void stopWatching();
+    
     /**
      * Reset to default configuration.
      */
@@ -86,7 +176,41 @@ public:
 
 private:
     ConfigManager() = default;
-    static AppConfig s_config;
+};
+
+/**
+ * Cached snapshot for hot paths.
+ * refresh() costs one atomic load unless a new configuration was
+ * published; the snapshot itself is then only touched by its owner.
+ * 
+ * Thread safety: One ConfigView per thread.
+ */
+class ConfigView {
+public:
+    ConfigView() : m_version(ConfigManager::version()), m_snapshot(ConfigManager::snapshot()) {}
+    
+    /**
+     * Pick up a newer configuration if one was published.
+     * 
+     * @return true if the view changed
+     */
+    bool refresh() {
+        const std::uint64_t version = ConfigManager::version();
+        if (version == m_version) {
+            return false;
+        }
+        m_version = version;
+        m_snapshot = ConfigManager::snapshot();
+        return true;
+    }
+    
+    [[nodiscard]] const AppConfig& operator*() const noexcept { return *m_snapshot; }
+    [[nodiscard]] const AppConfig* operator->() const noexcept { return m_snapshot.get(); }
+    [[nodiscard]] const ConfigSnapshot& snapshot() const noexcept { return m_snapshot; }
+
+private:
+    std::uint64_t m_version;
+    ConfigSnapshot m_snapshot;
 };
 
 } // namespace openmeters::common
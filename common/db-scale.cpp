@@ -0,0 +1,34 @@
+#include "db-scale.h"
+#include <algorithm>
+#include <cmath>
+
+namespace openmeters::common {
+
+DbScale DbScale::dbfs(float minDb, float maxDb, int segments, float warningFromDb, float overFromDb) {
+    DbScale scale{Unset{}};
+    scale.m_segments = std::clamp(segments, 1, kMaxSegments);
+    scale.m_minDb = minDb;
+    scale.m_maxDb = maxDb > minDb ? maxDb : minDb + 1.0f;
+
+    for (int i = 0; i < scale.m_segments; ++i) {
+        const float db = scale.segmentDb(i);
+        const auto index = static_cast<std::size_t>(i);
+        scale.m_thresholds[index] = std::pow(10.0f, db / 20.0f);
+        scale.m_zones[index] = db >= overFromDb ? DbZone::Over : db >= warningFromDb ? DbZone::Warning : DbZone::Normal;
+    }
+    return scale;
+}
+
+DbScale DbScale::kSystem(int k, int segments) {
+    const auto reference = static_cast<float>(-k);
+    return dbfs(reference - 40.0f, 0.0f, segments, reference, reference + 4.0f);
+}
+
+int DbScale::litSegments(float linear) const noexcept {
+    // Thresholds ascend; count those strictly below the level (NaN lights nothing)
+    const float* begin = m_thresholds.data();
+    const float* end = begin + m_segments;
+    return static_cast<int>(std::lower_bound(begin, end, linear) - begin);
+}
+
+} // namespace openmeters::common
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+namespace openmeters::common {
+
+/**
+ * Color zone of a meter segment.
+ */
+enum class DbZone : std::uint8_t {
+    Normal,   // Green
+    Warning,  // Yellow
+    Over      // Red
+};
+
+/**
+ * A segmented dB scale with its linear thresholds precomputed.
+ *
+ * Segment i covers [segmentDb(i), segmentDb(i + 1)) and is lit when the
+ * linear level is above threshold(i) = 10^(segmentDb(i) / 20). Lighting a
+ * bar is then a compare per segment (or a binary search), with no log10
+ * per frame.
+ *
+ * Fixed capacity, no allocation; cheap to copy.
+ */
+class DbScale {
+public:
+    static constexpr int kMaxSegments = 64;
+
+    /**
+     * Evenly spaced dB scale, e.g. dbfs(-60, 0, 20, -18, -6).
+     *
+     * @param warningFromDb Segments starting at or above this are yellow
+     * @param overFromDb Segments starting at or above this are red
+     */
+    static DbScale dbfs(float minDb, float maxDb, int segments, float warningFromDb, float overFromDb);
+
+    /**
+     * K-system meter (Katz): 0 K sits at -k dBFS, the scale runs from
+     * -40 K to full scale, yellow from 0 K and red from +4 K.
+     *
+     * @param k Headroom, typically 20, 14 or 12
+     */
+    static DbScale kSystem(int k, int segments);
+
+    /**
+     * The overlay's default: 20 segments over -60..0 dBFS, yellow from
+     * -18 dB, red from -6 dB.
+     */
+    DbScale() : DbScale(dbfs(-60.0f, 0.0f, 20, -18.0f, -6.0f)) {}
+
+    [[nodiscard]] int segments() const noexcept { return m_segments; }
+    [[nodiscard]] float minDb() const noexcept { return m_minDb; }
+    [[nodiscard]] float maxDb() const noexcept { return m_maxDb; }
+
+    /**
+     * Lower edge of segment @p index in dB.
+     */
+    [[nodiscard]] float segmentDb(int index) const noexcept {
+        return m_minDb + (m_maxDb - m_minDb) * static_cast<float>(index) / static_cast<float>(m_segments);
+    }
+
+    [[nodiscard]] float threshold(int index) const noexcept { return m_thresholds[static_cast<std::size_t>(index)]; }
+    [[nodiscard]] DbZone zone(int index) const noexcept { return m_zones[static_cast<std::size_t>(index)]; }
+
+    /**
+     * Number of segments lit by a linear level (segments light from the bottom).
+     */
+    [[nodiscard]] int litSegments(float linear) const noexcept;
+
+    bool operator==(const DbScale&) const = default;
+
+private:
+    struct Unset {};
+    explicit DbScale(Unset) {}
+
+    int m_segments = 0;
+    float m_minDb = 0.0f;
+    float m_maxDb = 0.0f;
+    std::array<float, kMaxSegments> m_thresholds{};
+    std::array<DbZone, kMaxSegments> m_zones{};
+};
+
+} // namespace openmeters::common
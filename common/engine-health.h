@@ -0,0 +1,107 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace openmeters::common {
+
+/**
+ * Point-in-time copy of the engine health counters.
+ * All counters are cumulative since the engine was created.
+ */
+struct EngineHealth {
+    std::uint64_t packets = 0;           // Capture packets delivered
+    std::uint64_t frames = 0;            // Frames delivered
+    std::uint64_t silentPackets = 0;     // Packets flagged silent by the device
+    std::uint64_t discontinuities = 0;   // Packets flagged as following a gap
+    std::uint64_t bufferErrors = 0;      // Failed buffer fetches
+    std::uint64_t droppedEvents = 0;     // Events the detector could not report
+
+    // Device timestamp to callback entry
+    std::uint64_t latencyCount = 0;
+    std::uint64_t latencySumUs = 0;
+    std::uint64_t latencyMaxUs = 0;
+
+    // Time spent inside the metering callback
+    std::uint64_t processingSumUs = 0;
+    std::uint64_t processingMaxUs = 0;
+};
+
+/**
+ * Live engine health counters.
+ * Written only by the capture thread with relaxed atomics; any thread may
+ * take a snapshot() without synchronising with it. Individual counters are
+ * exact, but a snapshot is not guaranteed to be mutually consistent.
+ */
+class EngineHealthCounters {
+public:
+    void recordPacket(std::uint64_t frames, bool silent, bool discontinuity) noexcept {
+        bump(m_packets, 1);
+        bump(m_frames, frames);
+        if (silent) {
+            bump(m_silentPackets, 1);
+        }
+        if (discontinuity) {
+            bump(m_discontinuities, 1);
+        }
+    }
+
+    void recordBufferError() noexcept { bump(m_bufferErrors, 1); }
+
+    void recordLatency(std::uint64_t micros) noexcept {
+        bump(m_latencyCount, 1);
+        bump(m_latencySumUs, micros);
+        raise(m_latencyMaxUs, micros);
+    }
+
+    void recordProcessing(std::uint64_t micros) noexcept {
+        bump(m_processingSumUs, micros);
+        raise(m_processingMaxUs, micros);
+    }
+
+    void setDroppedEvents(std::uint64_t count) noexcept {
+        m_droppedEvents.store(count, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] EngineHealth snapshot() const noexcept {
+        EngineHealth health;
+        health.packets = m_packets.load(std::memory_order_relaxed);
+        health.frames = m_frames.load(std::memory_order_relaxed);
+        health.silentPackets = m_silentPackets.load(std::memory_order_relaxed);
+        health.discontinuities = m_discontinuities.load(std::memory_order_relaxed);
+        health.bufferErrors = m_bufferErrors.load(std::memory_order_relaxed);
+        health.droppedEvents = m_droppedEvents.load(std::memory_order_relaxed);
+        health.latencyCount = m_latencyCount.load(std::memory_order_relaxed);
+        health.latencySumUs = m_latencySumUs.load(std::memory_order_relaxed);
+        health.latencyMaxUs = m_latencyMaxUs.load(std::memory_order_relaxed);
+        health.processingSumUs = m_processingSumUs.load(std::memory_order_relaxed);
+        health.processingMaxUs = m_processingMaxUs.load(std::memory_order_relaxed);
+        return health;
+    }
+
+private:
+    // Single writer, so a plain load/store pair is enough (no locked RMW)
+    static void bump(std::atomic<std::uint64_t>& counter, std::uint64_t amount) noexcept {
+        counter.store(counter.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+    }
+
+    static void raise(std::atomic<std::uint64_t>& counter, std::uint64_t value) noexcept {
+        if (value > counter.load(std::memory_order_relaxed)) {
+            counter.store(value, std::memory_order_relaxed);
+        }
+    }
+
+    std::atomic<std::uint64_t> m_packets{0};
+    std::atomic<std::uint64_t> m_frames{0};
+    std::atomic<std::uint64_t> m_silentPackets{0};
+    std::atomic<std::uint64_t> m_discontinuities{0};
+    std::atomic<std::uint64_t> m_bufferErrors{0};
+    std::atomic<std::uint64_t> m_droppedEvents{0};
+    std::atomic<std::uint64_t> m_latencyCount{0};
+    std::atomic<std::uint64_t> m_latencySumUs{0};
+    std::atomic<std::uint64_t> m_latencyMaxUs{0};
+    std::atomic<std::uint64_t> m_processingSumUs{0};
+    std::atomic<std::uint64_t> m_processingMaxUs{0};
+};
+
+} // namespace openmeters::common
@@ -0,0 +1,70 @@
+#include "fast-math.h"
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define OPENMETERS_FAST_MATH_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace openmeters::common {
+
+#ifdef OPENMETERS_FAST_MATH_SSE2
+
+namespace {
+
+/**
+ * fastLog2 on four lanes. Inputs must be positive and normal.
+ */
+inline __m128 log2x4(__m128 x) {
+    const __m128i bits = _mm_castps_si128(x);
+    __m128i exponent = _mm_sub_epi32(_mm_srli_epi32(bits, 23), _mm_set1_epi32(127));
+    __m128 mantissa = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(bits, _mm_set1_epi32(0x007FFFFF)),
+                                                    _mm_set1_epi32(0x3F800000)));
+
+    // Fold [sqrt 2, 2) down to [sqrt(1/2), 1): halve the mantissa, bump the exponent
+    const __m128 fold = _mm_cmpgt_ps(mantissa, _mm_set1_ps(detail::kSqrt2));
+    mantissa = _mm_or_ps(_mm_and_ps(fold, _mm_mul_ps(mantissa, _mm_set1_ps(0.5f))), _mm_andnot_ps(fold, mantissa));
+    exponent = _mm_sub_epi32(exponent, _mm_castps_si128(fold)); // Mask lanes are -1
+
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 t = _mm_div_ps(_mm_sub_ps(mantissa, one), _mm_add_ps(mantissa, one));
+    const __m128 t2 = _mm_mul_ps(t, t);
+    __m128 series = _mm_add_ps(_mm_set1_ps(detail::kLog2C5), _mm_mul_ps(t2, _mm_set1_ps(detail::kLog2C7)));
+    series = _mm_add_ps(_mm_set1_ps(detail::kLog2C3), _mm_mul_ps(t2, series));
+    series = _mm_add_ps(_mm_set1_ps(detail::kLog2C1), _mm_mul_ps(t2, series));
+    series = _mm_mul_ps(t, series);
+    return _mm_add_ps(_mm_cvtepi32_ps(exponent), series);
+}
+
+} // namespace
+
+void linearToDb(const float* in, float* out, std::size_t count, float floorDb) noexcept {
+    floorDb = std::max(floorDb, kMinDb);
+    // Clamping the input to the floor's amplitude first keeps every lane
+    // positive and normal; max() also maps NaN to the floor
+    const __m128 minimum = _mm_set1_ps(std::max(fastExp2(floorDb / kDbPerLog2), 1.2e-38f));
+    const __m128 scale = _mm_set1_ps(kDbPerLog2);
+    const __m128 floor = _mm_set1_ps(floorDb);
+
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m128 x = _mm_max_ps(_mm_loadu_ps(in + i), minimum);
+        _mm_storeu_ps(out + i, _mm_max_ps(_mm_mul_ps(log2x4(x), scale), floor));
+    }
+    for (; i < count; ++i) {
+        out[i] = fastLinearToDb(in[i], floorDb);
+    }
+}
+
+#else
+
+void linearToDb(const float* in, float* out, std::size_t count, float floorDb) noexcept {
+    floorDb = std::max(floorDb, kMinDb);
+    for (std::size_t i = 0; i < count; ++i) {
+        out[i] = fastLinearToDb(in[i], floorDb);
+    }
+}
+
+#endif
+
+} // namespace openmeters::common
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+namespace openmeters::common {
+
+/**
+ * Fast log2/dB conversions for display and analysis paths.
+ *
+ * log2 splits the float into exponent and mantissa, folds the mantissa
+ * into [sqrt(1/2), sqrt(2)) and evaluates a short atanh series. The error
+ * is below 1e-6 in log2 for inputs within 60 dB of 1 and below 5e-6
+ * (3e-5 dB, float rounding of the result) over the whole normal range,
+ * far under anything a meter can show. The scalar and bulk paths run the
+ * same steps, so they agree to within float rounding.
+ *
+ * Not for paths that need correctly rounded results (e.g. the dashboard's
+ * 0.1 dB wire quantization keeps std::log10).
+ */
+
+inline constexpr float kDbPerLog2 = 6.0205999132796239f;   // 20 * log10(2)
+inline constexpr float kMinDb = -750.0f;                   // Near the smallest normal float
+
+namespace detail {
+
+inline constexpr float kSqrt2 = 1.41421356237f;
+inline constexpr float kLog2C1 = 2.88539008178f;            // 2 / ln 2
+inline constexpr float kLog2C3 = 0.961796693926f;           // 2 / (3 ln 2)
+inline constexpr float kLog2C5 = 0.577078016356f;           // 2 / (5 ln 2)
+inline constexpr float kLog2C7 = 0.412198583111f;           // 2 / (7 ln 2)
+
+} // namespace detail
+
+/**
+ * log2 of a positive, normal, finite float.
+ */
+[[nodiscard]] inline float fastLog2(float x) noexcept {
+    const std::uint32_t bits = std::bit_cast<std::uint32_t>(x);
+    int exponent = static_cast<int>(bits >> 23) - 127;
+    float mantissa = std::bit_cast<float>((bits & 0x007FFFFFu) | 0x3F800000u);
+    if (mantissa > detail::kSqrt2) {
+        mantissa *= 0.5f;
+        exponent += 1;
+    }
+    const float t = (mantissa - 1.0f) / (mantissa + 1.0f);
+    const float t2 = t * t;
+    const float series = t * (detail::kLog2C1 + t2 * (detail::kLog2C3 + t2 * (detail::kLog2C5 + t2 * detail::kLog2C7)));
+    return static_cast<float>(exponent) + series;
+}
+
+/**
+ * 2^x for x in roughly [-126, 127], relative error below 2e-7.
+ */
+[[nodiscard]] inline float fastExp2(float x) noexcept {
+    if (x < -126.0f) {
+        return 0.0f;
+    }
+    if (x > 127.0f) {
+        x = 127.0f;
+    }
+    // Round to the nearest integer so the fraction stays in [-0.5, 0.5]
+    const float rounded = static_cast<float>(static_cast<int>(x + (x >= 0.0f ? 0.5f : -0.5f)));
+    const float f = (x - rounded) * 0.693147180560f; // To natural-log units
+    const float series = 1.0f + f * (1.0f + f * (0.5f + f * (1.0f / 6.0f + f * (1.0f / 24.0f +
+                         f * (1.0f / 120.0f + f * (1.0f / 720.0f))))));
+    const auto exponent = static_cast<std::uint32_t>(static_cast<int>(rounded) + 127) << 23;
+    return series * std::bit_cast<float>(exponent);
+}
+
+/**
+ * Linear amplitude to dB, with anything at or below @p floorDb (including
+ * zero, negatives and NaN) returned as floorDb.
+ */
+[[nodiscard]] inline float fastLinearToDb(float linear, float floorDb) noexcept {
+    const float db = linear > 1.2e-38f ? fastLog2(linear) * kDbPerLog2 : kMinDb;
+    return db > floorDb ? db : floorDb;
+}
+
+/**
+ * dB to linear amplitude; at or below @p floorDb reads as silence (0).
+ */
+[[nodiscard]] inline float fastDbToLinear(float db, float floorDb) noexcept {
+    return db <= floorDb ? 0.0f : fastExp2(db / kDbPerLog2);
+}
+
+/**
+ * Convert a block of linear amplitudes to dB (e.g. spectrum bins). Uses
+ * SSE2 where available. @p in and @p out may be the same buffer.
+ */
+void linearToDb(const float* in, float* out, std::size_t count, float floorDb) noexcept;
+
+} // namespace openmeters::common
@@ -0,0 +1,225 @@
+#include "file-watcher.h"
+#include "logger.h"
+#include <filesystem>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif defined(__linux__)
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#include <cstring>
+#endif
+
+namespace openmeters::common {
+
+namespace {
+
+constexpr auto kPollInterval = std::chrono::milliseconds(100); // Stop latency where the OS cannot wake us
+
+} // namespace
+
+bool FileWatcher::start(const std::string& path, std::function<void()> onChange, std::chrono::milliseconds debounce) {
+    if (m_running.load() || !onChange) {
+        return false;
+    }
+
+    const std::filesystem::path filePath(path);
+    m_directory = filePath.has_parent_path() ? filePath.parent_path().string() : ".";
+    m_fileName = filePath.filename().string();
+    m_onChange = std::move(onChange);
+    m_debounce = debounce;
+
+#ifdef _WIN32
+    HANDLE directory = CreateFileA(
+        m_directory.c_str(), FILE_LIST_DIRECTORY, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+        nullptr, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, nullptr
+    );
+    if (directory == INVALID_HANDLE_VALUE) {
+        LOG_WARNING("Cannot watch directory {} (error {})", m_directory, GetLastError());
+        return false;
+    }
+    m_directoryHandle = directory;
+    m_stopEvent = CreateEventA(nullptr, TRUE, FALSE, nullptr);
+#elif defined(__linux__)
+    m_inotify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (m_inotify < 0 || inotify_add_watch(m_inotify, m_directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO) < 0) {
+        LOG_WARNING("Cannot watch directory {} ({})", m_directory, std::strerror(errno));
+        if (m_inotify >= 0) {
+            close(m_inotify);
+            m_inotify = -1;
+        }
+        return false;
+    }
+#else
+    if (!std::filesystem::is_directory(m_directory)) {
+        LOG_WARNING("Cannot watch directory {}", m_directory);
+        return false;
+    }
+#endif
+
+    m_running.store(true);
+    m_thread = std::thread(&FileWatcher::run, this);
+    return true;
+}
+
+void FileWatcher::stop() {
+    if (!m_running.exchange(false)) {
+        return;
+    }
+#ifdef _WIN32
+    SetEvent(static_cast<HANDLE>(m_stopEvent));
+#endif
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+#ifdef _WIN32
+    CloseHandle(static_cast<HANDLE>(m_directoryHandle));
+    CloseHandle(static_cast<HANDLE>(m_stopEvent));
+    m_directoryHandle = nullptr;
+    m_stopEvent = nullptr;
+#elif defined(__linux__)
+    close(m_inotify);
+    m_inotify = -1;
+#endif
+}
+
+#ifdef _WIN32
+
+namespace {
+
+/**
+ * Whether a ReadDirectoryChangesW result writes or renames onto the file.
+ */
+bool mentionsFile(const std::byte* buffer, DWORD size, const std::wstring& fileName) {
+    DWORD offset = 0;
+    while (offset + sizeof(FILE_NOTIFY_INFORMATION) <= size) {
+        const auto* info = reinterpret_cast<const FILE_NOTIFY_INFORMATION*>(buffer + offset);
+        const bool written = info->Action == FILE_ACTION_ADDED || info->Action == FILE_ACTION_MODIFIED ||
+                             info->Action == FILE_ACTION_RENAMED_NEW_NAME;
+        const int length = static_cast<int>(info->FileNameLength / sizeof(WCHAR));
+        if (written && CompareStringOrdinal(info->FileName, length, fileName.c_str(),
+                                            static_cast<int>(fileName.size()), TRUE) == CSTR_EQUAL) {
+            return true;
+        }
+        if (info->NextEntryOffset == 0) {
+            break;
+        }
+        offset += info->NextEntryOffset;
+    }
+    return false;
+}
+
+} // namespace
+
+void FileWatcher::run() {
+    const HANDLE directory = static_cast<HANDLE>(m_directoryHandle);
+    const int wideLength = MultiByteToWideChar(CP_ACP, 0, m_fileName.c_str(), -1, nullptr, 0);
+    std::wstring fileName(wideLength > 0 ? wideLength - 1 : 0, L'\0');
+    MultiByteToWideChar(CP_ACP, 0, m_fileName.c_str(), -1, fileName.data(), wideLength);
+
+    OVERLAPPED overlapped{};
+    overlapped.hEvent = CreateEventA(nullptr, TRUE, FALSE, nullptr);
+    alignas(FILE_NOTIFY_INFORMATION) std::byte buffer[16 * 1024];
+    bool reading = false;
+    bool pending = false;
+
+    while (m_running.load()) {
+        if (!reading) {
+            ResetEvent(overlapped.hEvent);
+            if (!ReadDirectoryChangesW(directory, buffer, sizeof(buffer), FALSE,
+                                       FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_SIZE,
+                                       nullptr, &overlapped, nullptr)) {
+                LOG_WARNING("Stopped watching {}: ReadDirectoryChangesW failed (error {})", m_directory, GetLastError());
+                break;
+            }
+            reading = true;
+        }
+
+        // Each new event restarts the quiet period
+        const HANDLE handles[] = {overlapped.hEvent, static_cast<HANDLE>(m_stopEvent)};
+        const DWORD timeout = pending ? static_cast<DWORD>(m_debounce.count()) : INFINITE;
+        const DWORD wait = WaitForMultipleObjects(2, handles, FALSE, timeout);
+        if (wait == WAIT_OBJECT_0) {
+            reading = false;
+            DWORD bytes = 0;
+            if (GetOverlappedResult(directory, &overlapped, &bytes, FALSE)) {
+                // Zero bytes: the buffer overflowed, so assume the file was among the changes
+                pending = pending || bytes == 0 || mentionsFile(buffer, bytes, fileName);
+            }
+        } else if (wait == WAIT_TIMEOUT) {
+            pending = false;
+            m_onChange();
+        } else {
+            break; // Stop requested
+        }
+    }
+
+    if (reading) {
+        DWORD bytes = 0;
+        CancelIoEx(directory, &overlapped);
+        GetOverlappedResult(directory, &overlapped, &bytes, TRUE);
+    }
+    CloseHandle(overlapped.hEvent);
+}
+
+#elif defined(__linux__)
+
+void FileWatcher::run() {
+    alignas(inotify_event) char buffer[4096];
+    bool pending = false;
+    auto quietAt = std::chrono::steady_clock::now();
+
+    while (m_running.load()) {
+        pollfd descriptor{m_inotify, POLLIN, 0};
+        if (poll(&descriptor, 1, static_cast<int>(kPollInterval.count())) > 0) {
+            ssize_t length = 0;
+            while ((length = read(m_inotify, buffer, sizeof(buffer))) > 0) {
+                for (ssize_t offset = 0; offset < length;) {
+                    const auto* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+                    if ((event->mask & IN_Q_OVERFLOW) || (event->len > 0 && m_fileName == event->name)) {
+                        pending = true;
+                        quietAt = std::chrono::steady_clock::now() + m_debounce;
+                    }
+                    offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+                }
+            }
+        }
+        if (pending && std::chrono::steady_clock::now() >= quietAt) {
+            pending = false;
+            m_onChange();
+        }
+    }
+}
+
+#else
+
+void FileWatcher::run() {
+    // No change notifications here: compare the modification time
+    const std::filesystem::path path = std::filesystem::path(m_directory) / m_fileName;
+    std::error_code error;
+    auto lastWrite = std::filesystem::last_write_time(path, error);
+    bool pending = false;
+    auto quietAt = std::chrono::steady_clock::now();
+
+    while (m_running.load()) {
+        std::this_thread::sleep_for(kPollInterval);
+        const auto writeTime = std::filesystem::last_write_time(path, error);
+        if (!error && writeTime != lastWrite) {
+            lastWrite = writeTime;
+            pending = true;
+            quietAt = std::chrono::steady_clock::now() + m_debounce;
+        }
+        if (pending && std::chrono::steady_clock::now() >= quietAt) {
+            pending = false;
+            m_onChange();
+        }
+    }
+}
+
+#endif
+
+} // namespace openmeters::common
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <string>
+#include <thread>
+
+namespace openmeters::common {
+
+/**
+ * Calls back when a file is written, created or replaced.
+ *
+ * Watches the file's directory (ReadDirectoryChangesW on Windows, inotify
+ * on Linux, modification-time polling elsewhere), so editors that save by
+ * writing a new file and renaming it over the old one are seen too. Bursts
+ * of events are coalesced: the callback runs once the file has been quiet
+ * for the debounce interval.
+ *
+ * Thread safety: start()/stop() from one thread. The callback runs on the
+ * watcher's own thread.
+ */
+class FileWatcher {
+public:
+    FileWatcher() = default;
+    ~FileWatcher() { stop(); }
+
+    // Non-copyable, non-movable (the thread refers to this)
+    FileWatcher(const FileWatcher&) = delete;
+    FileWatcher& operator=(const FileWatcher&) = delete;
+    FileWatcher(FileWatcher&&) = delete;
+    FileWatcher& operator=(FileWatcher&&) = delete;
+
+    /**
+     * Start watching. The file need not exist yet; its directory must.
+     *
+     * @return false if already running or the directory cannot be watched
+     */
+    bool start(const std::string& path, std::function<void()> onChange,
+               std::chrono::milliseconds debounce = std::chrono::milliseconds(250));
+
+    /**
+     * Stop watching and join the thread. No callback runs after this returns.
+     */
+    void stop();
+
+    [[nodiscard]] bool isRunning() const noexcept { return m_running.load(); }
+
+private:
+    void run();
+
+    std::string m_directory;
+    std::string m_fileName;
+    std::function<void()> m_onChange;
+    std::chrono::milliseconds m_debounce{250};
+
+    std::atomic<bool> m_running{false};
+    std::thread m_thread;
+#ifdef _WIN32
+    void* m_directoryHandle = nullptr; // HANDLE
+    void* m_stopEvent = nullptr;       // HANDLE
+#elif defined(__linux__)
+    int m_inotify = -1;
+#endif
+};
+
+} // namespace openmeters::common
@@ -0,0 +1,203 @@
+#include "log-file.h"
+#include <filesystem>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace openmeters::common {
+
+bool RotatingLogFile::open(const std::string& path, const LogFileSettings& settings, bool append) {
+    close();
+    m_path = path;
+    m_settings = settings;
+
+    std::error_code error;
+    const std::filesystem::path filePath(path);
+    if (filePath.has_parent_path()) {
+        std::filesystem::create_directories(filePath.parent_path(), error);
+    }
+
+    // Start fresh if asked to, or if the previous run left a full or stale file
+    if (std::filesystem::exists(filePath, error)) {
+        const auto bytes = std::filesystem::file_size(filePath, error);
+        const auto age = std::filesystem::file_time_type::clock::now() - std::filesystem::last_write_time(filePath, error);
+        const bool full = m_settings.maxFileBytes > 0 && bytes >= m_settings.maxFileBytes;
+        const bool stale = m_settings.maxFileAge.count() > 0 && age >= m_settings.maxFileAge;
+        if (!error && bytes > 0 && (!append || full || stale)) {
+            return rotate();
+        }
+    }
+    return openHandle(true);
+}
+
+void RotatingLogFile::close() {
+    closeHandle();
+    m_size = 0;
+    m_reserved = 0;
+}
+
+bool RotatingLogFile::shouldRotate(std::size_t pendingBytes) const {
+    if (!isOpen() || m_size == 0) {
+        return false;
+    }
+    if (m_settings.maxFileBytes > 0 && m_size + pendingBytes > m_settings.maxFileBytes) {
+        return true;
+    }
+    return m_settings.maxFileAge.count() > 0 && std::chrono::steady_clock::now() - m_openedAt >= m_settings.maxFileAge;
+}
+
+bool RotatingLogFile::rotate() {
+    closeHandle();
+
+    // name.ext -> name.1.ext -> ... -> name.N.ext -> deleted
+    std::error_code error;
+    const std::uint32_t retained = m_settings.maxRetainedFiles;
+    std::filesystem::remove(rotatedPath(m_path, retained + 1), error);
+    if (retained > 0) {
+        std::filesystem::remove(rotatedPath(m_path, retained), error);
+        for (std::uint32_t index = retained; index > 1; --index) {
+            std::filesystem::rename(rotatedPath(m_path, index - 1), rotatedPath(m_path, index), error);
+        }
+        std::filesystem::rename(m_path, rotatedPath(m_path, 1), error);
+    }
+    return openHandle(false);
+}
+
+std::string RotatingLogFile::rotatedPath(const std::string& path, std::uint32_t index) {
+    const std::filesystem::path filePath(path);
+    std::filesystem::path rotated = filePath.parent_path() / filePath.stem();
+    rotated += "." + std::to_string(index);
+    rotated += filePath.extension();
+    return rotated.string();
+}
+
+#ifdef _WIN32
+
+bool RotatingLogFile::isOpen() const noexcept {
+    return m_handle != nullptr;
+}
+
+bool RotatingLogFile::openHandle(bool append) {
+    // Write access (not append-only) is needed to reserve allocation; we are the only writer
+    HANDLE handle = CreateFileA(
+        m_path.c_str(), GENERIC_WRITE | FILE_READ_ATTRIBUTES, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr,
+        append ? OPEN_ALWAYS : CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr
+    );
+    if (handle == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    LARGE_INTEGER size{};
+    GetFileSizeEx(handle, &size);
+    SetFilePointerEx(handle, LARGE_INTEGER{}, nullptr, FILE_END);
+    m_handle = handle;
+    m_size = static_cast<std::uint64_t>(size.QuadPart);
+    m_reserved = m_size;
+    m_openedAt = std::chrono::steady_clock::now();
+    return true;
+}
+
+void RotatingLogFile::closeHandle() {
+    if (m_handle) {
+        // Allocation past end-of-file is released when the last handle closes
+        CloseHandle(static_cast<HANDLE>(m_handle));
+        m_handle = nullptr;
+    }
+}
+
+void RotatingLogFile::reserve(std::uint64_t end) {
+    FILE_ALLOCATION_INFO allocation{};
+    allocation.AllocationSize.QuadPart = static_cast<LONGLONG>(end);
+    if (SetFileInformationByHandle(static_cast<HANDLE>(m_handle), FileAllocationInfo, &allocation, sizeof(allocation))) {
+        m_reserved = end;
+    } else {
+        m_settings.preallocateBytes = 0; // File system does not support it; stop trying
+    }
+}
+
+bool RotatingLogFile::write(const char* data, std::size_t size) {
+    if (!m_handle || size == 0) {
+        return m_handle != nullptr;
+    }
+    if (m_settings.preallocateBytes > 0 && m_size + size > m_reserved) {
+        reserve(m_size + size + m_settings.preallocateBytes);
+    }
+    DWORD written = 0;
+    const BOOL ok = WriteFile(static_cast<HANDLE>(m_handle), data, static_cast<DWORD>(size), &written, nullptr);
+    m_size += written;
+    return ok && written == size;
+}
+
+#else
+
+bool RotatingLogFile::isOpen() const noexcept {
+    return m_fd >= 0;
+}
+
+bool RotatingLogFile::openHandle(bool append) {
+    const int fd = ::open(m_path.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC | (append ? 0 : O_TRUNC), 0644);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat info{};
+    fstat(fd, &info);
+    m_fd = fd;
+    m_size = static_cast<std::uint64_t>(info.st_size);
+    m_reserved = m_size;
+    m_openedAt = std::chrono::steady_clock::now();
+    return true;
+}
+
+void RotatingLogFile::closeHandle() {
+    if (m_fd >= 0) {
+#ifdef __linux__
+        // Give back blocks reserved past end-of-file
+        if (m_reserved > m_size) {
+            ftruncate(m_fd, static_cast<off_t>(m_size));
+        }
+#endif
+        ::close(m_fd);
+        m_fd = -1;
+    }
+}
+
+void RotatingLogFile::reserve(std::uint64_t end) {
+#ifdef __linux__
+    if (fallocate(m_fd, FALLOC_FL_KEEP_SIZE, static_cast<off_t>(m_size), static_cast<off_t>(end - m_size)) == 0) {
+        m_reserved = end;
+        return;
+    }
+#endif
+    (void)end;
+    m_settings.preallocateBytes = 0; // Not supported here; stop trying
+}
+
+bool RotatingLogFile::write(const char* data, std::size_t size) {
+    if (m_fd < 0 || size == 0) {
+        return m_fd >= 0;
+    }
+    if (m_settings.preallocateBytes > 0 && m_size + size > m_reserved) {
+        reserve(m_size + size + m_settings.preallocateBytes);
+    }
+    std::size_t done = 0;
+    while (done < size) {
+        const ssize_t written = ::write(m_fd, data + done, size - done);
+        if (written <= 0) {
+            break;
+        }
+        done += static_cast<std::size_t>(written);
+    }
+    m_size += done;
+    return done == size;
+}
+
+#endif
+
+} // namespace openmeters::common
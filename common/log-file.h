@@ -0,0 +1,101 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <cstddef>
+#include <string>
+
+namespace openmeters::common {
+
+/**
+ * Size, age and retention limits of a log file, plus when buffered lines
+ * reach it.
+ */
+struct LogFileSettings {
+    std::uint64_t maxFileBytes = 8 * 1024 * 1024;   // Rotate once the active file would pass this (0: no limit)
+    std::chrono::seconds maxFileAge{24 * 60 * 60};  // Rotate once the active file is this old (0: no limit)
+    std::uint32_t maxRetainedFiles = 5;              // Rotated files kept next to the active one
+    std::uint64_t preallocateBytes = 1024 * 1024;   // Disk reserved ahead of the write position
+    std::chrono::milliseconds flushInterval{1000};   // Longest a line waits in memory (errors go at once)
+    std::size_t flushBytes = 64 * 1024;              // Write early once this much is buffered
+};
+
+/**
+ * Append-only log file with size- and time-based rotation.
+ *
+ * On rotation the active file "name.ext" becomes "name.1.ext", older files
+ * move up one number and anything past maxRetainedFiles is deleted, so the
+ * logs never take more than about (maxRetainedFiles + 1) * maxFileBytes.
+ *
+ * Disk space is reserved in preallocateBytes steps ahead of the write
+ * position without moving end-of-file (FileAllocationInfo on Windows,
+ * fallocate(KEEP_SIZE) on Linux), so appends rarely wait for the file
+ * system to find blocks and a crash never leaves a padded file. Each write()
+ * is one system call; callers batch lines themselves.
+ *
+ * Thread safety: Not thread-safe; the logger's writer thread owns it.
+ */
+class RotatingLogFile {
+public:
+    RotatingLogFile() = default;
+    ~RotatingLogFile() { close(); }
+
+    RotatingLogFile(const RotatingLogFile&) = delete;
+    RotatingLogFile& operator=(const RotatingLogFile&) = delete;
+
+    /**
+     * Open the active file.
+     *
+     * @param append Continue an existing file (otherwise it is rotated away first)
+     */
+    bool open(const std::string& path, const LogFileSettings& settings, bool append);
+
+    /**
+     * Release reserved space and close the file.
+     */
+    void close();
+
+    [[nodiscard]] bool isOpen() const noexcept;
+
+    /**
+     * Whether writing this many more bytes should go to a fresh file.
+     * An empty file never rotates, so oversized batches still get written.
+     */
+    [[nodiscard]] bool shouldRotate(std::size_t pendingBytes) const;
+
+    /**
+     * Close the active file, shift the retained files and start a new one.
+     */
+    bool rotate();
+
+    /**
+     * Append bytes with one system call.
+     */
+    bool write(const char* data, std::size_t size);
+
+    [[nodiscard]] std::uint64_t size() const noexcept { return m_size; }
+    [[nodiscard]] const LogFileSettings& settings() const noexcept { return m_settings; }
+
+    /**
+     * Name of the rotated file with this number ("logs/openmeters.2.log").
+     */
+    [[nodiscard]] static std::string rotatedPath(const std::string& path, std::uint32_t index);
+
+private:
+    bool openHandle(bool append);
+    void closeHandle();
+    void reserve(std::uint64_t end);
+
+    std::string m_path;
+    LogFileSettings m_settings;
+#ifdef _WIN32
+    void* m_handle = nullptr;  // HANDLE
+#else
+    int m_fd = -1;
+#endif
+    std::uint64_t m_size = 0;
+    std::uint64_t m_reserved = 0;
+    std::chrono::steady_clock::time_point m_openedAt;
+};
+
+} // namespace openmeters::common
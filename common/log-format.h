@@ -0,0 +1,326 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace openmeters::common {
+
+/**
+ * Deferred log formatting.
+ *
+ * LOG_* call sites pass a format string literal and arguments. The caller
+ * only copies the arguments into the log record as tagged binary values
+ * (LogArgWriter); the background writer renders the line later
+ * (formatLogMessage). The format string itself is never copied, since it is
+ * a literal with static lifetime.
+ *
+ * Syntax is the std::format subset the logs need:
+ *   {}       Any argument (floats in shortest round-trip form)
+ *   {:.Nf}   Floating point with N decimals (N = 0..9)
+ *   {:x}     Integer in hexadecimal
+ *   {{ }}    Literal braces
+ * At compile time the placeholder count must match the argument count, and
+ * each spec must suit its argument's type ({:x} takes an integer or enum,
+ * {:.Nf} a floating point value).
+ */
+
+enum class LogArgType : std::uint8_t {
+    Signed = 0,
+    Unsigned = 1,
+    Float = 2,
+    Bool = 3,
+    Char = 4,
+    String = 5,
+    Pointer = 6
+};
+
+namespace detail {
+
+/**
+ * Type tag LogArgWriter::add() records for an argument of type T.
+ */
+template <typename T>
+consteval LogArgType logArgTypeOf() {
+    using U = std::decay_t<T>;
+    if constexpr (std::is_same_v<U, bool>) {
+        return LogArgType::Bool;
+    } else if constexpr (std::is_same_v<U, char>) {
+        return LogArgType::Char;
+    } else if constexpr (std::is_enum_v<U>) {
+        return logArgTypeOf<std::underlying_type_t<U>>();
+    } else if constexpr (std::is_integral_v<U>) {
+        return std::is_signed_v<U> ? LogArgType::Signed : LogArgType::Unsigned;
+    } else if constexpr (std::is_floating_point_v<U>) {
+        return LogArgType::Float;
+    } else if constexpr (std::is_pointer_v<U> && std::is_same_v<std::remove_cv_t<std::remove_pointer_t<U>>, char>) {
+        return LogArgType::String;
+    } else if constexpr (std::is_pointer_v<U>) {
+        return LogArgType::Pointer;
+    } else {
+        return LogArgType::String; // std::string and std::string_view; anything else fails in add()
+    }
+}
+
+// Not constexpr: calling it from the consteval check makes a bad format a compile error
+void invalidLogFormatString();
+
+template <std::size_t N>
+consteval void checkLogFormat(std::string_view format, const std::array<LogArgType, N>& types) {
+    std::size_t placeholders = 0;
+    for (std::size_t i = 0; i < format.size(); ++i) {
+        const char c = format[i];
+        if (c == '}') {
+            if (i + 1 >= format.size() || format[i + 1] != '}') {
+                invalidLogFormatString(); // Unmatched '}'
+            }
+            ++i;
+            continue;
+        }
+        if (c != '{') {
+            continue;
+        }
+        if (i + 1 < format.size() && format[i + 1] == '{') {
+            ++i;
+            continue;
+        }
+        const std::size_t close = format.find('}', i);
+        if (close == std::string_view::npos) {
+            invalidLogFormatString(); // Unterminated placeholder
+        }
+        const std::string_view spec = format.substr(i + 1, close - i - 1);
+        const bool valid = spec.empty() || spec == ":x" ||
+            (spec.size() == 4 && spec[0] == ':' && spec[1] == '.' && spec[2] >= '0' && spec[2] <= '9' && spec[3] == 'f');
+        if (!valid) {
+            invalidLogFormatString(); // Unsupported spec
+        }
+        if (!spec.empty() && placeholders < N) {
+            const LogArgType type = types[placeholders];
+            const bool integer = type == LogArgType::Signed || type == LogArgType::Unsigned;
+            if (spec == ":x" ? !integer : type != LogArgType::Float) {
+                invalidLogFormatString(); // Spec does not suit the argument type
+            }
+        }
+        ++placeholders;
+        i = close;
+    }
+    if (placeholders != N) {
+        invalidLogFormatString(); // Placeholder count does not match the arguments
+    }
+}
+
+} // namespace detail
+
+/**
+ * Format string literal checked against its argument count and types at
+ * compile time (see checkLogFormat()).
+ */
+template <typename... Args>
+class LogFormatString {
+public:
+    template <std::size_t N>
+    consteval LogFormatString(const char (&text)[N]) : m_text(text) {
+        detail::checkLogFormat(std::string_view(text, N - 1), std::array<LogArgType, sizeof...(Args)>{detail::logArgTypeOf<Args>()...});
+    }
+
+    [[nodiscard]] constexpr const char* c_str() const noexcept { return m_text; }
+
+private:
+    const char* m_text;
+};
+
+/**
+ * Non-deduced alias so arguments alone determine Args.
+ */
+template <typename... Args>
+using LogFormat = LogFormatString<std::type_identity_t<Args>...>;
+
+/**
+ * Encodes log arguments into a fixed buffer: one type byte, then the value
+ * (8 bytes for numbers, a 1-byte length plus bytes for strings). Arguments
+ * that do not fit are dropped and reported through truncated().
+ */
+class LogArgWriter {
+public:
+    LogArgWriter(char* data, std::size_t capacity) noexcept : m_data(data), m_capacity(capacity) {}
+
+    void add(bool value) noexcept { putScalar(LogArgType::Bool, static_cast<std::uint64_t>(value)); }
+    void add(char value) noexcept { putScalar(LogArgType::Char, static_cast<std::uint64_t>(static_cast<unsigned char>(value))); }
+
+    template <typename T>
+        requires(std::is_integral_v<T> && !std::is_same_v<T, bool> && !std::is_same_v<T, char>)
+    void add(T value) noexcept {
+        if constexpr (std::is_signed_v<T>) {
+            const auto wide = static_cast<std::int64_t>(value);
+            std::uint64_t bits;
+            std::memcpy(&bits, &wide, sizeof(bits));
+            putScalar(LogArgType::Signed, bits);
+        } else {
+            putScalar(LogArgType::Unsigned, static_cast<std::uint64_t>(value));
+        }
+    }
+
+    template <typename T>
+        requires std::is_enum_v<T>
+    void add(T value) noexcept {
+        add(static_cast<std::underlying_type_t<T>>(value));
+    }
+
+    template <typename T>
+        requires std::is_floating_point_v<T>
+    void add(T value) noexcept {
+        const auto wide = static_cast<double>(value);
+        std::uint64_t bits;
+        std::memcpy(&bits, &wide, sizeof(bits));
+        putScalar(LogArgType::Float, bits);
+    }
+
+    void add(const char* value) noexcept { putString(value ? std::string_view(value) : std::string_view("(null)")); }
+    void add(std::string_view value) noexcept { putString(value); }
+    void add(const std::string& value) noexcept { putString(value); }
+
+    void add(const void* value) noexcept {
+        putScalar(LogArgType::Pointer, static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(value)));
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept { return m_size; }
+    [[nodiscard]] bool truncated() const noexcept { return m_truncated; }
+
+private:
+    void putScalar(LogArgType type, std::uint64_t bits) noexcept {
+        if (m_truncated || m_size + 1 + sizeof(bits) > m_capacity) {
+            m_truncated = true;
+            return;
+        }
+        m_data[m_size++] = static_cast<char>(type);
+        std::memcpy(m_data + m_size, &bits, sizeof(bits));
+        m_size += sizeof(bits);
+    }
+
+    void putString(std::string_view value) noexcept {
+        if (m_truncated || m_size + 2 > m_capacity) {
+            m_truncated = true;
+            return;
+        }
+        // Strings may be cut short; everything after them is then dropped
+        std::size_t length = value.size();
+        if (length > 255 || m_size + 2 + length > m_capacity) {
+            length = std::min<std::size_t>(255, m_capacity - m_size - 2);
+            m_truncated = true;
+        }
+        m_data[m_size++] = static_cast<char>(LogArgType::String);
+        m_data[m_size++] = static_cast<char>(static_cast<std::uint8_t>(length));
+        std::memcpy(m_data + m_size, value.data(), length);
+        m_size += length;
+    }
+
+    char* m_data;
+    std::size_t m_capacity;
+    std::size_t m_size = 0;
+    bool m_truncated = false;
+};
+
+namespace detail {
+
+inline void appendLogArgument(std::string& out, std::string_view spec, const char*& cursor, const char* end) {
+    if (cursor >= end) {
+        return; // Argument was truncated away
+    }
+    const auto type = static_cast<LogArgType>(*cursor++);
+    if (type == LogArgType::String) {
+        if (cursor >= end) {
+            return;
+        }
+        const std::size_t encoded = static_cast<std::uint8_t>(*cursor++);
+        const std::size_t length = std::min(encoded, static_cast<std::size_t>(end - cursor));
+        out.append(cursor, length);
+        cursor += length;
+        return;
+    }
+
+    std::uint64_t bits = 0;
+    if (end - cursor < static_cast<std::ptrdiff_t>(sizeof(bits))) {
+        cursor = end;
+        return;
+    }
+    std::memcpy(&bits, cursor, sizeof(bits));
+    cursor += sizeof(bits);
+
+    const bool hex = spec == ":x";
+    char buffer[64];
+    std::to_chars_result result{buffer, std::errc()};
+    switch (type) {
+        case LogArgType::Signed: {
+            std::int64_t value;
+            std::memcpy(&value, &bits, sizeof(value));
+            result = std::to_chars(buffer, buffer + sizeof(buffer), value, hex ? 16 : 10);
+            break;
+        }
+        case LogArgType::Unsigned:
+            result = std::to_chars(buffer, buffer + sizeof(buffer), bits, hex ? 16 : 10);
+            break;
+        case LogArgType::Float: {
+            double value;
+            std::memcpy(&value, &bits, sizeof(value));
+            if (spec.size() == 4) {
+                result = std::to_chars(buffer, buffer + sizeof(buffer), value, std::chars_format::fixed, spec[2] - '0');
+            } else {
+                result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+            }
+            if (result.ec != std::errc()) {
+                out += "?";
+                return;
+            }
+            break;
+        }
+        case LogArgType::Bool:
+            out += bits ? "true" : "false";
+            return;
+        case LogArgType::Char:
+            out += static_cast<char>(bits);
+            return;
+        case LogArgType::Pointer:
+            out += "0x";
+            result = std::to_chars(buffer, buffer + sizeof(buffer), bits, 16);
+            break;
+        default:
+            cursor = end; // Unknown type: cannot find the next argument
+            return;
+    }
+    out.append(buffer, result.ptr);
+}
+
+} // namespace detail
+
+/**
+ * Render a format string with arguments encoded by LogArgWriter.
+ */
+inline void formatLogMessage(std::string& out, std::string_view format, const char* arguments, std::size_t size) {
+    const char* cursor = arguments;
+    const char* const end = arguments + size;
+    for (std::size_t i = 0; i < format.size(); ++i) {
+        const char c = format[i];
+        if ((c == '{' || c == '}') && i + 1 < format.size() && format[i + 1] == c) {
+            out += c;
+            ++i;
+        } else if (c == '{') {
+            const std::size_t close = format.find('}', i);
+            if (close == std::string_view::npos) {
+                out.append(format.substr(i));
+                return;
+            }
+            detail::appendLogArgument(out, format.substr(i + 1, close - i - 1), cursor, end);
+            i = close;
+        } else {
+            out += c;
+        }
+    }
+}
+
+} // namespace openmeters::common
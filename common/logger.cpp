@@ -1,50 +1,386 @@
 #include "logger.h"
-#include <iostream>
-#include <filesystem>
+#include "binary-log.h"
+#include "log-file.h"
+#include "mpsc-queue.h"
+#include "spsc-queue.h"
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 namespace openmeters::common {
 
-std::unique_ptr<std::ofstream> Logger::s_logFile = nullptr;
-std::recursive_mutex Logger::s_logMutex;
-LogLevel Logger::s_minLevel = LogLevel::Info;
-bool Logger::s_consoleEnabled = true;
-bool Logger::s_initialized = false;
+namespace {
+
+constexpr std::size_t kQueueCapacity = 2048;                    // 512 KiB of records
+constexpr std::size_t kRealtimeRingCapacity = 256;              // 64 KiB per real-time thread
+constexpr auto kDrainInterval = std::chrono::milliseconds(100); // Queue and console latency; LogFileSettings decide disk writes
+
+/**
+ * Wait-free log ring owned by one real-time thread.
+ */
+struct RealtimeChannel {
+    const char* threadName = "";
+    SpscQueue<LogRecord, kRealtimeRingCapacity> ring;
+    std::atomic<std::uint64_t> dropped{0};
+    std::atomic<bool> retired{false};  // Thread is gone; free once drained
+    std::uint64_t reportedDropped = 0; // Writer thread only
+};
+
+thread_local RealtimeChannel* t_realtimeChannel = nullptr;
+
+/**
+ * Asynchronous backend: the record queue, the real-time rings and the
+ * writer thread that drains them.
+ */
+struct Backend {
+    MpscQueue<LogRecord, kQueueCapacity> queue;
+    std::atomic<bool> initialized{false};
+    std::atomic<std::uint64_t> dropped{0};
+    std::atomic<std::uint64_t> unregisteredDropped{0}; // LOG_RT_* from threads without a ring
+    std::atomic<std::uint64_t> retiredDropped{0};      // Drops counted by rings already freed
+    std::atomic<std::uint32_t> nextThreadId{1};
+    
+    std::mutex channelsMutex;          // Never taken by real-time threads while logging
+    std::vector<std::unique_ptr<RealtimeChannel>> channels;
+    
+    // Owned by the writer thread while it runs
+    RotatingLogFile file;
+    BinaryLogWriter binary;
+    std::chrono::steady_clock::time_point lastWrite;
+    bool consoleEnabled = true;
+    std::uint8_t textMinLevel = 0;     // Warning when the binary log takes everything
+    LogLineFormatter formatter;
+    std::vector<LogRecord> batch;
+    std::string fileBuffer;
+    std::string consoleBuffer;
+    std::string errorBuffer;
+    std::uint64_t reportedDropped = 0;
+    
+    std::thread writer;
+    std::mutex mutex;                  // Guards the flags below and the lifecycle
+    std::condition_variable wake;
+    std::condition_variable drained;
+    bool running = false;
+    bool wakeRequested = false;
+    std::uint64_t drainsStarted = 0;
+    std::uint64_t drainsFinished = 0;
+    
+    std::mutex fallbackMutex;
+    
+    ~Backend() {
+        // Logger::shutdown() was skipped: still write out what is queued
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            running = false;
+        }
+        wake.notify_one();
+        if (writer.joinable()) {
+            writer.join();
+        }
+    }
+};
+
+Backend& backend() {
+    static Backend instance;
+    return instance;
+}
+
+const char* levelToString(LogLevel level) {
+    switch (level) {
+        case LogLevel::Debug:   return "DEBUG";
+        case LogLevel::Info:    return "INFO ";
+        case LogLevel::Warning: return "WARN ";
+        case LogLevel::Error:   return "ERROR";
+        case LogLevel::Fatal:   return "FATAL";
+        default:                 return "UNKNOWN";
+    }
+}
+
+std::uint32_t currentThreadId() {
+    thread_local const std::uint32_t id = backend().nextThreadId.fetch_add(1, std::memory_order_relaxed);
+    return id;
+}
+
+void reportDropped(Backend& b, std::uint64_t count, const char* where) {
+    LogLineFormatter::appendDropped(b.fileBuffer, count, where);
+    if (b.binary.isOpen()) {
+        b.binary.appendDropped(count, where);
+    }
+}
+
+/**
+ * Collect everything queued, merge it by time and format it. Console lines
+ * go out every drain; file lines stay buffered until an error, a flush(),
+ * the flush interval or the size threshold, then go out in one write.
+ */
+void drainQueue(Backend& b, bool force) {
+    LogRecord record;
+    while (b.queue.tryPop(record)) {
+        b.batch.push_back(record);
+    }
+    
+    {
+        std::lock_guard<std::mutex> lock(b.channelsMutex);
+        for (auto& channel : b.channels) {
+            while (channel->ring.tryPop(record)) {
+                b.batch.push_back(record);
+            }
+            const std::uint64_t dropped = channel->dropped.load(std::memory_order_relaxed);
+            if (dropped != channel->reportedDropped) {
+                reportDropped(b, dropped - channel->reportedDropped, channel->threadName);
+                channel->reportedDropped = dropped;
+            }
+        }
+        
+        // A retired ring gets no new records, so once empty it can go
+        b.channels.erase(std::remove_if(b.channels.begin(), b.channels.end(), [&b](const auto& channel) {
+            if (!channel->retired.load(std::memory_order_acquire) || !channel->ring.empty()) {
+                return false;
+            }
+            b.retiredDropped.fetch_add(channel->dropped.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            return true;
+        }), b.channels.end());
+    }
+    
+    // Real-time records arrive per thread; restore global time order
+    std::stable_sort(b.batch.begin(), b.batch.end(), [](const LogRecord& lhs, const LogRecord& rhs) {
+        return lhs.timestampTicks < rhs.timestampTicks;
+    });
+    bool urgent = force;
+    for (const LogRecord& entry : b.batch) {
+        urgent = urgent || entry.level >= static_cast<std::uint8_t>(LogLevel::Error);
+        if (b.binary.isOpen()) {
+            b.binary.append(entry);
+        }
+        if (entry.level < b.textMinLevel) {
+            continue;
+        }
+        const std::size_t start = b.fileBuffer.size();
+        b.formatter.append(b.fileBuffer, entry);
+        if (b.consoleEnabled) {
+            std::string& console = entry.level >= static_cast<std::uint8_t>(LogLevel::Error) ? b.errorBuffer : b.consoleBuffer;
+            console.append(b.fileBuffer, start, std::string::npos);
+        }
+    }
+    b.batch.clear();
+    
+    const std::uint64_t dropped = b.dropped.load(std::memory_order_relaxed);
+    if (dropped != b.reportedDropped) {
+        reportDropped(b, dropped - b.reportedDropped, "queue full");
+        b.reportedDropped = dropped;
+    }
+    
+    const LogFileSettings& settings = b.file.settings();
+    const auto now = std::chrono::steady_clock::now();
+    if (urgent || now - b.lastWrite >= settings.flushInterval ||
+        b.fileBuffer.size() >= settings.flushBytes || b.binary.bufferedBytes() >= settings.flushBytes) {
+        if (!b.fileBuffer.empty() && b.file.isOpen()) {
+            if (b.file.shouldRotate(b.fileBuffer.size())) {
+                b.file.rotate();
+            }
+            b.file.write(b.fileBuffer.data(), b.fileBuffer.size());
+        }
+        b.fileBuffer.clear();
+        b.binary.write();
+        b.lastWrite = now;
+    }
+    if (!b.consoleBuffer.empty()) {
+        std::cout.write(b.consoleBuffer.data(), static_cast<std::streamsize>(b.consoleBuffer.size()));
+        std::cout.flush();
+    }
+    if (!b.errorBuffer.empty()) {
+        std::cerr.write(b.errorBuffer.data(), static_cast<std::streamsize>(b.errorBuffer.size()));
+    }
+    b.consoleBuffer.clear();
+    b.errorBuffer.clear();
+}
+
+void writerLoop() {
+    Backend& b = backend();
+    std::unique_lock<std::mutex> lock(b.mutex);
+    while (b.running) {
+        b.wake.wait_for(lock, kDrainInterval, [&b] { return b.wakeRequested || !b.running; });
+        const bool requested = b.wakeRequested || !b.running;
+        b.wakeRequested = false;
+        ++b.drainsStarted;
+        
+        lock.unlock();
+        drainQueue(b, requested);
+        lock.lock();
+        ++b.drainsFinished;
+        b.drained.notify_all();
+    }
+    
+    lock.unlock();
+    drainQueue(b, true);
+    lock.lock();
+    b.drained.notify_all();
+}
+
+void requestWrite(Backend& b) {
+    {
+        std::lock_guard<std::mutex> lock(b.mutex);
+        b.wakeRequested = true;
+    }
+    b.wake.notify_one();
+}
+
+// Errors are written at once; fatal messages must be on disk before we return
+void wakeWriter(Backend& b, LogLevel level) {
+    if (level == LogLevel::Fatal) {
+        Logger::flush();
+    } else if (level >= LogLevel::Error) {
+        requestWrite(b);
+    }
+}
+
+} // namespace
+
+// LogClock
+
+LogClock LogClock::calibrate() {
+    using Period = std::chrono::steady_clock::period;
+    static_assert(Period::num <= UINT32_MAX && Period::den <= UINT32_MAX, "Steady clock period does not fit the log header");
+    
+    LogClock clock;
+    clock.tickNumerator = static_cast<std::uint32_t>(Period::num);
+    clock.tickDenominator = static_cast<std::uint32_t>(Period::den);
+    clock.baseTicks = ticks();
+    clock.baseSystemUs = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::system_clock::now().time_since_epoch()
+    ).count();
+    return clock;
+}
+
+std::int64_t LogClock::toSystemUs(std::int64_t ticks) const noexcept {
+    // Long double keeps nanosecond ticks exact over any realistic uptime
+    const long double elapsed = static_cast<long double>(ticks - baseTicks) * tickNumerator * 1000000.0L / tickDenominator;
+    return baseSystemUs + static_cast<std::int64_t>(elapsed);
+}
+
+// LogLineFormatter
+
+/**
+ * Append "[YYYY-MM-DD HH:MM:SS.mmm]".
+ */
+void LogLineFormatter::appendTimestamp(std::string& out, std::int64_t ticks) {
+    const std::int64_t timestampUs = m_clock.toSystemUs(ticks);
+    const std::time_t second = static_cast<std::time_t>(timestampUs / 1000000);
+    if (second != m_cachedSecond) {
+        m_cachedSecond = second;
+        std::strftime(m_cachedTime, sizeof(m_cachedTime), "%Y-%m-%d %H:%M:%S", std::localtime(&second));
+    }
+    const int millis = static_cast<int>((timestampUs / 1000) % 1000);
+    out += '[';
+    out += m_cachedTime;
+    out += '.';
+    out += static_cast<char>('0' + millis / 100);
+    out += static_cast<char>('0' + millis / 10 % 10);
+    out += static_cast<char>('0' + millis % 10);
+    out += ']';
+}
+
+/**
+ * Format: [TIMESTAMP] [LEVEL] [FILE:LINE] MESSAGE
+ */
+void LogLineFormatter::append(std::string& out, const LogRecord& record) {
+    appendTimestamp(out, record.timestampTicks);
+    out += " [";
+    out += levelToString(static_cast<LogLevel>(record.level));
+    out += ']';
+    
+    if (record.file) {
+        // Extract just filename from path
+        const char* filename = record.file;
+        for (const char* c = record.file; *c; ++c) {
+            if (*c == '/' || *c == '\\') {
+                filename = c + 1;
+            }
+        }
+        out += " [";
+        out += filename;
+        if (record.line > 0) {
+            out += ':';
+            out += std::to_string(record.line);
+        }
+        out += ']';
+    }
+    
+    out += ' ';
+    if (record.format) {
+        formatLogMessage(out, record.format, record.text, record.length);
+    } else {
+        out.append(record.text, record.length);
+    }
+    if (record.truncated) {
+        out += "...";
+    }
+    out += '\n';
+}
+
+void LogLineFormatter::appendDropped(std::string& out, std::uint64_t count, std::string_view where) {
+    out += "[LOGGER] ";
+    out += std::to_string(count);
+    out += " log records dropped (";
+    out += where;
+    out += ")\n";
+}
 
 bool Logger::initialize(
     const std::string& logFilePath,
     LogLevel minLevel,
-    bool enableConsole
+    bool enableConsole,
+    const std::string& binaryLogPath,
+    const LogFileSettings& fileSettings
 ) {
-    std::lock_guard<std::recursive_mutex> lock(s_logMutex);
+    Backend& b = backend();
+    std::unique_lock<std::mutex> lock(b.mutex);
     
-    if (s_initialized) {
+    if (b.initialized.load()) {
         return true; // Already initialized
     }
     
-    s_minLevel = minLevel;
-    s_consoleEnabled = enableConsole;
+    s_minLevel.store(static_cast<int>(minLevel));
+    b.consoleEnabled = enableConsole;
     
-    // Create log directory if it doesn't exist
-    try {
-        std::filesystem::path logPath(logFilePath);
-        auto logDir = logPath.parent_path();
-        if (!logDir.empty() && !std::filesystem::exists(logDir)) {
-            std::filesystem::create_directories(logDir);
-        }
-    } catch (const std::exception& e) {
-        std::cerr << "Failed to create log directory: " << e.what() << std::endl;
+    // Open log file (creates the directory; rotates a full or stale file away)
+    if (!b.file.open(logFilePath, fileSettings, true)) {
+        std::cerr << "Failed to open log file: " << logFilePath << std::endl;
         return false;
     }
+    b.lastWrite = std::chrono::steady_clock::now();
     
-    // Open log file
-    s_logFile = std::make_unique<std::ofstream>(logFilePath, std::ios::app);
-    if (!s_logFile->is_open()) {
-        std::cerr << "Failed to open log file: " << logFilePath << std::endl;
-        return false;
+    // Ticks are converted back to wall time with one pairing of the two clocks
+    const LogClock clock = LogClock::calibrate();
+    b.formatter.setClock(clock);
+    b.textMinLevel = 0;
+    if (!binaryLogPath.empty()) {
+        if (b.binary.open(binaryLogPath, clock, fileSettings)) {
+            b.textMinLevel = static_cast<std::uint8_t>(LogLevel::Warning);
+        } else {
+            std::cerr << "Failed to open binary log file: " << binaryLogPath << std::endl;
+        }
     }
     
-    s_initialized = true;
+    // Reserve once so steady-state batches do not allocate
+    b.batch.reserve(kQueueCapacity);
+    b.fileBuffer.reserve(64 * 1024);
+    b.consoleBuffer.reserve(64 * 1024);
+    b.errorBuffer.reserve(4 * 1024);
+    
+    b.running = true;
+    b.writer = std::thread(writerLoop);
+    b.initialized.store(true);
+    lock.unlock();
     
     // Log initialization
     info("Logger initialized - Log file: " + logFilePath);
@@ -53,15 +389,25 @@ bool Logger::initialize(
 }
 
 void Logger::shutdown() {
-    std::lock_guard<std::recursive_mutex> lock(s_logMutex);
+    Backend& b = backend();
+    if (!b.initialized.load()) {
+        return;
+    }
+    
+    info("Logger shutting down");
     
-    if (s_initialized && s_logFile) {
-        info("Logger shutting down");
-        s_logFile->flush();
-        s_logFile->close();
-        s_logFile.reset();
-        s_initialized = false;
+    {
+        std::lock_guard<std::mutex> lock(b.mutex);
+        b.initialized.store(false);
+        b.running = false;
     }
+    b.wake.notify_one();
+    if (b.writer.joinable()) {
+        b.writer.join();
+    }
+    
+    b.file.close();
+    b.binary.close();
 }
 
 void Logger::log(
@@ -70,11 +416,62 @@ void Logger::log(
     const char* file,
     int line
 ) {
-    if (level < s_minLevel) {
+    if (!isEnabled(level)) {
         return; // Below minimum level
     }
     
-    writeLog(level, message, file, line);
+    const bool truncated = message.size() > LogRecord::kMaxMessage;
+    const auto length = static_cast<std::uint16_t>(std::min(message.size(), LogRecord::kMaxMessage));
+    
+    Backend& b = backend();
+    if (!b.initialized.load(std::memory_order_acquire)) {
+        LogRecord record;
+        record.truncated = truncated;
+        record.length = length;
+        std::memcpy(record.text, message.data(), length);
+        submit(level, file, line, record);
+        return;
+    }
+    
+    // The message is copied straight into the queue slot rather than staged
+    // in a record on the stack. Slots are reused, so every field is written.
+    const std::int64_t ticks = LogClock::ticks();
+    const std::uint32_t threadId = currentThreadId();
+    const bool queued = b.queue.tryPushWith([&](LogRecord& record) {
+        record.timestampTicks = ticks;
+        record.file = file;
+        record.format = nullptr;
+        record.line = line;
+        record.threadId = threadId;
+        record.length = length;
+        record.level = static_cast<std::uint8_t>(level);
+        record.truncated = truncated;
+        std::memcpy(record.text, message.data(), length);
+    });
+    if (!queued) {
+        b.dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+    wakeWriter(b, level);
+}
+
+void Logger::submit(LogLevel level, const char* file, int line, LogRecord& record) {
+    Backend& b = backend();
+    record.file = file;
+    record.line = line;
+    record.level = static_cast<std::uint8_t>(level);
+    
+    if (!b.initialized.load(std::memory_order_acquire)) {
+        writeFallback(level, record);
+        return;
+    }
+    
+    // The only work on the caller's thread: one clock read and one record copy
+    record.timestampTicks = LogClock::ticks();
+    record.threadId = currentThreadId();
+    if (!b.queue.tryPush(record)) {
+        b.dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+    wakeWriter(b, level);
 }
 
 void Logger::debug(const std::string& message, const char* file, int line) {
@@ -97,95 +494,90 @@ void Logger::fatal(const std::string& message, const char* file, int line) {
     log(LogLevel::Fatal, message, file, line);
 }
 
-void Logger::setMinLevel(LogLevel level) {
-    std::lock_guard<std::recursive_mutex> lock(s_logMutex);
-    s_minLevel = level;
+void Logger::flush() {
+    Backend& b = backend();
+    std::unique_lock<std::mutex> lock(b.mutex);
+    if (!b.running) {
+        return;
+    }
+    
+    // A drain that starts after this point sees everything logged before it
+    const std::uint64_t target = b.drainsStarted + 1;
+    b.wakeRequested = true;
+    b.wake.notify_one();
+    b.drained.wait(lock, [&b, target] { return !b.running || b.drainsFinished >= target; });
 }
 
-LogLevel Logger::getMinLevel() {
-    std::lock_guard<std::recursive_mutex> lock(s_logMutex);
-    return s_minLevel;
+std::uint64_t Logger::droppedRecords() {
+    Backend& b = backend();
+    std::uint64_t total = b.dropped.load(std::memory_order_relaxed) +
+                          b.unregisteredDropped.load(std::memory_order_relaxed) +
+                          b.retiredDropped.load(std::memory_order_relaxed);
+    std::lock_guard<std::mutex> lock(b.channelsMutex);
+    for (const auto& channel : b.channels) {
+        total += channel->dropped.load(std::memory_order_relaxed);
+    }
+    return total;
 }
 
-void Logger::writeLog(
-    LogLevel level,
-    const std::string& message,
-    const char* file,
-    int line
-) {
-    std::lock_guard<std::recursive_mutex> lock(s_logMutex);
-    
-    if (!s_initialized) {
-        // Fallback to console if logger not initialized
-        std::cerr << "[FALLBACK] " << levelToString(level) << ": " << message << std::endl;
+void Logger::registerRealtimeThread(const char* threadName) {
+    if (t_realtimeChannel) {
         return;
     }
+    auto channel = std::make_unique<RealtimeChannel>();
+    channel->threadName = threadName ? threadName : "";
+    t_realtimeChannel = channel.get();
     
-    std::string timestamp = getTimestamp();
-    std::string levelStr = levelToString(level);
-    
-    // Format: [TIMESTAMP] [LEVEL] [FILE:LINE] MESSAGE
-    std::ostringstream logLine;
-    logLine << "[" << timestamp << "] [" << levelStr << "]";
-    
-    if (file) {
-        // Extract just filename from path
-        std::string filename = file;
-        size_t lastSlash = filename.find_last_of("/\\");
-        if (lastSlash != std::string::npos) {
-            filename = filename.substr(lastSlash + 1);
-        }
-        logLine << " [" << filename;
-        if (line > 0) {
-            logLine << ":" << line;
-        }
-        logLine << "]";
+    Backend& b = backend();
+    std::lock_guard<std::mutex> lock(b.channelsMutex);
+    b.channels.push_back(std::move(channel));
+}
+
+void Logger::unregisterRealtimeThread() {
+    if (t_realtimeChannel) {
+        t_realtimeChannel->retired.store(true, std::memory_order_release);
+        t_realtimeChannel = nullptr;
     }
-    
-    logLine << " " << message << std::endl;
-    
-    std::string logEntry = logLine.str();
-    
-    // Write to file
-    if (s_logFile && s_logFile->is_open()) {
-        *s_logFile << logEntry;
-        s_logFile->flush();
+}
+
+void Logger::submitRealtime(LogLevel level, const char* file, int line, LogRecord& record) noexcept {
+    RealtimeChannel* channel = t_realtimeChannel;
+    if (!channel) {
+        backend().unregisteredDropped.fetch_add(1, std::memory_order_relaxed);
+        return;
     }
     
-    // Write to console
-    if (s_consoleEnabled) {
-        if (level >= LogLevel::Error) {
-            std::cerr << logEntry;
-        } else {
-            std::cout << logEntry;
-        }
+    record.timestampTicks = LogClock::ticks();
+    record.file = file;
+    record.line = line;
+    record.threadId = currentThreadId();
+    record.level = static_cast<std::uint8_t>(level);
+    
+    // No wake-up: a real-time thread must not touch the writer's mutex
+    if (!channel->ring.tryPush(record)) {
+        channel->dropped.fetch_add(1, std::memory_order_relaxed);
     }
 }
 
-std::string Logger::levelToString(LogLevel level) {
-    switch (level) {
-        case LogLevel::Debug:   return "DEBUG";
-        case LogLevel::Info:    return "INFO ";
-        case LogLevel::Warning: return "WARN ";
-        case LogLevel::Error:   return "ERROR";
-        case LogLevel::Fatal:   return "FATAL";
-        default:                 return "UNKNOWN";
-    }
+void Logger::setMinLevel(LogLevel level) {
+    s_minLevel.store(static_cast<int>(level));
 }
 
-std::string Logger::getTimestamp() {
-    auto now = std::chrono::system_clock::now();
-    auto time = std::chrono::system_clock::to_time_t(now);
-    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
-        now.time_since_epoch()
-    ) % 1000;
-    
-    std::ostringstream oss;
-    oss << std::put_time(std::localtime(&time), "%Y-%m-%d %H:%M:%S");
-    oss << "." << std::setfill('0') << std::setw(3) << ms.count();
+LogLevel Logger::getMinLevel() {
+    return static_cast<LogLevel>(s_minLevel.load());
+}
+
+void Logger::writeFallback(LogLevel level, const LogRecord& record) {
+    std::string message;
+    if (record.format) {
+        formatLogMessage(message, record.format, record.text, record.length);
+    } else {
+        message.assign(record.text, record.length);
+    }
     
-    return oss.str();
+    // Fallback to console if logger not initialized
+    std::lock_guard<std::mutex> lock(backend().fallbackMutex);
+    std::cerr << "[FALLBACK] " << levelToString(level) << ": " << message << std::endl;
 }
 
 } // namespace openmeters::common
-
@@ -1,12 +1,26 @@
 #pragma once
 
-#include <string>
-#include <fstream>
-#include <mutex>
-#include <memory>
+#include "log-format.h"
+#include "log-file.h"
+#include <atomic>
 #include <chrono>
-#include <iomanip>
-#include <sstream>
+#include <ctime>
+#include <string>
+#include <string_view>
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * Levels below this are compiled out of LOG_* call sites entirely
+ * (0 = Debug ... 4 = Fatal). Defaults to Info in release builds.
+ */
+#ifndef OPENMETERS_LOG_COMPILED_LEVEL
+#ifdef NDEBUG
+#define OPENMETERS_LOG_COMPILED_LEVEL 1
+#else
+#define OPENMETERS_LOG_COMPILED_LEVEL 0
+#endif
+#endif
 
 namespace openmeters::common {
 
@@ -22,8 +36,103 @@ enum class LogLevel {
 };
 
 /**
- * Simple file-based logger with console output.
- * Thread-safe logging system for production use.
+ * One queued log line. Fixed size so records can live in a preallocated
+ * queue; longer messages are truncated.
+ * 
+ * With a format, text holds the arguments encoded by LogArgWriter and the
+ * line is rendered by the writer thread; otherwise text is the message.
+ */
+struct LogRecord {
+    static constexpr std::size_t kMaxMessage = 220;
+    
+    std::int64_t timestampTicks = 0; // Raw steady-clock ticks (see LogClock)
+    const char* file = nullptr;    // __FILE__ literal (static lifetime)
+    const char* format = nullptr;  // Format string literal, or nullptr for a plain message
+    std::int32_t line = 0;
+    std::uint32_t threadId = 0;    // Small per-process thread number
+    std::uint16_t length = 0;
+    std::uint8_t level = 0;        // LogLevel
+    bool truncated = false;
+    char text[kMaxMessage];
+};
+
+/**
+ * Time base for LogRecord timestamps.
+ * 
+ * Callers stamp records with the raw steady clock (QueryPerformanceCounter
+ * on Windows), which is cheaper than the system clock and never jumps. One
+ * pairing of a tick reading with the system clock, taken when the log is
+ * opened, converts ticks back to wall time when lines are rendered.
+ */
+struct LogClock {
+    std::int64_t baseTicks = 0;
+    std::int64_t baseSystemUs = 0;      // System clock at baseTicks, microseconds since the epoch
+    std::uint32_t tickNumerator = 1;    // Seconds per tick = numerator / denominator
+    std::uint32_t tickDenominator = 1000000;
+    
+    [[nodiscard]] static std::int64_t ticks() noexcept {
+        return std::chrono::steady_clock::now().time_since_epoch().count();
+    }
+    
+    /**
+     * Pair the steady clock with the system clock now.
+     */
+    [[nodiscard]] static LogClock calibrate();
+    
+    [[nodiscard]] std::int64_t toSystemUs(std::int64_t ticks) const noexcept;
+};
+
+/**
+ * Renders records as "[TIMESTAMP] [LEVEL] [FILE:LINE] MESSAGE" lines.
+ * Shared by the logger's text sinks and the binary log decoder.
+ */
+class LogLineFormatter {
+public:
+    explicit LogLineFormatter(const LogClock& clock = LogClock{}) : m_clock(clock) {}
+    
+    void setClock(const LogClock& clock) { m_clock = clock; }
+    [[nodiscard]] const LogClock& clock() const noexcept { return m_clock; }
+    
+    /**
+     * Append one line, newline included.
+     */
+    void append(std::string& out, const LogRecord& record);
+    
+    /**
+     * Append the note written when records had to be dropped.
+     */
+    static void appendDropped(std::string& out, std::uint64_t count, std::string_view where);
+
+private:
+    void appendTimestamp(std::string& out, std::int64_t ticks);
+    
+    LogClock m_clock;
+    std::time_t m_cachedSecond = -1;   // localtime() runs once per second of log time
+    char m_cachedTime[32] = {};
+};
+
+/**
+ * File-based logger with console output and an asynchronous backend.
+ * 
+ * LOG_* macros check the level before evaluating their arguments, and levels
+ * below OPENMETERS_LOG_COMPILED_LEVEL are not compiled in at all. Callers
+ * only copy the format arguments into a fixed-size record (see
+ * log-format.h) and enqueue it on a lock-free multi-producer queue; they never format timestamps, take a
+ * lock or touch the disk. One background thread drains the queue, formats
+ * lines into a reused buffer and writes them out in batches: at once for
+ * errors, otherwise on the flush interval or once enough has built up (see
+ * LogFileSettings). Fatal messages wait until they are on disk. The file
+ * rotates by size and age and only a fixed number of old files are kept.
+ * Real-time threads use LOG_RT_* instead, which write into a wait-free ring
+ * of their own (see RealtimeLogScope) and never wake the writer.
+ * If the queue is full, records are dropped and counted rather than
+ * blocking the caller.
+ * 
+ * With a binary log (see binary-log.h) every record is also written
+ * unformatted: format-string ids, raw ticks and the encoded arguments, for
+ * openmeters-logcat to render later. The text file and console then only
+ * get warnings and errors, so verbose levels cost a record copy and a few
+ * dozen bytes of disk each.
  * 
  * Thread safety: All logging operations are thread-safe.
  */
@@ -35,12 +144,16 @@ public:
      * @param logFilePath Path to log file (e.g., "logs/openmeters.log")
      * @param minLevel Minimum log level to write (default: Info)
      * @param enableConsole Also write to console (default: true)
+     * @param binaryLogPath Also write every record to this binary log (default: none)
+     * @param fileSettings Rotation, retention and flush policy for both files
      * @return true if initialization succeeded, false otherwise
      */
     static bool initialize(
         const std::string& logFilePath,
         LogLevel minLevel = LogLevel::Info,
-        bool enableConsole = true
+        bool enableConsole = true,
+        const std::string& binaryLogPath = {},
+        const LogFileSettings& fileSettings = {}
     );
     
     /**
@@ -63,6 +176,60 @@ public:
         int line = 0
     );
     
+    /**
+     * Log a formatted message; formatting happens on the writer thread.
+     * Use through the LOG_* macros.
+     */
+    template <typename... Args>
+    static void logFormat(LogLevel level, const char* file, int line, LogFormat<Args...> format, const Args&... args) {
+        LogRecord record;
+        LogArgWriter writer(record.text, LogRecord::kMaxMessage);
+        (writer.add(args), ...);
+        record.format = format.c_str();
+        record.length = static_cast<std::uint16_t>(writer.size());
+        record.truncated = writer.truncated();
+        submit(level, file, line, record);
+    }
+    
+    /**
+     * Log from a real-time thread registered with RealtimeLogScope.
+     * Wait-free: the record goes into the thread's own ring, and is dropped
+     * and counted if the ring is full or the thread is not registered.
+     * Use through the LOG_RT_* macros.
+     */
+    template <typename... Args>
+    static void logRealtime(LogLevel level, const char* file, int line, LogFormat<Args...> format, const Args&... args) noexcept {
+        static_assert((std::is_trivially_copyable_v<Args> && ...),
+                      "Real-time log arguments must be plain values (numbers, enums, pointers, string literals)");
+        LogRecord record;
+        LogArgWriter writer(record.text, LogRecord::kMaxMessage);
+        (writer.add(args), ...);
+        record.format = format.c_str();
+        record.length = static_cast<std::uint16_t>(writer.size());
+        record.truncated = writer.truncated();
+        submitRealtime(level, file, line, record);
+    }
+    
+    /**
+     * Give the calling thread a wait-free log ring. Allocates; call once when
+     * the thread starts, before it enters its real-time loop.
+     * 
+     * @param threadName Shown when records from this thread are dropped (static lifetime)
+     */
+    static void registerRealtimeThread(const char* threadName);
+    
+    /**
+     * Release the calling thread's ring once the writer has drained it.
+     */
+    static void unregisterRealtimeThread();
+    
+    /**
+     * Whether messages at this level are currently written.
+     */
+    [[nodiscard]] static bool isEnabled(LogLevel level) noexcept {
+        return static_cast<int>(level) >= s_minLevel.load(std::memory_order_relaxed);
+    }
+    
     /**
      * Log a debug message.
      */
@@ -88,6 +255,16 @@ public:
      */
     static void fatal(const std::string& message, const char* file = nullptr, int line = 0);
     
+    /**
+     * Block until everything logged before this call has been written.
+     */
+    static void flush();
+    
+    /**
+     * Records dropped because the queue or a real-time ring was full.
+     */
+    static std::uint64_t droppedRecords();
+    
     /**
      * Set minimum log level.
      * Messages below this level will be ignored.
@@ -103,29 +280,60 @@ private:
     Logger() = default;
     ~Logger() = default;
     
-    static void writeLog(
-        LogLevel level,
-        const std::string& message,
-        const char* file,
-        int line
-    );
+    /**
+     * Stamp and enqueue a filled record (or print it if not initialized).
+     */
+    static void submit(LogLevel level, const char* file, int line, LogRecord& record);
     
-    static std::string levelToString(LogLevel level);
-    static std::string getTimestamp();
+    static void submitRealtime(LogLevel level, const char* file, int line, LogRecord& record) noexcept;
     
-    static std::unique_ptr<std::ofstream> s_logFile;
-    static std::recursive_mutex s_logMutex;
-    static LogLevel s_minLevel;
-    static bool s_consoleEnabled;
-    static bool s_initialized;
+    static void writeFallback(LogLevel level, const LogRecord& record);
+    
+    inline static std::atomic<int> s_minLevel{static_cast<int>(LogLevel::Info)};
 };
 
-// Convenience macros
-#define LOG_DEBUG(msg) openmeters::common::Logger::debug(msg, __FILE__, __LINE__)
-#define LOG_INFO(msg) openmeters::common::Logger::info(msg, __FILE__, __LINE__)
-#define LOG_WARNING(msg) openmeters::common::Logger::warning(msg, __FILE__, __LINE__)
-#define LOG_ERROR(msg) openmeters::common::Logger::error(msg, __FILE__, __LINE__)
-#define LOG_FATAL(msg) openmeters::common::Logger::fatal(msg, __FILE__, __LINE__)
+/**
+ * Registers the current thread for LOG_RT_* for the lifetime of the scope.
+ */
+class RealtimeLogScope {
+public:
+    explicit RealtimeLogScope(const char* threadName) { Logger::registerRealtimeThread(threadName); }
+    ~RealtimeLogScope() { Logger::unregisterRealtimeThread(); }
+    
+    RealtimeLogScope(const RealtimeLogScope&) = delete;
+    RealtimeLogScope& operator=(const RealtimeLogScope&) = delete;
+};
 
-} // namespace openmeters::common
+// Convenience macros: LOG_INFO("Loaded {} plugins from {}", count, path)
+// Arguments are only evaluated if the level is enabled.
+#define OPENMETERS_LOG(level, ...) \
+    do { \
+        if constexpr (static_cast<int>(level) >= OPENMETERS_LOG_COMPILED_LEVEL) { \
+            if (openmeters::common::Logger::isEnabled(level)) { \
+                openmeters::common::Logger::logFormat(level, __FILE__, __LINE__, __VA_ARGS__); \
+            } \
+        } \
+    } while (false)
 
+#define LOG_DEBUG(...) OPENMETERS_LOG(openmeters::common::LogLevel::Debug, __VA_ARGS__)
+#define LOG_INFO(...) OPENMETERS_LOG(openmeters::common::LogLevel::Info, __VA_ARGS__)
+#define LOG_WARNING(...) OPENMETERS_LOG(openmeters::common::LogLevel::Warning, __VA_ARGS__)
+#define LOG_ERROR(...) OPENMETERS_LOG(openmeters::common::LogLevel::Error, __VA_ARGS__)
+#define LOG_FATAL(...) OPENMETERS_LOG(openmeters::common::LogLevel::Fatal, __VA_ARGS__)
+
+// Real-time variants for audio threads: wait-free, plain-value arguments only
+#define OPENMETERS_LOG_RT(level, ...) \
+    do { \
+        if constexpr (static_cast<int>(level) >= OPENMETERS_LOG_COMPILED_LEVEL) { \
+            if (openmeters::common::Logger::isEnabled(level)) { \
+                openmeters::common::Logger::logRealtime(level, __FILE__, __LINE__, __VA_ARGS__); \
+            } \
+        } \
+    } while (false)
+
+#define LOG_RT_DEBUG(...) OPENMETERS_LOG_RT(openmeters::common::LogLevel::Debug, __VA_ARGS__)
+#define LOG_RT_INFO(...) OPENMETERS_LOG_RT(openmeters::common::LogLevel::Info, __VA_ARGS__)
+#define LOG_RT_WARNING(...) OPENMETERS_LOG_RT(openmeters::common::LogLevel::Warning, __VA_ARGS__)
+#define LOG_RT_ERROR(...) OPENMETERS_LOG_RT(openmeters::common::LogLevel::Error, __VA_ARGS__)
+
+} // namespace openmeters::common
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "types.h"
+#include "broadcast-ring.h"
+
+namespace openmeters::common {
+
+/**
+ * Kind of sample-accurate meter event.
+ */
+enum class MeterEventType : std::uint8_t {
+    Clip = 0,            // N or more consecutive full-scale samples
+    InterSampleOver = 1, // Reconstructed waveform exceeds full scale between samples
+    Dropout = 2          // Short run of digital silence inside programme material
+};
+
+/**
+ * A single detected event.
+ * Positions are absolute stream frames counted from the start of capture.
+ */
+struct MeterEvent {
+    std::uint64_t startFrame = 0;
+    std::uint32_t lengthFrames = 0;
+    float magnitude = 0.0f; // Largest (estimated) absolute value within the event
+    MeterEventType type = MeterEventType::Clip;
+    std::uint8_t channel = 0;
+};
+
+/**
+ * Event journal shared between the audio thread (writer) and the UI and
+ * session log (readers).
+ */
+using MeterEventRing = BroadcastRing<MeterEvent, 1024>;
+
+/**
+ * Short display name for an event type.
+ */
+[[nodiscard]] constexpr const char* meterEventTypeName(MeterEventType type) noexcept {
+    switch (type) {
+        case MeterEventType::Clip:            return "clip";
+        case MeterEventType::InterSampleOver: return "inter-sample over";
+        case MeterEventType::Dropout:         return "dropout";
+        default:                              return "unknown";
+    }
+}
+
+/**
+ * Single-token event type name for machine-readable output (NDJSON lines,
+ * OSC event messages).
+ */
+[[nodiscard]] constexpr const char* meterEventWireName(MeterEventType type) noexcept {
+    switch (type) {
+        case MeterEventType::Clip:            return "clip";
+        case MeterEventType::InterSampleOver: return "over";
+        case MeterEventType::Dropout:         return "dropout";
+        default:                              return "unknown";
+    }
+}
+
+} // namespace openmeters::common
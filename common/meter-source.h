@@ -0,0 +1,47 @@
+#pragma once
+
+#include "audio-format.h"
+#include "meter-values.h"
+#include "meter-events.h"
+#include "engine-health.h"
+
+namespace openmeters::common {
+
+/**
+ * Read-only, lock-free view of a metered stream.
+ * Implemented by the audio engine; consumed by exporters and servers that
+ * poll from their own threads and must never block the audio thread.
+ *
+ * Thread safety: All methods may be called from any thread.
+ */
+class IMeterSource {
+public:
+    virtual ~IMeterSource() = default;
+
+    /**
+     * Latest meter snapshot.
+     */
+    [[nodiscard]] virtual MeterSnapshot latestSnapshot() const noexcept = 0;
+
+    /**
+     * Number of snapshots produced so far; changes whenever latestSnapshot() does.
+     */
+    [[nodiscard]] virtual std::uint64_t snapshotVersion() const noexcept = 0;
+
+    /**
+     * Journal of clips, overs and dropouts. Readers keep their own cursor.
+     */
+    [[nodiscard]] virtual const MeterEventRing& events() const noexcept = 0;
+
+    /**
+     * Format of the metered stream.
+     */
+    [[nodiscard]] virtual AudioFormat getFormat() const = 0;
+
+    /**
+     * Capture health counters. Sources without a device report zeros.
+     */
+    [[nodiscard]] virtual EngineHealth health() const noexcept { return EngineHealth(); }
+};
+
+} // namespace openmeters::common
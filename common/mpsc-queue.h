@@ -0,0 +1,122 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <type_traits>
+
+namespace openmeters::common {
+
+/**
+ * Bounded lock-free multi-producer, single-consumer queue.
+ * Every slot carries a sequence number that tells producers when it is free
+ * and the consumer when it is filled, so producers only contend on one
+ * fetch-and-CAS of the enqueue position. When the queue is full tryPush()
+ * fails instead of blocking; the caller decides whether to drop or retry.
+ *
+ * Producers can fill the slot in place through a callback, so large entries are
+ * written once rather than built on the stack and copied.
+ *
+ * Thread safety: tryPush()/tryPushWith() from any number of threads; tryPop() from one
+ * consumer thread only.
+ */
+template <typename T, std::size_t Capacity>
+class MpscQueue {
+    static_assert(std::is_trivially_copyable_v<T>, "MpscQueue requires trivially copyable entries");
+    static_assert(Capacity > 1 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    MpscQueue() noexcept {
+        for (std::size_t i = 0; i < Capacity; ++i) {
+            m_slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+
+    /**
+     * Claim a slot and fill it with fill(T&). Lock-free.
+     *
+     * @return false if the queue is full
+     */
+    template <typename Fill>
+    bool tryPushWith(Fill&& fill) noexcept {
+        std::uint64_t position = m_enqueuePosition.load(std::memory_order_relaxed);
+        for (;;) {
+            Slot& slot = m_slots[position & (Capacity - 1)];
+            const std::uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+            const auto difference = static_cast<std::int64_t>(sequence - position);
+            if (difference == 0) {
+                if (m_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    fill(slot.value);
+                    slot.sequence.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (difference < 0) {
+                return false; // Consumer has not freed this slot yet
+            } else {
+                position = m_enqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool tryPush(const T& value) noexcept {
+        return tryPushWith([&value](T& slot) { slot = value; });
+    }
+
+    /**
+     * Take the oldest entry. Consumer thread only.
+     *
+     * @return false if the queue is empty (or the oldest entry is still being written)
+     */
+    bool tryPop(T& out) noexcept {
+        const std::uint64_t position = m_dequeuePosition.load(std::memory_order_relaxed);
+        Slot& slot = m_slots[position & (Capacity - 1)];
+        if (slot.sequence.load(std::memory_order_acquire) != position + 1) {
+            return false;
+        }
+        out = slot.value;
+        slot.sequence.store(position + Capacity, std::memory_order_release);
+        m_dequeuePosition.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Approximate number of queued entries.
+     */
+    [[nodiscard]] std::size_t sizeApprox() const noexcept {
+        const std::uint64_t enqueued = m_enqueuePosition.load(std::memory_order_relaxed);
+        const std::uint64_t dequeued = m_dequeuePosition.load(std::memory_order_relaxed);
+        return enqueued > dequeued ? static_cast<std::size_t>(enqueued - dequeued) : 0;
+    }
+
+    /**
+     * Total number of slots ever claimed by producers.
+     */
+    [[nodiscard]] std::uint64_t pushedCount() const noexcept {
+        return m_enqueuePosition.load(std::memory_order_acquire);
+    }
+
+    /**
+     * Total number of entries taken by the consumer.
+     */
+    [[nodiscard]] std::uint64_t poppedCount() const noexcept {
+        return m_dequeuePosition.load(std::memory_order_acquire);
+    }
+
+    static constexpr std::size_t capacity() noexcept { return Capacity; }
+
+private:
+    struct Slot {
+        std::atomic<std::uint64_t> sequence{0};
+        T value{};
+    };
+
+    alignas(64) std::atomic<std::uint64_t> m_enqueuePosition{0};
+    alignas(64) std::atomic<std::uint64_t> m_dequeuePosition{0};
+    alignas(64) std::array<Slot, Capacity> m_slots{};
+};
+
+} // namespace openmeters::common
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace openmeters::common {
+
+/**
+ * Fixed-capacity bump allocator for per-block scratch memory.
+ * The buffer is allocated once up front; allocate() only moves an offset,
+ * so it is safe on the audio thread. Memory is released wholesale with
+ * reset() or back to a mark() with rewind().
+ *
+ * Thread safety: Not thread-safe; one arena per thread.
+ */
+class ScratchArena {
+public:
+    static constexpr std::size_t kMaxAlignment = 64;
+
+    ScratchArena() = default;
+
+    explicit ScratchArena(std::size_t capacity) { reserve(capacity); }
+
+    /**
+     * (Re)allocate the backing buffer. Not for the audio thread.
+     */
+    void reserve(std::size_t capacity) {
+        m_storage = std::make_unique<std::byte[]>(capacity + kMaxAlignment);
+        const auto address = reinterpret_cast<std::uintptr_t>(m_storage.get());
+        m_base = m_storage.get() + ((kMaxAlignment - address % kMaxAlignment) % kMaxAlignment);
+        m_capacity = capacity;
+        m_used = 0;
+    }
+
+    /**
+     * Allocate bytes with the given power-of-two alignment (<= kMaxAlignment).
+     *
+     * @return Pointer into the arena, or nullptr if it is exhausted
+     */
+    [[nodiscard]] void* allocate(std::size_t bytes, std::size_t alignment = alignof(std::max_align_t)) noexcept {
+        const std::size_t offset = (m_used + alignment - 1) & ~(alignment - 1);
+        if (offset + bytes > m_capacity) {
+            return nullptr;
+        }
+        m_used = offset + bytes;
+        return m_base + offset;
+    }
+
+    template <typename T>
+    [[nodiscard]] T* allocateArray(std::size_t count) noexcept {
+        return static_cast<T*>(allocate(count * sizeof(T), alignof(T)));
+    }
+
+    /**
+     * Current position, for a later rewind().
+     */
+    [[nodiscard]] std::size_t mark() const noexcept { return m_used; }
+
+    /**
+     * Release everything allocated after a mark.
+     */
+    void rewind(std::size_t mark) noexcept { m_used = mark < m_used ? mark : m_used; }
+
+    void reset() noexcept { m_used = 0; }
+
+    [[nodiscard]] std::size_t capacity() const noexcept { return m_capacity; }
+    [[nodiscard]] std::size_t used() const noexcept { return m_used; }
+
+private:
+    std::unique_ptr<std::byte[]> m_storage;
+    std::byte* m_base = nullptr;
+    std::size_t m_capacity = 0;
+    std::size_t m_used = 0;
+};
+
+} // namespace openmeters::common
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+namespace openmeters::common {
+
+/**
+ * Single-writer, multi-reader seqlock cell.
+ * The writer never waits; readers retry if they raced a write. The value is
+ * stored as relaxed atomic words so a concurrent copy is never a data race,
+ * and the cell holds no pointers, so it may live in shared memory.
+ *
+ * Thread safety: store() from one thread only; load()/tryLoad() from any thread.
+ */
+template <typename T>
+class SeqlockCell {
+    static_assert(std::is_trivially_copyable_v<T>, "SeqlockCell requires a trivially copyable type");
+    static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "SeqlockCell requires lock-free 64-bit atomics");
+
+public:
+    /**
+     * Publish a new value. Wait-free; call from the writer thread only.
+     */
+    void store(const T& value) noexcept {
+        std::array<std::uint64_t, kWords> words{};
+        std::memcpy(words.data(), &value, sizeof(T));
+
+        const std::uint64_t sequence = m_sequence.load(std::memory_order_relaxed);
+        m_sequence.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        for (std::size_t i = 0; i < kWords; ++i) {
+            m_words[i].store(words[i], std::memory_order_relaxed);
+        }
+
+        m_sequence.store(sequence + 2, std::memory_order_release);
+    }
+
+    /**
+     * Try to read a consistent value once.
+     *
+     * @return false if a write was in progress; out is then unspecified
+     */
+    bool tryLoad(T& out) const noexcept {
+        const std::uint64_t before = m_sequence.load(std::memory_order_acquire);
+        if (before & 1) {
+            return false;
+        }
+
+        std::array<std::uint64_t, kWords> words;
+        for (std::size_t i = 0; i < kWords; ++i) {
+            words[i] = m_words[i].load(std::memory_order_relaxed);
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (m_sequence.load(std::memory_order_relaxed) != before) {
+            return false;
+        }
+
+        std::memcpy(static_cast<void*>(&out), words.data(), sizeof(T));
+        return true;
+    }
+
+    /**
+     * Read a consistent value, retrying while the writer is active.
+     */
+    [[nodiscard]] T load() const noexcept {
+        T value{};
+        while (!tryLoad(value)) {
+        }
+        return value;
+    }
+
+    /**
+     * Number of completed stores. Cheap change check for pollers.
+     */
+    [[nodiscard]] std::uint64_t version() const noexcept {
+        return m_sequence.load(std::memory_order_acquire) / 2;
+    }
+
+private:
+    static constexpr std::size_t kWords = (sizeof(T) + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t);
+
+    alignas(64) std::atomic<std::uint64_t> m_sequence{0};
+    std::array<std::atomic<std::uint64_t>, kWords> m_words{};
+};
+
+} // namespace openmeters::common
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <type_traits>
+
+namespace openmeters::common {
+
+/**
+ * Bounded wait-free single-producer, single-consumer queue.
+ * Each side owns one index and only reads the other's, so push and pop
+ * finish in a fixed number of steps regardless of what the other thread is
+ * doing. When the queue is full tryPush() fails; the producer decides
+ * whether to drop.
+ *
+ * Thread safety: tryPush() from one producer thread; tryPop() from one
+ * consumer thread.
+ */
+template <typename T, std::size_t Capacity>
+class SpscQueue {
+    static_assert(std::is_trivially_copyable_v<T>, "SpscQueue requires trivially copyable entries");
+    static_assert(Capacity > 1 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    SpscQueue() = default;
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    /**
+     * Append an entry. Wait-free; producer thread only.
+     *
+     * @return false if the queue is full
+     */
+    bool tryPush(const T& value) noexcept {
+        const std::uint64_t tail = m_tail.load(std::memory_order_relaxed);
+        if (tail - m_cachedHead >= Capacity) {
+            m_cachedHead = m_head.load(std::memory_order_acquire);
+            if (tail - m_cachedHead >= Capacity) {
+                return false;
+            }
+        }
+        m_slots[tail & (Capacity - 1)] = value;
+        m_tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Take the oldest entry. Wait-free; consumer thread only.
+     *
+     * @return false if the queue is empty
+     */
+    bool tryPop(T& out) noexcept {
+        const std::uint64_t head = m_head.load(std::memory_order_relaxed);
+        if (head == m_tail.load(std::memory_order_acquire)) {
+            return false;
+        }
+        out = m_slots[head & (Capacity - 1)];
+        m_head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * True if nothing is queued (approximate while the producer runs).
+     */
+    [[nodiscard]] bool empty() const noexcept {
+        return m_head.load(std::memory_order_acquire) == m_tail.load(std::memory_order_acquire);
+    }
+
+    static constexpr std::size_t capacity() noexcept { return Capacity; }
+
+private:
+    // Producer side
+    alignas(64) std::atomic<std::uint64_t> m_tail{0};
+    std::uint64_t m_cachedHead = 0; // Producer's last view of m_head
+
+    // Consumer side
+    alignas(64) std::atomic<std::uint64_t> m_head{0};
+
+    alignas(64) std::array<T, Capacity> m_slots{};
+};
+
+} // namespace openmeters::common
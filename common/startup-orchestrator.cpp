@@ -0,0 +1,133 @@
+#include "startup-orchestrator.h"
+#include "logger.h"
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+namespace openmeters::common {
+
+namespace {
+
+enum class PhaseState {
+    Waiting,
+    Running,
+    Done
+};
+
+} // namespace
+
+StartupOrchestrator::PhaseId StartupOrchestrator::addPhase(std::string name, PhaseFunction run,
+                                                           std::initializer_list<PhaseId> after,
+                                                           PhaseAffinity affinity) {
+    StartupPhaseResult result;
+    result.name = std::move(name);
+    m_results.push_back(std::move(result));
+    m_phases.push_back(Phase{std::move(run), std::vector<PhaseId>(after), affinity});
+    return m_phases.size() - 1;
+}
+
+bool StartupOrchestrator::run() {
+    using Clock = std::chrono::steady_clock;
+    const Clock::time_point start = Clock::now();
+    const auto elapsedMs = [start] {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    };
+
+    std::mutex mutex;
+    std::condition_variable finished;
+    std::vector<PhaseState> states(m_phases.size(), PhaseState::Waiting);
+    std::size_t remaining = m_phases.size();
+    std::vector<std::thread> workers;
+
+    // Runs outside the lock; results are only read by others once the state is Done
+    const auto execute = [this, &elapsedMs](PhaseId id) {
+        StartupPhaseResult& result = m_results[id];
+        result.startMs = elapsedMs();
+        try {
+            result.ok = m_phases[id].run();
+        } catch (const std::exception& e) {
+            LOG_ERROR("Startup phase {} threw: {}", result.name, e.what());
+            result.ok = false;
+        }
+        result.durationMs = elapsedMs() - result.startMs;
+    };
+
+    std::unique_lock<std::mutex> lock(mutex);
+    while (remaining > 0) {
+        // Start every phase whose dependencies are done; skip those with a failed one
+        PhaseId callerPhase = m_phases.size();
+        bool progressed = false;
+        for (PhaseId id = 0; id < m_phases.size(); ++id) {
+            if (states[id] != PhaseState::Waiting) {
+                continue;
+            }
+            bool ready = true;
+            bool blocked = false;
+            for (PhaseId dependency : m_phases[id].after) {
+                ready = ready && states[dependency] == PhaseState::Done;
+                blocked = blocked || (states[dependency] == PhaseState::Done && !m_results[dependency].ok);
+            }
+            if (blocked) {
+                states[id] = PhaseState::Done;
+                m_results[id].ok = false;
+                m_results[id].skipped = true;
+                --remaining;
+                progressed = true;
+            } else if (ready && m_phases[id].affinity == PhaseAffinity::Worker) {
+                states[id] = PhaseState::Running;
+                workers.emplace_back([&, id] {
+                    execute(id);
+                    std::lock_guard<std::mutex> guard(mutex);
+                    states[id] = PhaseState::Done;
+                    --remaining;
+                    finished.notify_all();
+                });
+            } else if (ready && callerPhase == m_phases.size()) {
+                callerPhase = id;
+            }
+        }
+
+        if (callerPhase < m_phases.size()) {
+            states[callerPhase] = PhaseState::Running;
+            lock.unlock();
+            execute(callerPhase);
+            lock.lock();
+            states[callerPhase] = PhaseState::Done;
+            --remaining;
+        } else if (!progressed && remaining > 0) {
+            finished.wait(lock);
+        }
+    }
+    lock.unlock();
+
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    m_totalMs = elapsedMs();
+
+    bool ok = true;
+    for (const StartupPhaseResult& result : m_results) {
+        ok = ok && result.ok;
+    }
+    return ok;
+}
+
+void StartupOrchestrator::logSummary() const {
+    double busyMs = 0.0;
+    for (const StartupPhaseResult& result : m_results) {
+        if (result.skipped) {
+            LOG_WARNING("Startup phase {} skipped (a dependency failed)", result.name);
+            continue;
+        }
+        busyMs += result.durationMs;
+        if (result.ok) {
+            LOG_INFO("Startup phase {} took {:.1f} ms (at {:.1f} ms)", result.name, result.durationMs, result.startMs);
+        } else {
+            LOG_WARNING("Startup phase {} failed after {:.1f} ms (at {:.1f} ms)", result.name, result.durationMs, result.startMs);
+        }
+    }
+    LOG_INFO("Startup finished in {:.1f} ms ({:.1f} ms of phase work)", m_totalMs, busyMs);
+}
+
+} // namespace openmeters::common
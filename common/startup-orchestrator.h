@@ -0,0 +1,95 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+namespace openmeters::common {
+
+/**
+ * Where a startup phase runs.
+ */
+enum class PhaseAffinity {
+    Worker,  // Own thread, concurrently with other ready phases
+    Caller   // The thread that calls run() (e.g. window creation on the UI thread)
+};
+
+/**
+ * Outcome and timing of one startup phase. Times are relative to run().
+ */
+struct StartupPhaseResult {
+    std::string name;
+    bool ok = false;
+    bool skipped = false;      // Not run because a dependency failed
+    double startMs = 0.0;
+    double durationMs = 0.0;
+};
+
+/**
+ * Runs application startup as a graph of phases.
+ *
+ * Each phase starts as soon as the phases it depends on have succeeded, so
+ * independent work (audio device bring-up, window and renderer creation)
+ * overlaps. A phase whose dependency failed is skipped. Every phase is
+ * timed; logSummary() writes the timings to the log.
+ *
+ * Usage:
+ *   StartupOrchestrator startup;
+ *   auto config = startup.addPhase("config", loadConfig);
+ *   auto window = startup.addPhase("window", createWindow, {config}, PhaseAffinity::Caller);
+ *   auto audio = startup.addPhase("audio", initAudio, {config});
+ *   startup.run();
+ *
+ * Thread safety: Not thread-safe; build and run from one thread. Phases
+ * that run concurrently must not share unsynchronized state.
+ */
+class StartupOrchestrator {
+public:
+    using PhaseId = std::size_t;
+    using PhaseFunction = std::function<bool()>;
+
+    /**
+     * Add a phase. Dependencies must already have been added.
+     *
+     * @param run Returns false (or throws) on failure
+     */
+    PhaseId addPhase(std::string name, PhaseFunction run, std::initializer_list<PhaseId> after = {},
+                     PhaseAffinity affinity = PhaseAffinity::Worker);
+
+    /**
+     * Run every phase and wait for all of them.
+     *
+     * @return true if every phase succeeded
+     */
+    bool run();
+
+    [[nodiscard]] bool succeeded(PhaseId phase) const { return m_results[phase].ok; }
+    [[nodiscard]] const StartupPhaseResult& result(PhaseId phase) const { return m_results[phase]; }
+    [[nodiscard]] const std::vector<StartupPhaseResult>& results() const noexcept { return m_results; }
+
+    /**
+     * Wall time of the last run().
+     */
+    [[nodiscard]] double totalMs() const noexcept { return m_totalMs; }
+
+    /**
+     * Log each phase's timing and the total.
+     */
+    void logSummary() const;
+
+private:
+    struct Phase {
+        PhaseFunction run;
+        std::vector<PhaseId> after;
+        PhaseAffinity affinity = PhaseAffinity::Worker;
+    };
+
+    std::vector<Phase> m_phases;
+    std::vector<StartupPhaseResult> m_results;
+    double m_totalMs = 0.0;
+};
+
+} // namespace openmeters::common
@@ -0,0 +1,364 @@
+#pragma once
+
+#include "audio-format.h"
+#include "meter-values.h"
+#include "meter-events.h"
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+namespace openmeters::common {
+
+/**
+ * Versioned binary schema for meter data, shared by every export path
+ * (IPC, sockets, files).
+ *
+ * A message is a fixed header, a vtable of field offsets and the field data:
+ *
+ *   0   u32 magic ('O','M','W','F')
+ *   4   u16 schemaVersion
+ *   6   u16 vtableLength (number of field slots)
+ *   8   u32 totalSize
+ *   12  u16 vtable[vtableLength]   byte offset of each field, 0 = absent
+ *   ..  padding to 8, then field data
+ *
+ * Scalars sit at their natural alignment. Arrays are a u32 count, a u32
+ * element size, then the elements (8-aligned). Everything is little-endian.
+ *
+ * Readers look fields up through the vtable and read them in place; a field
+ * the reader does not know is skipped for free and a field the writer did
+ * not set reads as its default. New fields are appended to the enum; the
+ * schema version only changes for incompatible layout changes.
+ *
+ * The engine only targets little-endian hosts, so values are copied as-is.
+ */
+namespace wire {
+
+inline constexpr std::uint32_t kMagic = 0x46574D4F; // "OMWF"
+inline constexpr std::uint16_t kSchemaVersion = 1;
+inline constexpr std::size_t kHeaderSize = 12;
+
+/**
+ * Field ids of the snapshot schema. Append only.
+ */
+enum class Field : std::uint16_t {
+    TimestampMs = 0,   // u64
+    StreamFrame = 1,   // u64
+    SampleRate = 2,    // u32
+    ChannelCount = 3,  // u32
+    Peak = 4,          // f32[channels], linear
+    Rms = 5,           // f32[channels], linear
+    Spectrum = 6,      // f32[bins], linear magnitude
+    Events = 7,        // EventRecord[]
+    EventSequence = 8, // u64, journal position after the last event included
+
+    Count
+};
+
+/**
+ * Event record layout inside an Events array (24 bytes).
+ */
+struct EventRecord {
+    std::uint64_t startFrame;
+    std::uint32_t lengthFrames;
+    float magnitude;
+    std::uint8_t type;
+    std::uint8_t channel;
+    std::uint8_t reserved[6];
+};
+static_assert(sizeof(EventRecord) == 24, "EventRecord layout is part of the wire format");
+
+/**
+ * Bytes needed for a message with the given vtable length and field payload.
+ */
+[[nodiscard]] constexpr std::size_t messageOverhead(std::size_t vtableLength) noexcept {
+    return (kHeaderSize + 2 * vtableLength + 7) & ~std::size_t(7);
+}
+
+[[nodiscard]] constexpr std::size_t arraySize(std::size_t count, std::size_t elementSize) noexcept {
+    return 8 + ((count * elementSize + 7) & ~std::size_t(7));
+}
+
+/**
+ * Serializes fields straight into a caller-owned buffer.
+ *
+ * Fields may be written in any order, each at most once. Once the buffer
+ * would overflow, further writes are ignored and finish() returns 0.
+ *
+ *   wire::Writer writer(buffer, sizeof(buffer));
+ *   writer.putU64(wire::Field::TimestampMs, snapshot.timestampMs);
+ *   float* peak = writer.reserveArray<float>(wire::Field::Peak, 2);
+ *   ...
+ *   const std::size_t size = writer.finish();
+ */
+class Writer {
+public:
+    Writer(std::uint8_t* out, std::size_t capacity, std::uint16_t vtableLength = static_cast<std::uint16_t>(Field::Count)) noexcept
+        : m_out(out), m_capacity(capacity), m_vtableLength(vtableLength) {
+        m_size = messageOverhead(vtableLength);
+        if (m_size > m_capacity) {
+            m_overflowed = true;
+            return;
+        }
+        std::memset(m_out, 0, m_size);
+    }
+
+    void putU64(Field field, std::uint64_t value) noexcept { putScalar(field, &value, 8); }
+    void putU32(Field field, std::uint32_t value) noexcept { putScalar(field, &value, 4); }
+    void putF32(Field field, float value) noexcept { putScalar(field, &value, 4); }
+
+    /**
+     * Reserve an array and return where its elements go, so callers fill
+     * it in place. Returns nullptr on overflow.
+     */
+    template <typename T>
+    T* reserveArray(Field field, std::size_t count) noexcept {
+        void* elements = reserveBytes(field, count, sizeof(T));
+        return static_cast<T*>(elements);
+    }
+
+    void putF32Array(Field field, const float* values, std::size_t count) noexcept {
+        if (float* out = reserveArray<float>(field, count)) {
+            std::memcpy(out, values, count * sizeof(float));
+        }
+    }
+
+    void putEvents(Field field, const MeterEvent* events, std::size_t count) noexcept {
+        auto* out = static_cast<std::uint8_t*>(reserveBytes(field, count, sizeof(EventRecord)));
+        if (!out) {
+            return;
+        }
+        for (std::size_t i = 0; i < count; ++i) {
+            EventRecord record{};
+            record.startFrame = events[i].startFrame;
+            record.lengthFrames = events[i].lengthFrames;
+            record.magnitude = events[i].magnitude;
+            record.type = static_cast<std::uint8_t>(events[i].type);
+            record.channel = events[i].channel;
+            std::memcpy(out + i * sizeof(EventRecord), &record, sizeof(EventRecord));
+        }
+    }
+
+    /**
+     * Write the header.
+     *
+     * @return Message size, or 0 if the buffer was too small
+     */
+    std::size_t finish() noexcept {
+        if (m_overflowed) {
+            return 0;
+        }
+        const std::uint32_t magic = kMagic;
+        const std::uint16_t version = kSchemaVersion;
+        const auto totalSize = static_cast<std::uint32_t>(m_size);
+        std::memcpy(m_out, &magic, 4);
+        std::memcpy(m_out + 4, &version, 2);
+        std::memcpy(m_out + 6, &m_vtableLength, 2);
+        std::memcpy(m_out + 8, &totalSize, 4);
+        return m_size;
+    }
+
+    [[nodiscard]] bool overflowed() const noexcept { return m_overflowed; }
+
+private:
+    bool claim(Field field, std::size_t alignment, std::size_t bytes, std::size_t& offset) noexcept {
+        const auto slot = static_cast<std::size_t>(field);
+        offset = (m_size + alignment - 1) & ~(alignment - 1);
+        if (m_overflowed || slot >= m_vtableLength || offset + bytes > m_capacity || offset > 0xFFFF) {
+            m_overflowed = true;
+            return false;
+        }
+        std::memset(m_out + m_size, 0, offset + bytes - m_size);
+        const auto offset16 = static_cast<std::uint16_t>(offset);
+        std::memcpy(m_out + kHeaderSize + 2 * slot, &offset16, 2);
+        m_size = offset + bytes;
+        return true;
+    }
+
+    void putScalar(Field field, const void* value, std::size_t bytes) noexcept {
+        std::size_t offset = 0;
+        if (claim(field, bytes, bytes, offset)) {
+            std::memcpy(m_out + offset, value, bytes);
+        }
+    }
+
+    void* reserveBytes(Field field, std::size_t count, std::size_t elementSize) noexcept {
+        std::size_t offset = 0;
+        if (!claim(field, 8, arraySize(count, elementSize), offset)) {
+            return nullptr;
+        }
+        const auto count32 = static_cast<std::uint32_t>(count);
+        const auto elementSize32 = static_cast<std::uint32_t>(elementSize);
+        std::memcpy(m_out + offset, &count32, 4);
+        std::memcpy(m_out + offset + 4, &elementSize32, 4);
+        return m_out + offset + 8;
+    }
+
+    std::uint8_t* m_out;
+    std::size_t m_capacity;
+    std::size_t m_size = 0;
+    std::uint16_t m_vtableLength;
+    bool m_overflowed = false;
+};
+
+/**
+ * In-place view of an array field.
+ */
+template <typename T>
+struct ArrayView {
+    const std::uint8_t* data = nullptr;
+    std::size_t count = 0;
+    std::size_t stride = sizeof(T); // Element size as written (may grow in later schemas)
+
+    [[nodiscard]] T operator[](std::size_t index) const noexcept {
+        T value{};
+        std::memcpy(&value, data + index * stride, sizeof(T) < stride ? sizeof(T) : stride);
+        return value;
+    }
+
+    [[nodiscard]] bool empty() const noexcept { return count == 0; }
+};
+
+/**
+ * Reads fields in place from a received buffer; nothing is copied or parsed
+ * up front. The buffer must outlive the reader.
+ */
+class Reader {
+public:
+    /**
+     * Validate the header and vtable.
+     *
+     * @return false if the buffer is not a well-formed message
+     */
+    bool open(const std::uint8_t* data, std::size_t size) noexcept {
+        m_data = nullptr;
+        if (size < kHeaderSize) {
+            return false;
+        }
+        std::uint32_t magic = 0;
+        std::uint16_t version = 0;
+        std::uint32_t totalSize = 0;
+        std::memcpy(&magic, data, 4);
+        std::memcpy(&version, data + 4, 2);
+        std::memcpy(&m_vtableLength, data + 6, 2);
+        std::memcpy(&totalSize, data + 8, 4);
+        if (magic != kMagic || version != kSchemaVersion || totalSize > size ||
+            messageOverhead(m_vtableLength) > totalSize) {
+            return false;
+        }
+        m_data = data;
+        m_size = totalSize;
+        return true;
+    }
+
+    /**
+     * Total message size (from the header).
+     */
+    [[nodiscard]] std::size_t size() const noexcept { return m_size; }
+
+    [[nodiscard]] bool has(Field field) const noexcept { return offsetOf(field) != 0; }
+
+    [[nodiscard]] std::uint64_t u64(Field field, std::uint64_t fallback = 0) const noexcept {
+        return scalar(field, fallback);
+    }
+
+    [[nodiscard]] std::uint32_t u32(Field field, std::uint32_t fallback = 0) const noexcept {
+        return scalar(field, fallback);
+    }
+
+    [[nodiscard]] float f32(Field field, float fallback = 0.0f) const noexcept {
+        return scalar(field, fallback);
+    }
+
+    template <typename T>
+    [[nodiscard]] ArrayView<T> array(Field field) const noexcept {
+        const std::size_t offset = offsetOf(field);
+        if (offset == 0 || offset + 8 > m_size) {
+            return ArrayView<T>();
+        }
+        std::uint32_t count = 0;
+        std::uint32_t stride = 0;
+        std::memcpy(&count, m_data + offset, 4);
+        std::memcpy(&stride, m_data + offset + 4, 4);
+        if (stride == 0 || count > (m_size - offset - 8) / stride) {
+            return ArrayView<T>();
+        }
+        return ArrayView<T>{m_data + offset + 8, count, stride};
+    }
+
+private:
+    [[nodiscard]] std::size_t offsetOf(Field field) const noexcept {
+        const auto slot = static_cast<std::size_t>(field);
+        if (!m_data || slot >= m_vtableLength) {
+            return 0;
+        }
+        std::uint16_t offset = 0;
+        std::memcpy(&offset, m_data + kHeaderSize + 2 * slot, 2);
+        return offset;
+    }
+
+    template <typename T>
+    [[nodiscard]] T scalar(Field field, T fallback) const noexcept {
+        const std::size_t offset = offsetOf(field);
+        if (offset == 0 || offset + sizeof(T) > m_size) {
+            return fallback;
+        }
+        T value;
+        std::memcpy(&value, m_data + offset, sizeof(T));
+        return value;
+    }
+
+    const std::uint8_t* m_data = nullptr;
+    std::size_t m_size = 0;
+    std::uint16_t m_vtableLength = 0;
+};
+
+/**
+ * Upper bound on encodeSnapshot() output for a given channel count.
+ */
+[[nodiscard]] constexpr std::size_t maxSnapshotSize(std::size_t channels = 2) noexcept {
+    return messageOverhead(static_cast<std::size_t>(Field::Count)) + 3 * 8 + 2 * 4 +
+           2 * arraySize(channels, sizeof(float));
+}
+
+/**
+ * Serialize a meter snapshot (the common case for every exporter).
+ *
+ * @param streamFrame Stream position, or UINT64_MAX to omit the field
+ * @return Message size, or 0 if the buffer was too small
+ */
+inline std::size_t encodeSnapshot(
+    std::uint8_t* out,
+    std::size_t capacity,
+    const MeterSnapshot& snapshot,
+    const AudioFormat& format,
+    std::uint64_t streamFrame = UINT64_MAX
+) noexcept {
+    Writer writer(out, capacity);
+    writer.putU64(Field::TimestampMs, snapshot.timestampMs);
+    if (streamFrame != UINT64_MAX) {
+        writer.putU64(Field::StreamFrame, streamFrame);
+    }
+    writer.putU32(Field::SampleRate, format.sampleRate);
+    writer.putU32(Field::ChannelCount, format.channelCount);
+
+    // MeterSnapshot carries at most two channels
+    const std::size_t channels = format.channelCount >= 2 ? 2 : 1;
+    if (float* peak = writer.reserveArray<float>(Field::Peak, channels)) {
+        peak[0] = snapshot.peak.left;
+        if (channels == 2) {
+            peak[1] = snapshot.peak.right;
+        }
+    }
+    if (float* rms = writer.reserveArray<float>(Field::Rms, channels)) {
+        rms[0] = snapshot.rms.left;
+        if (channels == 2) {
+            rms[1] = snapshot.rms.right;
+        }
+    }
+    return writer.finish();
+}
+
+} // namespace wire
+
+} // namespace openmeters::common
@@ -2,9 +2,17 @@
 
 #include "../../common/audio-format.h"
 #include "../../common/meter-values.h"
+#include <cstddef>
+#include <cstdint>
 
 namespace openmeters::core::audio {
 
+/**
+ * Flags for an audio buffer, as reported by the capture device.
+ */
+inline constexpr std::uint32_t kAudioDataSilent = 1u << 0;         // Device reported silence (buffer is zeroed)
+inline constexpr std::uint32_t kAudioDataDiscontinuity = 1u << 1;  // Gap in the stream before this buffer
+
 /**
  * Interface for audio data callbacks.
  * Implementations receive real-time audio buffers and meter values.
@@ -19,6 +27,7 @@ public:
      * @param buffer Audio buffer (interleaved samples: L, R, L, R, ...)
      * @param frameCount Number of frames (samples per channel)
      * @param format Audio format descriptor
+     * @param flags kAudioData* flags for this buffer
      * 
      * Thread: Audio capture thread (real-time priority)
      * Ownership: Buffer is valid only during this call
@@ -26,7 +35,8 @@ public:
     virtual void onAudioData(
         const float* buffer,
         std::size_t frameCount,
-        const common::AudioFormat& format
+        const common::AudioFormat& format,
+        std::uint32_t flags
     ) = 0;
     
     /**
@@ -22,12 +22,17 @@ bool AudioEngine::initialize() {
     
     // Register internal metering callback
     m_capture.registerCallback(&m_meteringCallback);
+    m_capture.setHealthCounters(&m_pipeline.healthCounters());
     
     return true;
 }
 
 bool AudioEngine::start() {
-    m_startTime = std::chrono::steady_clock::now();
+    if (!m_capture.isCapturing()) {
+        // Size plugin scratch for up to 100 ms per block; larger blocks are chunked
+        const common::AudioFormat format = m_capture.getFormat();
+        m_pipeline.prepare(format, format.sampleRate / 10);
+    }
     return m_capture.start();
 }
 
@@ -38,6 +43,10 @@ void AudioEngine::stop() {
 void AudioEngine::shutdown() {
     stop();
     
+    disableSharedSnapshots();
+    disableSharedAudio();
+    m_pipeline.plugins().unloadAll();
+    
     // Unregister internal callback
     m_capture.unregisterCallback(&m_meteringCallback);
     
@@ -79,6 +88,41 @@ bool AudioEngine::isCapturing() const {
     return m_capture.isCapturing();
 }
 
+std::size_t AudioEngine::loadMeterPlugins(const std::string& directory) {
+    if (isCapturing()) {
+        return 0;
+    }
+    return m_pipeline.plugins().loadDirectory(directory);
+}
+
+bool AudioEngine::enableSharedSnapshots(const std::string& regionName) {
+    if (isCapturing()) {
+        return false;
+    }
+    return m_snapshotPublisher.open(regionName);
+}
+
+void AudioEngine::disableSharedSnapshots() {
+    if (isCapturing()) {
+        return;
+    }
+    m_snapshotPublisher.close();
+}
+
+bool AudioEngine::enableSharedAudio(const std::string& regionName) {
+    if (isCapturing()) {
+        return false;
+    }
+    return m_audioRingWriter.open(regionName);
+}
+
+void AudioEngine::disableSharedAudio() {
+    if (isCapturing()) {
+        return;
+    }
+    m_audioRingWriter.close();
+}
+
 void AudioEngine::forwardMeterData(const common::MeterSnapshot& snapshot) {
     std::lock_guard<std::mutex> lock(m_callbackMutex);
     for (IAudioDataCallback* callback : m_callbacks) {
@@ -98,27 +142,29 @@ AudioEngine::MeteringCallback::MeteringCallback(AudioEngine* engine)
 void AudioEngine::MeteringCallback::onAudioData(
     const float* buffer,
     std::size_t frameCount,
-    const common::AudioFormat& format
+    const common::AudioFormat& format,
+    std::uint32_t flags
 ) {
     if (!buffer || frameCount == 0) {
         return;
     }
     
-    // Compute peak and RMS
-    const auto peak = m_peakMeter.process(buffer, frameCount, format);
-    const auto rms = m_rmsMeter.process(buffer, frameCount, format);
-    
-    // Create snapshot
-    common::MeterSnapshot snapshot;
-    snapshot.peak = peak;
-    snapshot.rms = rms;
-    // Calculate timestamp relative to start time
-    auto now = std::chrono::steady_clock::now();
-    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
-        now - m_engine->m_startTime
-    ).count();
+    // Mirror raw audio for external consumers, marking device silence and gaps
+    std::uint32_t blockFlags = 0;
+    if (flags & kAudioDataSilent) {
+        blockFlags |= ipc::kAudioBlockSilent;
+    }
+    if (flags & kAudioDataDiscontinuity) {
+        blockFlags |= ipc::kAudioBlockDiscontinuity;
+    }
+    meters::MeterPipeline& pipeline = m_engine->m_pipeline;
+    m_engine->m_audioRingWriter.write(buffer, frameCount, format, pipeline.streamFrame(), blockFlags);
     
-    snapshot.timestampMs = static_cast<long long>(elapsed);
+    // Meters, events and plugins, published lock-free for pollers
+    const common::MeterSnapshot& snapshot = pipeline.process(buffer, frameCount);
+    m_engine->m_snapshotPublisher.publish(
+        snapshot, format, pipeline.streamFrame(), pipeline.events().writePosition()
+    );
     
     // Forward to engine callbacks
     m_engine->forwardMeterData(snapshot);
@@ -1,11 +1,13 @@
 #pragma once
 
 #include "audio-engine-interface.h"
-#include "../../core/meters/peak-meter.h"
-#include "../../core/meters/rms-meter.h"
+#include "../../core/meters/meter-pipeline.h"
+#include "../../common/meter-source.h"
+#include "../../core/ipc/snapshot-publisher.h"
+#include "../../core/ipc/audio-ring-writer.h"
+#include <string>
 #include <vector>
 #include <mutex>
-#include <chrono>
 
 #ifdef _WIN32
 #include "wasapi-capture.h"
@@ -17,12 +19,14 @@ namespace openmeters::core::audio {
 
 /**
  * Audio engine implementation.
- * Integrates WASAPI capture with peak/RMS metering and exposes data via callbacks.
+ * Integrates WASAPI capture with the metering pipeline and exposes data via
+ * callbacks and, for pollers on other threads, through the lock-free
+ * IMeterSource view.
  * 
  * Thread safety: Thread-safe for public operations.
  * Audio callbacks run on WASAPI capture thread.
  */
-class AudioEngine : public IAudioEngine {
+class AudioEngine : public IAudioEngine, public common::IMeterSource {
 public:
     AudioEngine();
     ~AudioEngine() override;
@@ -43,11 +47,81 @@ public:
     
     [[nodiscard]] common::AudioFormat getFormat() const override;
     [[nodiscard]] bool isCapturing() const override;
+    
+    /**
+     * Journal of clips, inter-sample overs and dropouts.
+     * Written by the capture thread; any thread may read it with its own cursor.
+     */
+    [[nodiscard]] const common::MeterEventRing& events() const noexcept override { return m_pipeline.events(); }
+    
+    /**
+     * Latest meter snapshot, read without taking any engine lock.
+     * Safe to poll from any thread at any rate.
+     */
+    [[nodiscard]] common::MeterSnapshot latestSnapshot() const noexcept override { return m_pipeline.latestSnapshot(); }
+    
+    /**
+     * Number of snapshots produced so far (changes whenever latestSnapshot() does).
+     */
+    [[nodiscard]] std::uint64_t snapshotVersion() const noexcept override { return m_pipeline.snapshotVersion(); }
+    
+    /**
+     * Capture health counters (packets, discontinuities, latency).
+     * Read without taking any engine lock.
+     */
+    [[nodiscard]] common::EngineHealth health() const noexcept override { return m_pipeline.health(); }
+    
+    /**
+     * Publish every snapshot into a named shared-memory region for
+     * out-of-process readers (see core/ipc/snapshot-reader.h).
+     * Must be called while not capturing.
+     * 
+     * @param regionName Shared-memory region name
+     * @return true if the region was created
+     */
+    bool enableSharedSnapshots(const std::string& regionName = ipc::kDefaultSnapshotRegionName);
+    
+    /**
+     * Stop publishing and remove the shared region.
+     * Must be called while not capturing.
+     */
+    void disableSharedSnapshots();
+    
+    /**
+     * Mirror the captured float stream into a shared-memory ring for
+     * external consumers (see core/ipc/audio-ring-reader.h).
+     * Must be called while not capturing.
+     * 
+     * @param regionName Shared-memory region name
+     * @return true if the ring was created
+     */
+    bool enableSharedAudio(const std::string& regionName = ipc::kDefaultAudioRingName);
+    
+    /**
+     * Stop mirroring audio and remove the shared ring.
+     * Must be called while not capturing.
+     */
+    void disableSharedAudio();
+    
+    /**
+     * Load meter plugins from every shared library in a directory.
+     * They run on the capture thread after the built-in meters.
+     * Must be called while not capturing.
+     * 
+     * @param directory Directory containing plugin libraries
+     * @return Number of plugins loaded
+     */
+    std::size_t loadMeterPlugins(const std::string& directory);
+    
+    /**
+     * Loaded meter plugins and their latest outputs (outputs() is lock-free).
+     */
+    [[nodiscard]] const plugins::PluginHost& meterPlugins() const noexcept { return m_pipeline.plugins(); }
 
 private:
     /**
      * Internal callback implementation.
-     * Receives audio data from WASAPI capture and computes meters.
+     * Receives audio data from WASAPI capture and runs the metering pipeline.
      */
     class MeteringCallback : public IAudioDataCallback {
     public:
@@ -56,15 +130,14 @@ private:
         void onAudioData(
             const float* buffer,
             std::size_t frameCount,
-            const common::AudioFormat& format
+            const common::AudioFormat& format,
+            std::uint32_t flags
         ) override;
         
         void onMeterData(const common::MeterSnapshot& snapshot) override;
         
     private:
         AudioEngine* m_engine;
-        meters::PeakMeter m_peakMeter;
-        meters::RmsMeter m_rmsMeter;
     };
     
     /**
@@ -77,7 +150,9 @@ private:
     
     std::mutex m_callbackMutex;
     std::vector<IAudioDataCallback*> m_callbacks;
-    std::chrono::steady_clock::time_point m_startTime;
+    meters::MeterPipeline m_pipeline;
+    ipc::SnapshotPublisher m_snapshotPublisher;
+    ipc::AudioRingWriter m_audioRingWriter;
 };
 
 } // namespace openmeters::core::audio
@@ -3,11 +3,20 @@
 #ifdef _WIN32
 
 #include "../../common/types.h"
+#include "../../common/logger.h"
+#include <objbase.h>
 #include <algorithm>
 #include <cmath>
 
 namespace openmeters::core::audio {
 
+namespace {
+
+// Packets older than two polling periods are reported as late
+constexpr UINT64 kLatePacketUs = 200000;
+
+} // namespace
+
 WasapiCapture::WasapiCapture() = default;
 
 WasapiCapture::~WasapiCapture() {
@@ -15,16 +24,22 @@ WasapiCapture::~WasapiCapture() {
 }
 
 bool WasapiCapture::initialize() {
-    if (m_comInitialized) {
+    if (m_initialized) {
         return true; // Already initialized
     }
     
-    // Initialize COM
-    HRESULT hr = CoInitializeEx(nullptr, COINIT_MULTITHREADED);
-    if (FAILED(hr) && hr != RPC_E_CHANGED_MODE) {
-        return false;
+    // Join the multithreaded apartment unless the caller already has (the
+    // GUI joins it on the main thread, which also covers worker threads)
+    APTTYPE apartment = APTTYPE_CURRENT;
+    APTTYPEQUALIFIER qualifier = APTTYPEQUALIFIER_NONE;
+    HRESULT hr = CoGetApartmentType(&apartment, &qualifier);
+    if (FAILED(hr) || apartment != APTTYPE_MTA) {
+        hr = CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+        if (FAILED(hr) && hr != RPC_E_CHANGED_MODE) {
+            return false;
+        }
+        m_comInitialized = SUCCEEDED(hr); // Only a successful init is ours to undo
     }
-    m_comInitialized = true;
     
     // Create device enumerator
     hr = CoCreateInstance(
@@ -124,6 +139,7 @@ bool WasapiCapture::initialize() {
         return false;
     }
     
+    m_initialized = true;
     return true;
 }
 
@@ -198,6 +214,7 @@ void WasapiCapture::shutdown() {
     
     releaseAudioClient();
     releaseCom();
+    m_initialized = false;
     
     if (m_stopEvent) {
         CloseHandle(m_stopEvent);
@@ -234,6 +251,16 @@ void WasapiCapture::unregisterCallback(IAudioDataCallback* callback) {
     );
 }
 
+void WasapiCapture::setHealthCounters(common::EngineHealthCounters* counters) {
+    if (m_capturing.load()) {
+        return;
+    }
+    m_health = counters;
+    
+    LARGE_INTEGER frequency;
+    m_qpcFrequency = QueryPerformanceFrequency(&frequency) ? frequency.QuadPart : 0;
+}
+
 DWORD WINAPI WasapiCapture::captureThreadProc(LPVOID lpParam) {
     auto* capture = static_cast<WasapiCapture*>(lpParam);
     if (capture) {
@@ -243,6 +270,9 @@ DWORD WINAPI WasapiCapture::captureThreadProc(LPVOID lpParam) {
 }
 
 void WasapiCapture::captureThread() {
+    // Diagnostics from this TIME_CRITICAL thread go through a wait-free ring
+    common::RealtimeLogScope logScope("capture");
+    
     const HANDLE waitArray[] = { m_stopEvent };
     const DWORD waitCount = 1;
     
@@ -276,6 +306,10 @@ void WasapiCapture::captureThread() {
         );
         
         if (FAILED(hr)) {
+            if (m_health) {
+                m_health->recordBufferError();
+            }
+            LOG_RT_WARNING("Capture GetBuffer failed: 0x{:x}", static_cast<std::uint32_t>(hr));
             if (hr == AUDCLNT_E_BUFFER_ERROR) {
                 // Buffer lost, try to recover by releasing any partial buffer
                 // Note: GetBuffer failed, so we don't have a valid buffer to release
@@ -290,6 +324,35 @@ void WasapiCapture::captureThread() {
             continue;
         }
         
+        if (flags & AUDCLNT_BUFFERFLAGS_DATA_DISCONTINUITY) {
+            LOG_RT_WARNING("Capture discontinuity at device position {}", devicePosition);
+        }
+        
+        if (m_health) {
+            m_health->recordPacket(
+                numFramesAvailable,
+                (flags & AUDCLNT_BUFFERFLAGS_SILENT) != 0,
+                (flags & AUDCLNT_BUFFERFLAGS_DATA_DISCONTINUITY) != 0
+            );
+            
+            // qpcPosition is in 100 ns units when the timestamp is valid
+            if (m_qpcFrequency > 0 && !(flags & AUDCLNT_BUFFERFLAGS_TIMESTAMP_ERROR)) {
+                LARGE_INTEGER counter;
+                QueryPerformanceCounter(&counter);
+                const UINT64 now100ns = static_cast<UINT64>(
+                    counter.QuadPart / m_qpcFrequency * 10000000 +
+                    counter.QuadPart % m_qpcFrequency * 10000000 / m_qpcFrequency
+                );
+                if (now100ns >= qpcPosition) {
+                    const UINT64 latencyUs = (now100ns - qpcPosition) / 10;
+                    m_health->recordLatency(latencyUs);
+                    if (latencyUs > kLatePacketUs) {
+                        LOG_RT_WARNING("Late capture packet: {} frames, {} us old", numFramesAvailable, latencyUs);
+                    }
+                }
+            }
+        }
+        
         // Process audio data
         if (pData) {
             processAudioData(pData, numFramesAvailable, flags);
@@ -318,11 +381,19 @@ void WasapiCapture::processAudioData(BYTE* pData, UINT32 numFramesAvailable, DWO
         convertToFloat32(pData, m_floatBuffer.data(), numFramesAvailable);
     }
     
+    std::uint32_t dataFlags = 0;
+    if (flags & AUDCLNT_BUFFERFLAGS_SILENT) {
+        dataFlags |= kAudioDataSilent;
+    }
+    if (flags & AUDCLNT_BUFFERFLAGS_DATA_DISCONTINUITY) {
+        dataFlags |= kAudioDataDiscontinuity;
+    }
+    
     // Call registered callbacks
     std::lock_guard<std::mutex> lock(m_callbackMutex);
     for (IAudioDataCallback* callback : m_callbacks) {
         if (callback) {
-            callback->onAudioData(m_floatBuffer.data(), numFramesAvailable, m_format);
+            callback->onAudioData(m_floatBuffer.data(), numFramesAvailable, m_format, dataFlags);
         }
     }
 }
@@ -2,6 +2,7 @@
 
 #include "audio-engine-interface.h"
 #include "../../common/audio-format.h"
+#include "../../common/engine-health.h"
 
 #ifdef _WIN32
 
@@ -34,7 +35,10 @@ public:
     
     /**
      * Initialize WASAPI capture.
-     * Sets up COM, device enumeration, and audio client.
+     * Sets up device enumeration and the audio client. If the calling
+     * thread is not in the multithreaded apartment, joins it and leaves
+     * it again in shutdown(), which must then run on the same thread;
+     * callers that own the apartment themselves can use any thread.
      * 
      * @return true if initialization succeeded, false otherwise
      */
@@ -86,6 +90,14 @@ public:
      * @param callback Callback to remove
      */
     void unregisterCallback(IAudioDataCallback* callback);
+    
+    /**
+     * Set the counters that receive packet, discontinuity and latency stats.
+     * Must be called while not capturing.
+     * 
+     * @param counters Counters (must outlive capture), or nullptr to disable
+     */
+    void setHealthCounters(common::EngineHealthCounters* counters);
 
 private:
     /**
@@ -148,11 +160,15 @@ private:
     std::mutex m_callbackMutex;
     std::vector<IAudioDataCallback*> m_callbacks;
     
+    // Health counters (optional, written on capture thread)
+    common::EngineHealthCounters* m_health = nullptr;
+    LONGLONG m_qpcFrequency = 0;
+    
     // Conversion buffer (reused per capture)
     std::vector<float> m_floatBuffer;
     
-    // COM initialization flag
-    bool m_comInitialized = false;
+    bool m_initialized = false;
+    bool m_comInitialized = false;  // initialize() joined the apartment and must leave it
 };
 
 } // namespace openmeters::core::audio
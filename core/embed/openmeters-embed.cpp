@@ -0,0 +1,193 @@
+#include "openmeters-embed.h"
+#include "../../core/meters/meter-pipeline.h"
+#include "../../common/seqlock.h"
+#include <algorithm>
+#include <array>
+#include <new>
+
+using namespace openmeters;
+
+struct om_engine {
+    core::meters::MeterPipeline pipeline;
+    std::size_t maxFramesPerBlock = 0;
+
+    // Levels plus stream position, published together so readers see one block
+    common::SeqlockCell<om_levels> levels;
+    om_levels scratchLevels{};
+
+    om_levels_callback callback = nullptr;
+    void* userData = nullptr;
+};
+
+namespace {
+
+om_event toCEvent(const common::MeterEvent& event) noexcept {
+    om_event out{};
+    out.start_frame = event.startFrame;
+    out.length_frames = event.lengthFrames;
+    out.magnitude = event.magnitude;
+    out.type = static_cast<std::uint32_t>(event.type);
+    out.channel = event.channel;
+    return out;
+}
+
+void publishLevels(om_engine* engine, const common::MeterSnapshot& snapshot) noexcept {
+    om_levels& levels = engine->scratchLevels;
+    levels.version = engine->pipeline.snapshotVersion();
+    levels.timestamp_ms = snapshot.timestampMs;
+    levels.stream_frame = engine->pipeline.streamFrame();
+    levels.peak[0] = snapshot.peak.left;
+    levels.peak[1] = snapshot.peak.right;
+    levels.rms[0] = snapshot.rms.left;
+    levels.rms[1] = snapshot.rms.right;
+    engine->levels.store(levels);
+}
+
+} // namespace
+
+extern "C" {
+
+uint32_t om_embed_api_version(void) {
+    return OM_EMBED_API_VERSION;
+}
+
+om_engine* om_engine_create(uint32_t sample_rate, uint32_t channel_count, uint32_t max_frames_per_block) {
+    if (sample_rate == 0 || channel_count == 0 || channel_count > OM_EMBED_MAX_CHANNELS) {
+        return nullptr;
+    }
+    
+    common::AudioFormat format;
+    format.sampleRate = sample_rate;
+    format.channelCount = static_cast<common::ChannelCount>(channel_count);
+    
+    auto* engine = new (std::nothrow) om_engine();
+    if (!engine) {
+        return nullptr;
+    }
+    engine->maxFramesPerBlock = std::max<std::size_t>(max_frames_per_block, 1);
+    engine->scratchLevels.struct_size = sizeof(om_levels);
+    engine->scratchLevels.channel_count = channel_count;
+    
+    if (!engine->pipeline.prepare(format, engine->maxFramesPerBlock)) {
+        delete engine;
+        return nullptr;
+    }
+    publishLevels(engine, engine->pipeline.latestSnapshot());
+    return engine;
+}
+
+void om_engine_destroy(om_engine* engine) {
+    delete engine;
+}
+
+int om_engine_load_plugins(om_engine* engine, const char* directory) {
+    if (!engine || !directory) {
+        return OM_ERROR_INVALID_ARGUMENT;
+    }
+    
+    const std::size_t loaded = engine->pipeline.plugins().loadDirectory(directory);
+    
+    // New plugins need state and scratch; this also restarts the stream
+    engine->pipeline.prepare(engine->pipeline.getFormat(), engine->maxFramesPerBlock);
+    publishLevels(engine, engine->pipeline.latestSnapshot());
+    return static_cast<int>(loaded);
+}
+
+int om_engine_process(om_engine* engine, const float* interleaved, uint32_t frame_count) {
+    if (!engine || (!interleaved && frame_count > 0)) {
+        return OM_ERROR_INVALID_ARGUMENT;
+    }
+    if (frame_count == 0) {
+        return OM_OK;
+    }
+    
+    publishLevels(engine, engine->pipeline.process(interleaved, frame_count));
+    
+    if (engine->callback) {
+        engine->callback(engine->userData, &engine->scratchLevels);
+    }
+    return OM_OK;
+}
+
+void om_engine_reset(om_engine* engine) {
+    if (engine) {
+        // The pipeline publishes a zeroed snapshot under a new version
+        engine->pipeline.reset();
+        publishLevels(engine, engine->pipeline.latestSnapshot());
+    }
+}
+
+int om_engine_get_levels(const om_engine* engine, om_levels* out) {
+    if (!engine || !out || out->struct_size < sizeof(om_levels)) {
+        return OM_ERROR_INVALID_ARGUMENT;
+    }
+    *out = engine->levels.load();
+    return OM_OK;
+}
+
+uint64_t om_engine_snapshot_version(const om_engine* engine) {
+    return engine ? engine->pipeline.snapshotVersion() : 0;
+}
+
+om_event_cursor om_engine_event_cursor(const om_engine* engine) {
+    om_event_cursor cursor{};
+    if (engine) {
+        cursor.position = engine->pipeline.events().writePosition();
+    }
+    return cursor;
+}
+
+uint32_t om_engine_read_events(const om_engine* engine, om_event_cursor* cursor, om_event* out, uint32_t max_events) {
+    if (!engine || !cursor || !out) {
+        return 0;
+    }
+    
+    common::MeterEventRing::Cursor ringCursor{cursor->position, cursor->dropped};
+    std::array<common::MeterEvent, 64> batch;
+    uint32_t count = 0;
+    while (count < max_events) {
+        const std::size_t want = std::min<std::size_t>(batch.size(), max_events - count);
+        const std::size_t got = engine->pipeline.events().read(ringCursor, batch.data(), want);
+        for (std::size_t i = 0; i < got; ++i) {
+            out[count++] = toCEvent(batch[i]);
+        }
+        if (got < want) {
+            break;
+        }
+    }
+    cursor->position = ringCursor.position;
+    cursor->dropped = ringCursor.dropped;
+    return count;
+}
+
+int om_engine_set_levels_callback(om_engine* engine, om_levels_callback callback, void* user_data) {
+    if (!engine) {
+        return OM_ERROR_INVALID_ARGUMENT;
+    }
+    engine->callback = callback;
+    engine->userData = user_data;
+    return OM_OK;
+}
+
+uint32_t om_engine_plugin_count(const om_engine* engine) {
+    return engine ? static_cast<uint32_t>(engine->pipeline.plugins().pluginCount()) : 0;
+}
+
+const char* om_engine_plugin_id(const om_engine* engine, uint32_t index) {
+    if (!engine || index >= engine->pipeline.plugins().pluginCount()) {
+        return nullptr;
+    }
+    return engine->pipeline.plugins().descriptor(index).id;
+}
+
+int om_engine_plugin_outputs(const om_engine* engine, uint32_t index, float* out, uint32_t max_values) {
+    if (!engine || !out || index >= engine->pipeline.plugins().pluginCount()) {
+        return OM_ERROR_INVALID_ARGUMENT;
+    }
+    const core::plugins::PluginOutputs outputs = engine->pipeline.plugins().outputs(index);
+    const uint32_t count = std::min(outputs.valueCount, max_values);
+    std::copy_n(outputs.values.begin(), count, out);
+    return static_cast<int>(count);
+}
+
+} // extern "C"
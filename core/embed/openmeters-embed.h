@@ -0,0 +1,153 @@
+/*
+ * OpenMeters embedding API.
+ *
+ * Runs the metering pipeline inside a host application with no capture
+ * device and no threads of its own. The host pushes interleaved float blocks
+ * from its own audio thread; they are metered in place and never copied.
+ * Levels and events can then be read lock-free from any thread, or received
+ * through a callback on the pushing thread.
+ *
+ * Plain C so the library can be used from any language or runtime.
+ *
+ * Thread safety:
+ *  - om_engine_process() and om_engine_reset() from one thread at a time.
+ *  - om_engine_get_levels(), om_engine_snapshot_version() and
+ *    om_engine_read_events() from any thread, concurrently with processing.
+ *  - Everything else while no block is being processed.
+ */
+#ifndef OPENMETERS_EMBED_H
+#define OPENMETERS_EMBED_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define OM_EMBED_API_VERSION 1u
+#define OM_EMBED_MAX_CHANNELS 2
+
+#if defined(_WIN32)
+#if defined(OM_EMBED_BUILD)
+#define OM_EMBED_API __declspec(dllexport)
+#else
+#define OM_EMBED_API __declspec(dllimport)
+#endif
+#else
+#define OM_EMBED_API __attribute__((visibility("default")))
+#endif
+
+typedef struct om_engine om_engine;
+
+/* Result codes */
+#define OM_OK 0
+#define OM_ERROR_INVALID_ARGUMENT (-1)
+
+/* Latest levels, linear scale (1.0 = full scale). */
+typedef struct om_levels {
+    uint32_t struct_size;          /* Set by the caller to sizeof(om_levels) */
+    uint32_t channel_count;
+    uint64_t version;              /* Snapshot counter; changes with every block */
+    uint64_t timestamp_ms;         /* Since the engine was created or reset */
+    uint64_t stream_frame;         /* Frames processed since the engine was created or reset */
+    float peak[OM_EMBED_MAX_CHANNELS];
+    float rms[OM_EMBED_MAX_CHANNELS];
+} om_levels;
+
+/* Event kinds, matching the engine's event journal. */
+typedef enum om_event_type {
+    OM_EVENT_CLIP = 0,
+    OM_EVENT_INTER_SAMPLE_OVER = 1,
+    OM_EVENT_DROPOUT = 2
+} om_event_type;
+
+typedef struct om_event {
+    uint64_t start_frame;          /* Absolute stream position */
+    uint32_t length_frames;
+    float magnitude;               /* Largest (estimated) absolute value */
+    uint32_t type;                 /* om_event_type */
+    uint32_t channel;
+} om_event;
+
+/* Per-reader position in the event journal. Initialise with om_engine_event_cursor(). */
+typedef struct om_event_cursor {
+    uint64_t position;
+    uint64_t dropped;              /* Events overwritten before this reader saw them */
+} om_event_cursor;
+
+/*
+ * Called on the pushing thread after every processed block. Must not block.
+ */
+typedef void (*om_levels_callback)(void* user_data, const om_levels* levels);
+
+/* OM_EMBED_API_VERSION the library was built with. */
+OM_EMBED_API uint32_t om_embed_api_version(void);
+
+/*
+ * Create an engine for one stream.
+ *
+ * @param max_frames_per_block Largest block the host will push (sizes plugin scratch)
+ * @return NULL if the format is unsupported (1-2 channels)
+ */
+OM_EMBED_API om_engine* om_engine_create(uint32_t sample_rate, uint32_t channel_count,
+                                         uint32_t max_frames_per_block);
+
+OM_EMBED_API void om_engine_destroy(om_engine* engine);
+
+/*
+ * Load meter plugins (see plugin-abi.h) from every shared library in a directory.
+ *
+ * @return Number of plugins loaded, or a negative error code
+ */
+OM_EMBED_API int om_engine_load_plugins(om_engine* engine, const char* directory);
+
+/*
+ * Meter one block of interleaved samples. Real-time safe: no allocation,
+ * locks or I/O (plugins permitting). The buffer is only read during the call.
+ */
+OM_EMBED_API int om_engine_process(om_engine* engine, const float* interleaved, uint32_t frame_count);
+
+/*
+ * Restart stream positions, detector and plugin state (e.g. after a seek).
+ * Published levels drop to zero and their version advances, so hosts
+ * polling om_engine_snapshot_version() see the reset.
+ */
+OM_EMBED_API void om_engine_reset(om_engine* engine);
+
+/* Copy the latest levels. Lock-free. */
+OM_EMBED_API int om_engine_get_levels(const om_engine* engine, om_levels* out);
+
+/* Cheap change check: compare with om_levels.version. Lock-free. */
+OM_EMBED_API uint64_t om_engine_snapshot_version(const om_engine* engine);
+
+/* Cursor that sees only events detected from now on. */
+OM_EMBED_API om_event_cursor om_engine_event_cursor(const om_engine* engine);
+
+/*
+ * Read events after the cursor and advance it. Lock-free.
+ *
+ * @return Number of events written to out
+ */
+OM_EMBED_API uint32_t om_engine_read_events(const om_engine* engine, om_event_cursor* cursor,
+                                            om_event* out, uint32_t max_events);
+
+/* Install (or clear, with NULL) the per-block levels callback. */
+OM_EMBED_API int om_engine_set_levels_callback(om_engine* engine, om_levels_callback callback,
+                                               void* user_data);
+
+/* Number of loaded plugins, and the latest outputs of one of them. */
+OM_EMBED_API uint32_t om_engine_plugin_count(const om_engine* engine);
+OM_EMBED_API const char* om_engine_plugin_id(const om_engine* engine, uint32_t index);
+
+/*
+ * @return Number of values written to out, or a negative error code
+ */
+OM_EMBED_API int om_engine_plugin_outputs(const om_engine* engine, uint32_t index,
+                                          float* out, uint32_t max_values);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* OPENMETERS_EMBED_H */
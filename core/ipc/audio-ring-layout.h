@@ -0,0 +1,82 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+
+namespace openmeters::core::ipc {
+
+/**
+ * Default name of the raw audio ring region.
+ */
+inline constexpr const char* kDefaultAudioRingName = "openmeters.audio";
+
+inline constexpr std::uint32_t kAudioRingMagic = 0x524D4D4F; // "OMMR"
+inline constexpr std::uint16_t kAudioRingVersion = 1;
+
+/**
+ * Block flags.
+ */
+inline constexpr std::uint32_t kAudioBlockSilent = 1u << 0;        // Device reported silence
+inline constexpr std::uint32_t kAudioBlockDiscontinuity = 1u << 1; // Gap before this block
+
+/**
+ * Region header. Followed by blockCount slots of slotStride bytes each,
+ * starting at offset firstSlotOffset.
+ */
+struct SharedAudioRingHeader {
+    std::atomic<std::uint32_t> magic{0};
+    std::uint16_t version = 0;
+    std::uint16_t reserved = 0;
+    std::uint32_t blockCount = 0;        // Power of two
+    std::uint32_t maxFramesPerBlock = 0;
+    std::uint32_t maxChannels = 0;
+    std::uint32_t slotStride = 0;        // Bytes per slot, 64-byte aligned
+    std::uint32_t firstSlotOffset = 0;
+    std::uint32_t writerProcessId = 0;
+    std::uint64_t regionSize = 0;
+
+    alignas(64) std::atomic<std::uint64_t> writeSequence{0}; // Blocks published so far
+
+    alignas(64) std::atomic<std::uint32_t> wakeCounter{0};   // Futex word
+    std::atomic<std::uint32_t> waiters{0};                   // Readers blocked in wait()
+};
+
+/**
+ * Per-slot header, followed by frameCount * channelCount interleaved floats.
+ * sequence is 2 * blockIndex + 2 once the slot holds block blockIndex, and
+ * odd while the writer is filling it.
+ */
+struct SharedAudioBlockHeader {
+    std::atomic<std::uint64_t> sequence{0};
+    std::uint64_t streamFrame = 0;  // Absolute position of the first frame
+    std::uint32_t frameCount = 0;
+    std::uint32_t channelCount = 0;
+    std::uint32_t sampleRate = 0;
+    std::uint32_t flags = 0;
+};
+
+/**
+ * Round up to the 64-byte slot alignment.
+ */
+[[nodiscard]] constexpr std::size_t alignAudioRing(std::size_t value) noexcept {
+    return (value + 63) & ~static_cast<std::size_t>(63);
+}
+
+/**
+ * Bytes per slot for the given block geometry.
+ */
+[[nodiscard]] constexpr std::size_t audioRingSlotStride(std::uint32_t maxFramesPerBlock, std::uint32_t maxChannels) noexcept {
+    return alignAudioRing(sizeof(SharedAudioBlockHeader)) +
+           alignAudioRing(static_cast<std::size_t>(maxFramesPerBlock) * maxChannels * sizeof(float));
+}
+
+/**
+ * Total region size for the given ring geometry.
+ */
+[[nodiscard]] constexpr std::size_t audioRingRegionSize(std::uint32_t blockCount, std::uint32_t maxFramesPerBlock, std::uint32_t maxChannels) noexcept {
+    return alignAudioRing(sizeof(SharedAudioRingHeader)) +
+           static_cast<std::size_t>(blockCount) * audioRingSlotStride(maxFramesPerBlock, maxChannels);
+}
+
+} // namespace openmeters::core::ipc
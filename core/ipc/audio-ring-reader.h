@@ -0,0 +1,226 @@
+#pragma once
+
+#include "shared-memory.h"
+#include "wake-signal.h"
+#include "audio-ring-layout.h"
+#include <cstring>
+#include <string>
+
+namespace openmeters::core::ipc {
+
+/**
+ * Header-only reader for the engine's shared raw audio ring.
+ *
+ * Blocks are handed out in place (zero-copy). Because the writer never
+ * waits, a block can be overwritten while a slow reader is still using it:
+ * call isValid() after consuming a view, or use copyNext() which validates
+ * for you.
+ *
+ * Usage:
+ *   AudioRingReader reader;
+ *   reader.open();
+ *   auto cursor = reader.tail();
+ *   for (;;) {
+ *       AudioBlockView block;
+ *       while (reader.next(cursor, block)) {
+ *           consume(block);
+ *           if (!reader.isValid(block)) { discard(block); }
+ *       }
+ *       reader.waitForData(cursor, 100);
+ *   }
+ *
+ * Thread safety: Not thread-safe. One reader per thread.
+ */
+class AudioRingReader {
+public:
+    /**
+     * Per-reader position. Cursors live in the reader process, so any
+     * number of readers can follow the ring independently.
+     */
+    struct Cursor {
+        std::uint64_t position = 0;
+        std::uint64_t droppedBlocks = 0; // Blocks lost to overruns
+    };
+
+    /**
+     * In-place view of one block.
+     */
+    struct AudioBlockView {
+        const float* samples = nullptr; // Interleaved, frameCount * channelCount
+        std::uint64_t streamFrame = 0;
+        std::uint32_t frameCount = 0;
+        std::uint32_t channelCount = 0;
+        std::uint32_t sampleRate = 0;
+        std::uint32_t flags = 0;
+        std::uint64_t sequence = 0;     // Block index in the ring
+    };
+
+    ~AudioRingReader() { close(); }
+
+    /**
+     * Attach to a published ring.
+     *
+     * @param name Region name used by the engine
+     * @return true if the ring exists and has a compatible layout
+     */
+    bool open(const std::string& name = kDefaultAudioRingName) {
+        close();
+
+        // Map the header first to learn the full region size
+        if (!m_region.open(name, sizeof(SharedAudioRingHeader), true)) {
+            return false;
+        }
+        const auto* header = static_cast<const SharedAudioRingHeader*>(m_region.data());
+        if (header->magic.load(std::memory_order_acquire) != kAudioRingMagic ||
+            header->version != kAudioRingVersion) {
+            close();
+            return false;
+        }
+        const auto regionSize = static_cast<std::size_t>(header->regionSize);
+
+        if (!m_region.open(name, regionSize, true)) {
+            return false;
+        }
+
+        m_header = static_cast<SharedAudioRingHeader*>(m_region.data());
+        m_slots = static_cast<const std::uint8_t*>(m_region.data()) + m_header->firstSlotOffset;
+        return m_wake.attach(name, &m_header->wakeCounter, &m_header->waiters);
+    }
+
+    void close() {
+        m_wake.detach();
+        m_region.close();
+        m_header = nullptr;
+        m_slots = nullptr;
+    }
+
+    [[nodiscard]] bool isOpen() const noexcept { return m_header != nullptr; }
+
+    /**
+     * False once the writer has closed the ring.
+     */
+    [[nodiscard]] bool isLive() const noexcept {
+        return m_header && m_header->magic.load(std::memory_order_acquire) == kAudioRingMagic;
+    }
+
+    /**
+     * Cursor positioned at the next block to be written.
+     */
+    [[nodiscard]] Cursor tail() const noexcept {
+        return Cursor{m_header ? m_header->writeSequence.load(std::memory_order_acquire) : 0, 0};
+    }
+
+    /**
+     * Get the next unread block in place and advance the cursor.
+     *
+     * @return false if no block is available
+     */
+    bool next(Cursor& cursor, AudioBlockView& view) const noexcept {
+        if (!m_header) {
+            return false;
+        }
+
+        for (;;) {
+            const std::uint64_t written = m_header->writeSequence.load(std::memory_order_acquire);
+            if (cursor.position >= written) {
+                return false;
+            }
+
+            // Overrun: skip to the oldest block still in the ring
+            if (written - cursor.position > m_header->blockCount) {
+                const std::uint64_t oldest = written - m_header->blockCount;
+                cursor.droppedBlocks += oldest - cursor.position;
+                cursor.position = oldest;
+            }
+
+            const auto* block = blockAt(cursor.position);
+            if (block->sequence.load(std::memory_order_acquire) != cursor.position * 2 + 2) {
+                ++cursor.position;
+                ++cursor.droppedBlocks;
+                continue;
+            }
+
+            view.samples = reinterpret_cast<const float*>(
+                reinterpret_cast<const std::uint8_t*>(block) + alignAudioRing(sizeof(SharedAudioBlockHeader)));
+            view.streamFrame = block->streamFrame;
+            view.frameCount = block->frameCount;
+            view.channelCount = block->channelCount;
+            view.sampleRate = block->sampleRate;
+            view.flags = block->flags;
+            view.sequence = cursor.position;
+
+            ++cursor.position;
+            if (!isValid(view)) {
+                ++cursor.droppedBlocks;
+                continue;
+            }
+            return true;
+        }
+    }
+
+    /**
+     * Check that a view was not overwritten while it was being used.
+     */
+    [[nodiscard]] bool isValid(const AudioBlockView& view) const noexcept {
+        if (!m_header) {
+            return false;
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return blockAt(view.sequence)->sequence.load(std::memory_order_relaxed) == view.sequence * 2 + 2;
+    }
+
+    /**
+     * Copy the next block out of the ring.
+     *
+     * @param out Destination for interleaved samples
+     * @param maxSamples Capacity of out (blocks that do not fit are skipped)
+     * @param info Receives the block description; info.samples points to out
+     * @return false if no block is available
+     */
+    bool copyNext(Cursor& cursor, float* out, std::size_t maxSamples, AudioBlockView& info) const noexcept {
+        AudioBlockView view;
+        while (next(cursor, view)) {
+            const std::size_t samples = static_cast<std::size_t>(view.frameCount) * view.channelCount;
+            if (samples > maxSamples) {
+                ++cursor.droppedBlocks;
+                continue;
+            }
+            std::memcpy(out, view.samples, samples * sizeof(float));
+            if (!isValid(view)) {
+                ++cursor.droppedBlocks;
+                continue;
+            }
+            info = view;
+            info.samples = out;
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * Block until new data arrives past the cursor or the timeout expires.
+     */
+    void waitForData(const Cursor& cursor, std::uint32_t timeoutMs) noexcept {
+        if (!m_header) {
+            return;
+        }
+        const std::uint32_t expected = m_wake.counter();
+        if (m_header->writeSequence.load(std::memory_order_acquire) > cursor.position || !isLive()) {
+            return;
+        }
+        m_wake.wait(expected, timeoutMs);
+    }
+
+private:
+    [[nodiscard]] const SharedAudioBlockHeader* blockAt(std::uint64_t sequence) const noexcept {
+        const std::uint64_t index = sequence & (m_header->blockCount - 1);
+        return reinterpret_cast<const SharedAudioBlockHeader*>(m_slots + index * m_header->slotStride);
+    }
+
+    SharedMemoryRegion m_region;
+    SharedWakeSignal m_wake;
+    SharedAudioRingHeader* m_header = nullptr;
+    const std::uint8_t* m_slots = nullptr;
+};
+
+} // namespace openmeters::core::ipc
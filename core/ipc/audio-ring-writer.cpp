@@ -0,0 +1,130 @@
+#include "audio-ring-writer.h"
+#include "../../common/logger.h"
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+namespace openmeters::core::ipc {
+
+namespace {
+
+std::uint32_t roundUpToPowerOfTwo(std::uint32_t value) {
+    std::uint32_t result = 1;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+std::uint32_t currentProcessId() {
+#ifdef _WIN32
+    return static_cast<std::uint32_t>(GetCurrentProcessId());
+#else
+    return static_cast<std::uint32_t>(getpid());
+#endif
+}
+
+} // namespace
+
+AudioRingWriter::~AudioRingWriter() {
+    close();
+}
+
+bool AudioRingWriter::open(const std::string& name, const AudioRingSettings& settings) {
+    close();
+
+    if (settings.maxFramesPerBlock == 0 || settings.maxChannels == 0) {
+        return false;
+    }
+
+    const std::uint32_t blockCount = roundUpToPowerOfTwo(std::max<std::uint32_t>(settings.blockCount, 2));
+    const std::size_t regionSize = audioRingRegionSize(blockCount, settings.maxFramesPerBlock, settings.maxChannels);
+
+    if (!m_region.create(name, regionSize)) {
+        LOG_ERROR("Failed to create shared audio ring: {}", name);
+        return false;
+    }
+
+    auto* base = static_cast<std::uint8_t*>(m_region.data());
+    m_header = new (base) SharedAudioRingHeader();
+    m_header->version = kAudioRingVersion;
+    m_header->blockCount = blockCount;
+    m_header->maxFramesPerBlock = settings.maxFramesPerBlock;
+    m_header->maxChannels = settings.maxChannels;
+    m_header->slotStride = static_cast<std::uint32_t>(audioRingSlotStride(settings.maxFramesPerBlock, settings.maxChannels));
+    m_header->firstSlotOffset = static_cast<std::uint32_t>(alignAudioRing(sizeof(SharedAudioRingHeader)));
+    m_header->writerProcessId = currentProcessId();
+    m_header->regionSize = regionSize;
+
+    m_slots = base + m_header->firstSlotOffset;
+    for (std::uint32_t i = 0; i < blockCount; ++i) {
+        new (m_slots + static_cast<std::size_t>(i) * m_header->slotStride) SharedAudioBlockHeader();
+    }
+
+    if (!m_wake.attach(name, &m_header->wakeCounter, &m_header->waiters)) {
+        LOG_ERROR("Failed to create shared audio ring wake signal: {}", name);
+        close();
+        return false;
+    }
+
+    m_header->magic.store(kAudioRingMagic, std::memory_order_release);
+
+    LOG_INFO("Publishing raw audio to shared memory: {} ({} blocks of {} frames)",
+             name, blockCount, settings.maxFramesPerBlock);
+    return true;
+}
+
+void AudioRingWriter::close() {
+    if (m_header) {
+        m_header->magic.store(0, std::memory_order_release);
+        m_wake.notify(); // Let blocked readers notice the ring is gone
+        m_header = nullptr;
+    }
+    m_wake.detach();
+    m_slots = nullptr;
+    m_region.close();
+}
+
+void AudioRingWriter::write(
+    const float* buffer,
+    std::size_t frameCount,
+    const common::AudioFormat& format,
+    std::uint64_t streamFrame,
+    std::uint32_t flags
+) noexcept {
+    if (!m_header || !buffer || frameCount == 0 || !format.isValid() ||
+        format.channelCount > m_header->maxChannels) {
+        return;
+    }
+
+    const std::size_t samplesPerFrame = format.samplesPerFrame();
+    const std::uint64_t mask = m_header->blockCount - 1;
+    std::uint64_t sequence = m_header->writeSequence.load(std::memory_order_relaxed);
+
+    // Split into slot-sized blocks
+    for (std::size_t offset = 0; offset < frameCount; offset += m_header->maxFramesPerBlock) {
+        const std::size_t frames = std::min<std::size_t>(m_header->maxFramesPerBlock, frameCount - offset);
+
+        std::uint8_t* slot = m_slots + (sequence & mask) * m_header->slotStride;
+        auto* block = reinterpret_cast<SharedAudioBlockHeader*>(slot);
+        auto* samples = reinterpret_cast<float*>(slot + alignAudioRing(sizeof(SharedAudioBlockHeader)));
+
+        block->sequence.store(sequence * 2 + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        block->streamFrame = streamFrame + offset;
+        block->frameCount = static_cast<std::uint32_t>(frames);
+        block->channelCount = format.channelCount;
+        block->sampleRate = format.sampleRate;
+        block->flags = offset == 0 ? flags : (flags & ~kAudioBlockDiscontinuity);
+        std::memcpy(samples, buffer + offset * samplesPerFrame, frames * samplesPerFrame * sizeof(float));
+
+        block->sequence.store(sequence * 2 + 2, std::memory_order_release);
+        ++sequence;
+    }
+
+    m_header->writeSequence.store(sequence, std::memory_order_release);
+    m_wake.notify();
+}
+
+} // namespace openmeters::core::ipc
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "shared-memory.h"
+#include "wake-signal.h"
+#include "audio-ring-layout.h"
+#include "../../common/audio-format.h"
+#include <string>
+
+namespace openmeters::core::ipc {
+
+/**
+ * Shared audio ring geometry.
+ */
+struct AudioRingSettings {
+    std::uint32_t blockCount = 64;          // Rounded up to a power of two
+    std::uint32_t maxFramesPerBlock = 1024; // Larger buffers are split
+    std::uint32_t maxChannels = 2;
+};
+
+/**
+ * Single writer for the shared raw audio ring.
+ * Copies each captured block once into shared memory and wakes any waiting
+ * readers (see audio-ring-reader.h). The writer never waits for readers;
+ * slow readers detect the overrun through their cursor.
+ *
+ * Thread safety: open/close from one thread; write() from the audio thread
+ * only, and only while open.
+ */
+class AudioRingWriter {
+public:
+    AudioRingWriter() = default;
+    ~AudioRingWriter();
+
+    // Non-copyable, non-movable
+    AudioRingWriter(const AudioRingWriter&) = delete;
+    AudioRingWriter& operator=(const AudioRingWriter&) = delete;
+    AudioRingWriter(AudioRingWriter&&) = delete;
+    AudioRingWriter& operator=(AudioRingWriter&&) = delete;
+
+    /**
+     * Create and initialise the shared ring.
+     *
+     * @param name Region name (without platform prefix)
+     * @param settings Ring geometry
+     * @return true if the ring is ready for writing
+     */
+    bool open(const std::string& name = kDefaultAudioRingName, const AudioRingSettings& settings = AudioRingSettings());
+
+    /**
+     * Unmap and remove the ring.
+     */
+    void close();
+
+    [[nodiscard]] bool isOpen() const noexcept { return m_header != nullptr; }
+
+    /**
+     * Append interleaved audio. No allocation; one syscall at most, and only
+     * when a reader is blocked waiting.
+     *
+     * @param buffer Interleaved samples
+     * @param frameCount Number of frames
+     * @param format Audio format descriptor
+     * @param streamFrame Absolute position of the first frame
+     * @param flags kAudioBlock* flags for this buffer
+     */
+    void write(
+        const float* buffer,
+        std::size_t frameCount,
+        const common::AudioFormat& format,
+        std::uint64_t streamFrame,
+        std::uint32_t flags = 0
+    ) noexcept;
+
+private:
+    SharedMemoryRegion m_region;
+    SharedWakeSignal m_wake;
+    SharedAudioRingHeader* m_header = nullptr;
+    std::uint8_t* m_slots = nullptr;
+};
+
+} // namespace openmeters::core::ipc
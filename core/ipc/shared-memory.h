@@ -0,0 +1,221 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace openmeters::core::ipc {
+
+/**
+ * Named shared-memory region.
+ * Backed by a pagefile file mapping ("Local\\<name>") on Windows and a POSIX
+ * shared memory object ("/<name>") elsewhere.
+ *
+ * Header-only so that external reader processes need nothing but this
+ * directory to attach to the engine's regions.
+ *
+ * The creating side holds an owner lock for as long as the region is open
+ * (an flock on the shared memory object, a named mutex on Windows), so a
+ * second writer for the same name fails instead of scribbling over a live
+ * region. A name left behind by a writer that died is unlocked and reused.
+ *
+ * Thread safety: Not thread-safe. Open and close from a single thread.
+ */
+class SharedMemoryRegion {
+public:
+    SharedMemoryRegion() = default;
+    ~SharedMemoryRegion() { close(); }
+
+    // Non-copyable, non-movable (the mapping address is handed out)
+    SharedMemoryRegion(const SharedMemoryRegion&) = delete;
+    SharedMemoryRegion& operator=(const SharedMemoryRegion&) = delete;
+    SharedMemoryRegion(SharedMemoryRegion&&) = delete;
+    SharedMemoryRegion& operator=(SharedMemoryRegion&&) = delete;
+
+    /**
+     * Create a region and map it read-write.
+     * Fails if another writer owns the name; a stale name left behind by a
+     * writer that exited without close() is taken over. The creating side
+     * removes the name again on close().
+     *
+     * @param name Region name without platform prefix
+     * @param size Region size in bytes
+     * @return true if the region is mapped
+     */
+    bool create(const std::string& name, std::size_t size) {
+        return map(name, size, true, true);
+    }
+
+    /**
+     * Map an existing region created by another process.
+     *
+     * @param name Region name without platform prefix
+     * @param size Expected region size in bytes
+     * @param writable Map read-write instead of read-only
+     * @return true if the region is mapped
+     */
+    bool open(const std::string& name, std::size_t size, bool writable = false) {
+        return map(name, size, false, writable);
+    }
+
+    /**
+     * Unmap the region (and remove its name if we created it).
+     */
+    void close() {
+#ifdef _WIN32
+        if (m_data) {
+            UnmapViewOfFile(m_data);
+        }
+        if (m_mapping) {
+            CloseHandle(m_mapping);
+            m_mapping = nullptr;
+        }
+        if (m_ownerLock) {
+            if (m_owner) {
+                ReleaseMutex(m_ownerLock);
+            }
+            CloseHandle(m_ownerLock);
+            m_ownerLock = nullptr;
+        }
+#else
+        if (m_data) {
+            munmap(m_data, m_size);
+        }
+        // Unlink while still holding the lock so a writer that takes the name
+        // over in between never has its fresh region removed under it
+        if (m_owner) {
+            shm_unlink(m_platformName.c_str());
+        }
+        if (m_fd >= 0) {
+            ::close(m_fd);
+            m_fd = -1;
+        }
+#endif
+        m_data = nullptr;
+        m_size = 0;
+        m_owner = false;
+    }
+
+    [[nodiscard]] bool isOpen() const noexcept { return m_data != nullptr; }
+    [[nodiscard]] void* data() const noexcept { return m_data; }
+    [[nodiscard]] std::size_t size() const noexcept { return m_size; }
+
+private:
+    bool map(const std::string& name, std::size_t size, bool create, bool writable) {
+        close();
+        if (name.empty() || size == 0) {
+            return false;
+        }
+
+#ifdef _WIN32
+        m_platformName = "Local\\" + name;
+        if (create) {
+            // A mutex left owned by a process that exited reports WAIT_ABANDONED
+            // and is ours to take; WAIT_TIMEOUT means another writer is live
+            const std::string lockName = m_platformName + ".owner";
+            m_ownerLock = CreateMutexA(nullptr, FALSE, lockName.c_str());
+            if (!m_ownerLock) {
+                return false;
+            }
+            const DWORD wait = WaitForSingleObject(m_ownerLock, 0);
+            if (wait != WAIT_OBJECT_0 && wait != WAIT_ABANDONED) {
+                close();
+                return false;
+            }
+            m_owner = true;
+
+            const auto size64 = static_cast<unsigned long long>(size);
+            m_mapping = CreateFileMappingA(
+                INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+                static_cast<DWORD>(size64 >> 32), static_cast<DWORD>(size64 & 0xFFFFFFFFull),
+                m_platformName.c_str()
+            );
+        } else {
+            m_mapping = OpenFileMappingA(
+                writable ? FILE_MAP_ALL_ACCESS : FILE_MAP_READ, FALSE, m_platformName.c_str()
+            );
+        }
+        if (!m_mapping) {
+            close();
+            return false;
+        }
+
+        m_data = MapViewOfFile(m_mapping, writable ? FILE_MAP_ALL_ACCESS : FILE_MAP_READ, 0, 0, size);
+        if (!m_data) {
+            close();
+            return false;
+        }
+#else
+        m_platformName = "/" + name;
+        if (create) {
+            // O_EXCL for a fresh name; an existing one is only reused if no
+            // live writer holds its lock
+            m_fd = shm_open(m_platformName.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+            if (m_fd < 0 && errno == EEXIST) {
+                m_fd = shm_open(m_platformName.c_str(), O_RDWR, 0600);
+            }
+        } else {
+            m_fd = shm_open(m_platformName.c_str(), writable ? O_RDWR : O_RDONLY, 0600);
+        }
+        if (m_fd < 0) {
+            return false;
+        }
+
+        if (create) {
+            if (flock(m_fd, LOCK_EX | LOCK_NB) != 0) {
+                close();
+                return false;
+            }
+            m_owner = true;
+
+            if (ftruncate(m_fd, static_cast<off_t>(size)) != 0) {
+                close();
+                return false;
+            }
+        } else {
+            struct stat info {};
+            if (fstat(m_fd, &info) != 0 || static_cast<std::size_t>(info.st_size) < size) {
+                close();
+                return false;
+            }
+        }
+
+        void* data = mmap(nullptr, size, writable ? (PROT_READ | PROT_WRITE) : PROT_READ, MAP_SHARED, m_fd, 0);
+        if (data == MAP_FAILED) {
+            close();
+            return false;
+        }
+        m_data = data;
+#endif
+
+        m_size = size;
+        return true;
+    }
+
+    void* m_data = nullptr;
+    std::size_t m_size = 0;
+    bool m_owner = false;
+    std::string m_platformName;
+
+#ifdef _WIN32
+    HANDLE m_mapping = nullptr;
+    HANDLE m_ownerLock = nullptr;
+#else
+    int m_fd = -1;
+#endif
+};
+
+} // namespace openmeters::core::ipc
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "../../common/seqlock.h"
+#include <cstdint>
+
+namespace openmeters::core::ipc {
+
+/**
+ * Default name of the meter snapshot region.
+ */
+inline constexpr const char* kDefaultSnapshotRegionName = "openmeters.snapshots";
+
+inline constexpr std::uint32_t kSnapshotRegionMagic = 0x53534D4F; // "OMSS"
+inline constexpr std::uint16_t kSnapshotRegionVersion = 1;
+
+/**
+ * Meter values as published to other processes.
+ * Fixed-size POD with explicit widths; new fields go at the end and bump
+ * kSnapshotRegionVersion.
+ */
+struct SharedMeterSnapshot {
+    std::uint64_t timestampMs = 0;  // Milliseconds since capture start
+    std::uint64_t streamFrame = 0;  // Absolute frame position after this block
+    std::uint64_t eventCount = 0;   // Total meter events journaled so far
+    std::uint32_t sampleRate = 0;
+    std::uint32_t channelCount = 0;
+    float peak[2] = {0.0f, 0.0f};
+    float rms[2] = {0.0f, 0.0f};
+};
+
+/**
+ * Region layout: a small header followed by one seqlock-protected snapshot.
+ * The writer sets magic last, so readers that see the magic also see a
+ * fully initialised header.
+ */
+struct SharedSnapshotRegion {
+    std::atomic<std::uint32_t> magic{0};
+    std::uint16_t version = 0;
+    std::uint16_t headerSize = 0;
+    std::uint32_t regionSize = 0;
+    std::uint32_t writerProcessId = 0;
+
+    common::SeqlockCell<SharedMeterSnapshot> snapshot;
+};
+
+} // namespace openmeters::core::ipc
@@ -0,0 +1,76 @@
+#include "snapshot-publisher.h"
+#include "../../common/logger.h"
+#include <cstddef>
+#include <new>
+
+namespace openmeters::core::ipc {
+
+namespace {
+
+std::uint32_t currentProcessId() {
+#ifdef _WIN32
+    return static_cast<std::uint32_t>(GetCurrentProcessId());
+#else
+    return static_cast<std::uint32_t>(getpid());
+#endif
+}
+
+} // namespace
+
+SnapshotPublisher::~SnapshotPublisher() {
+    close();
+}
+
+bool SnapshotPublisher::open(const std::string& name) {
+    close();
+
+    if (!m_region.create(name, sizeof(SharedSnapshotRegion))) {
+        LOG_ERROR("Failed to create shared snapshot region: {}", name);
+        return false;
+    }
+
+    // Fresh layout (the name may be left over from a previous run)
+    m_layout = new (m_region.data()) SharedSnapshotRegion();
+    m_layout->version = kSnapshotRegionVersion;
+    m_layout->headerSize = static_cast<std::uint16_t>(offsetof(SharedSnapshotRegion, snapshot));
+    m_layout->regionSize = static_cast<std::uint32_t>(sizeof(SharedSnapshotRegion));
+    m_layout->writerProcessId = currentProcessId();
+    m_layout->magic.store(kSnapshotRegionMagic, std::memory_order_release);
+
+    LOG_INFO("Publishing meter snapshots to shared memory: {}", name);
+    return true;
+}
+
+void SnapshotPublisher::close() {
+    if (m_layout) {
+        m_layout->magic.store(0, std::memory_order_release);
+        m_layout = nullptr;
+    }
+    m_region.close();
+}
+
+void SnapshotPublisher::publish(
+    const common::MeterSnapshot& snapshot,
+    const common::AudioFormat& format,
+    std::uint64_t streamFrame,
+    std::uint64_t eventCount
+) noexcept {
+    if (!m_layout) {
+        return;
+    }
+
+    SharedMeterSnapshot shared;
+    shared.timestampMs = snapshot.timestampMs;
+    shared.streamFrame = streamFrame;
+    shared.eventCount = eventCount;
+    shared.sampleRate = format.sampleRate;
+    shared.channelCount = format.channelCount;
+    shared.peak[0] = snapshot.peak.left;
+    shared.peak[1] = snapshot.peak.right;
+    shared.rms[0] = snapshot.rms.left;
+    shared.rms[1] = snapshot.rms.right;
+
+    m_layout->snapshot.store(shared);
+}
+
+} // namespace openmeters::core::ipc
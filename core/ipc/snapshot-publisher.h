@@ -0,0 +1,65 @@
+#pragma once
+
+#include "shared-memory.h"
+#include "snapshot-layout.h"
+#include "../../common/audio-format.h"
+#include "../../common/meter-values.h"
+#include <string>
+
+namespace openmeters::core::ipc {
+
+/**
+ * Publishes meter snapshots into a named shared-memory region.
+ * Each publish is a seqlock write into mapped memory; readers in other
+ * processes (see snapshot-reader.h) never slow the writer down.
+ *
+ * Thread safety: open/close from one thread; publish() from the audio
+ * thread only, and only while open.
+ */
+class SnapshotPublisher {
+public:
+    SnapshotPublisher() = default;
+    ~SnapshotPublisher();
+
+    // Non-copyable, non-movable
+    SnapshotPublisher(const SnapshotPublisher&) = delete;
+    SnapshotPublisher& operator=(const SnapshotPublisher&) = delete;
+    SnapshotPublisher(SnapshotPublisher&&) = delete;
+    SnapshotPublisher& operator=(SnapshotPublisher&&) = delete;
+
+    /**
+     * Create and initialise the shared region.
+     *
+     * @param name Region name (without platform prefix)
+     * @return true if the region is ready for publishing
+     */
+    bool open(const std::string& name = kDefaultSnapshotRegionName);
+
+    /**
+     * Unmap and remove the region.
+     */
+    void close();
+
+    [[nodiscard]] bool isOpen() const noexcept { return m_region.isOpen(); }
+
+    /**
+     * Publish a snapshot. Wait-free, no syscalls.
+     *
+     * @param snapshot Meter values
+     * @param format Format of the block the values were computed from
+     * @param streamFrame Absolute frame position after the block
+     * @param eventCount Total meter events journaled so far
+     */
+    void publish(
+        const common::MeterSnapshot& snapshot,
+        const common::AudioFormat& format,
+        std::uint64_t streamFrame,
+        std::uint64_t eventCount
+    ) noexcept;
+
+private:
+    SharedMemoryRegion m_region;
+    SharedSnapshotRegion* m_layout = nullptr;
+};
+
+} // namespace openmeters::core::ipc
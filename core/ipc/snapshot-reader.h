@@ -0,0 +1,98 @@
+#pragma once
+
+#include "shared-memory.h"
+#include "snapshot-layout.h"
+#include <string>
+
+namespace openmeters::core::ipc {
+
+/**
+ * Header-only reader for the engine's shared snapshot region.
+ *
+ * Polling is a handful of loads from mapped memory: no syscalls, no locks,
+ * and nothing the engine ever waits on. Any number of readers may attach.
+ *
+ * Usage:
+ *   SnapshotReader reader;
+ *   if (reader.open()) {
+ *       SharedMeterSnapshot s;
+ *       if (reader.read(s)) { ... }
+ *   }
+ *
+ * Thread safety: Not thread-safe. One reader per thread.
+ */
+class SnapshotReader {
+public:
+    /**
+     * Attach to a published region.
+     *
+     * @param name Region name used by the engine
+     * @return true if the region exists and has a compatible layout
+     */
+    bool open(const std::string& name = kDefaultSnapshotRegionName) {
+        if (!m_region.open(name, sizeof(SharedSnapshotRegion))) {
+            return false;
+        }
+
+        if (!headerValid() || layout()->regionSize < sizeof(SharedSnapshotRegion)) {
+            m_region.close();
+            return false;
+        }
+
+        return true;
+    }
+
+    void close() { m_region.close(); }
+
+    [[nodiscard]] bool isOpen() const noexcept { return m_region.isOpen(); }
+
+    /**
+     * Read the latest snapshot.
+     *
+     * @param out Destination snapshot
+     * @return false if not attached, nothing published yet, the writer has
+     *         closed or re-initialised the region, or it kept racing us for
+     *         the whole retry budget
+     */
+    bool read(SharedMeterSnapshot& out) const noexcept {
+        if (!isOpen()) {
+            return false;
+        }
+
+        const auto& cell = layout()->snapshot;
+        for (int attempt = 0; attempt < 64; ++attempt) {
+            // The header is rechecked on every attempt: a writer that closes
+            // clears the magic, and one that takes over a stale name rebuilds
+            // the layout underneath the mapping we still hold
+            if (!headerValid() || cell.version() == 0) {
+                return false;
+            }
+            if (cell.tryLoad(out) && headerValid()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Number of snapshots published so far (cheap "anything new?" check).
+     */
+    [[nodiscard]] std::uint64_t publishCount() const noexcept {
+        return isOpen() ? layout()->snapshot.version() : 0;
+    }
+
+private:
+    [[nodiscard]] const SharedSnapshotRegion* layout() const noexcept {
+        return static_cast<const SharedSnapshotRegion*>(m_region.data());
+    }
+
+    [[nodiscard]] bool headerValid() const noexcept {
+        const auto* region = layout();
+        return region->magic.load(std::memory_order_acquire) == kSnapshotRegionMagic &&
+               region->version == kSnapshotRegionVersion;
+    }
+
+    SharedMemoryRegion m_region;
+};
+
+} // namespace openmeters::core::ipc
@@ -0,0 +1,152 @@
+#pragma once
+
+#include <atomic>
+#include <climits>
+#include <cstdint>
+#include <string>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif defined(__linux__)
+#include <ctime>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#else
+#include <chrono>
+#include <thread>
+#endif
+
+namespace openmeters::core::ipc {
+
+/**
+ * Cross-process wakeup for shared-memory rings.
+ *
+ * The notifier bumps a counter that lives in the shared region and only
+ * enters the kernel when a reader is actually waiting. Waiters use a futex
+ * on the counter on Linux and a named semaphore on Windows (WaitOnAddress
+ * does not cross process boundaries); other platforms fall back to short
+ * sleeps.
+ *
+ * Header-only so external readers can include it directly.
+ */
+class SharedWakeSignal {
+    static_assert(sizeof(std::atomic<std::uint32_t>) == sizeof(std::uint32_t), "Wake counter must be a plain 32-bit word");
+
+public:
+    SharedWakeSignal() = default;
+    ~SharedWakeSignal() { detach(); }
+
+    SharedWakeSignal(const SharedWakeSignal&) = delete;
+    SharedWakeSignal& operator=(const SharedWakeSignal&) = delete;
+
+    /**
+     * Bind to the counter and waiter words inside a mapped region.
+     *
+     * @param name Region name (used for the Windows semaphore)
+     * @param counter Wake counter inside the shared region
+     * @param waiters Number of blocked readers inside the shared region
+     * @return true if the signal is usable
+     */
+    bool attach(const std::string& name, std::atomic<std::uint32_t>* counter,
+                std::atomic<std::uint32_t>* waiters) {
+        detach();
+        m_counter = counter;
+        m_waiters = waiters;
+#ifdef _WIN32
+        const std::string semaphoreName = "Local\\" + name + ".wake";
+        m_semaphore = CreateSemaphoreA(nullptr, 0, LONG_MAX, semaphoreName.c_str());
+        if (!m_semaphore) {
+            m_counter = nullptr;
+            m_waiters = nullptr;
+            return false;
+        }
+#else
+        (void)name;
+#endif
+        return true;
+    }
+
+    void detach() {
+#ifdef _WIN32
+        if (m_semaphore) {
+            CloseHandle(m_semaphore);
+            m_semaphore = nullptr;
+        }
+#endif
+        m_counter = nullptr;
+        m_waiters = nullptr;
+    }
+
+    /**
+     * Current counter value. Read before checking for data, then pass to wait().
+     */
+    [[nodiscard]] std::uint32_t counter() const noexcept {
+        return m_counter ? m_counter->load(std::memory_order_acquire) : 0;
+    }
+
+    /**
+     * Wake all waiting readers. No syscall unless someone is waiting.
+     */
+    void notify() noexcept {
+        if (!m_counter) {
+            return;
+        }
+
+        // seq_cst on both sides: the waiter's increment and this load (and
+        // this increment and the waiter's load) must not be reordered, or a
+        // waiter can miss the bump and sleep through the wake
+        m_counter->fetch_add(1, std::memory_order_seq_cst);
+        const std::uint32_t waiting = m_waiters->load(std::memory_order_seq_cst);
+        if (waiting == 0) {
+            return;
+        }
+
+#ifdef _WIN32
+        ReleaseSemaphore(m_semaphore, static_cast<LONG>(waiting), nullptr);
+#elif defined(__linux__)
+        syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(m_counter), FUTEX_WAKE, INT_MAX,
+                nullptr, nullptr, 0);
+#endif
+    }
+
+    /**
+     * Block until the counter moves past expected or the timeout expires.
+     *
+     * @param expected Value previously returned by counter()
+     * @param timeoutMs Maximum wait in milliseconds
+     */
+    void wait(std::uint32_t expected, std::uint32_t timeoutMs) noexcept {
+        if (!m_counter) {
+            return;
+        }
+
+        m_waiters->fetch_add(1, std::memory_order_seq_cst);
+        if (m_counter->load(std::memory_order_seq_cst) == expected) {
+#ifdef _WIN32
+            WaitForSingleObject(m_semaphore, timeoutMs);
+#elif defined(__linux__)
+            timespec timeout{};
+            timeout.tv_sec = static_cast<time_t>(timeoutMs / 1000);
+            timeout.tv_nsec = static_cast<long>(timeoutMs % 1000) * 1000000L;
+            syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(m_counter), FUTEX_WAIT, expected,
+                    &timeout, nullptr, 0);
+#else
+            std::this_thread::sleep_for(std::chrono::milliseconds(timeoutMs < 1 ? timeoutMs : 1));
+#endif
+        }
+        m_waiters->fetch_sub(1, std::memory_order_seq_cst);
+    }
+
+private:
+    std::atomic<std::uint32_t>* m_counter = nullptr;
+    std::atomic<std::uint32_t>* m_waiters = nullptr;
+#ifdef _WIN32
+    HANDLE m_semaphore = nullptr;
+#endif
+};
+
+} // namespace openmeters::core::ipc
@@ -0,0 +1,205 @@
+#include "event-detector.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace openmeters::core::meters {
+
+namespace {
+
+// Frames per scan block. Small enough to keep the slow path local to the
+// event, large enough for the reductions to vectorize.
+constexpr std::size_t kBlockFrames = 32;
+
+} // namespace
+
+EventDetector::EventDetector(const Settings& settings) noexcept
+    : m_settings(settings)
+{
+}
+
+std::size_t EventDetector::process(
+    const float* buffer,
+    std::size_t frameCount,
+    const common::AudioFormat& format,
+    std::uint64_t streamFrame,
+    common::MeterEvent* out,
+    std::size_t maxEvents
+) noexcept {
+    Output output{out, out ? maxEvents : 0, 0};
+
+    if (!buffer || frameCount == 0 || !format.isValid()) {
+        return 0;
+    }
+
+    const std::size_t samplesPerFrame = format.samplesPerFrame();
+    const std::size_t channels = std::min(samplesPerFrame, kMaxChannels);
+
+    // The 4-tap midpoint interpolator gains at most 20/16 over its inputs, so
+    // a window where every sample stays below 0.8 * overThreshold cannot
+    // produce an inter-sample over.
+    const float quietLimit = std::min(m_settings.clipThreshold, m_settings.overThreshold * 0.8f);
+
+    for (std::size_t frame = 0; frame < frameCount; frame += kBlockFrames) {
+        const std::size_t blockFrames = std::min(kBlockFrames, frameCount - frame);
+        const float* block = buffer + frame * samplesPerFrame;
+        const std::size_t blockSamples = blockFrames * samplesPerFrame;
+
+        // Branch-free reductions over the whole interleaved block
+        float maxAbs = 0.0f;
+        float minAbs = std::numeric_limits<float>::max();
+        for (std::size_t i = 0; i < blockSamples; ++i) {
+            const float a = std::fabs(block[i]);
+            maxAbs = a > maxAbs ? a : maxAbs;
+            minAbs = a < minAbs ? a : minAbs;
+        }
+
+        const bool quiet = maxAbs < quietLimit && minAbs > 0.0f;
+
+        if (quiet && m_previousBlockQuiet) {
+            // Nothing to detect: close open runs and carry the interpolator history
+            const std::size_t tail = std::min<std::size_t>(blockFrames, 3);
+            for (std::size_t ch = 0; ch < channels; ++ch) {
+                ChannelState& state = m_channels[ch];
+                closeRuns(state, static_cast<std::uint8_t>(ch), output);
+                for (std::size_t i = blockFrames - tail; i < blockFrames; ++i) {
+                    state.history[0] = state.history[1];
+                    state.history[1] = state.history[2];
+                    state.history[2] = block[i * samplesPerFrame + ch];
+                }
+            }
+        } else {
+            for (std::size_t i = 0; i < blockFrames; ++i) {
+                const std::uint64_t position = streamFrame + frame + i;
+                for (std::size_t ch = 0; ch < channels; ++ch) {
+                    processSample(m_channels[ch], static_cast<std::uint8_t>(ch),
+                                  block[i * samplesPerFrame + ch], position, output);
+                }
+            }
+        }
+
+        m_previousBlockQuiet = quiet;
+    }
+
+    return output.count;
+}
+
+void EventDetector::reset() noexcept {
+    m_channels = {};
+    m_previousBlockQuiet = false;
+}
+
+void EventDetector::processSample(
+    ChannelState& state,
+    std::uint8_t channel,
+    float sample,
+    std::uint64_t frame,
+    Output& output
+) noexcept {
+    const float magnitude = std::fabs(sample);
+
+    // Clip: run of full-scale samples
+    if (magnitude >= m_settings.clipThreshold) {
+        if (state.clip.length == 0) {
+            state.clip.start = frame;
+            state.clip.magnitude = 0.0f;
+        }
+        ++state.clip.length;
+        state.clip.magnitude = std::max(state.clip.magnitude, magnitude);
+    } else if (state.clip.length > 0) {
+        if (state.clip.length >= m_settings.clipMinRun) {
+            emit(output, common::MeterEventType::Clip, channel, state.clip);
+        }
+        state.clip.length = 0;
+    }
+
+    // Inter-sample over: 4-tap interpolated midpoint between the previous two
+    // samples. Flat tops already reported as clips are not counted again.
+    const auto& h = state.history;
+    const float midpoint = (9.0f * (h[1] + h[2]) - (h[0] + sample)) * (1.0f / 16.0f);
+    const float midMagnitude = std::fabs(midpoint);
+    const float neighbourPeak = std::max(std::fabs(h[1]), std::fabs(h[2]));
+
+    if (midMagnitude > m_settings.overThreshold && neighbourPeak < m_settings.clipThreshold) {
+        if (state.over.length == 0) {
+            state.over.start = frame >= 2 ? frame - 2 : 0;
+            state.over.magnitude = 0.0f;
+        }
+        ++state.over.length;
+        state.over.magnitude = std::max(state.over.magnitude, midMagnitude);
+    } else if (state.over.length > 0) {
+        emit(output, common::MeterEventType::InterSampleOver, channel, state.over);
+        state.over.length = 0;
+    }
+
+    state.history[0] = h[1];
+    state.history[1] = h[2];
+    state.history[2] = sample;
+
+    // Dropout: bounded run of exact zeros after real signal
+    if (sample == 0.0f) {
+        if (state.zeros.length == 0) {
+            state.zeros.start = frame;
+        }
+        // Saturate just above the limit so endless silence cannot overflow
+        if (state.zeros.length <= m_settings.dropoutMaxFrames) {
+            ++state.zeros.length;
+        }
+    } else {
+        if (state.zeros.length > 0) {
+            closeDropout(state, channel, output);
+        }
+        state.hasSignal = true;
+    }
+}
+
+void EventDetector::closeRuns(ChannelState& state, std::uint8_t channel, Output& output) noexcept {
+    if (state.clip.length > 0) {
+        if (state.clip.length >= m_settings.clipMinRun) {
+            emit(output, common::MeterEventType::Clip, channel, state.clip);
+        }
+        state.clip.length = 0;
+    }
+
+    if (state.over.length > 0) {
+        emit(output, common::MeterEventType::InterSampleOver, channel, state.over);
+        state.over.length = 0;
+    }
+
+    if (state.zeros.length > 0) {
+        closeDropout(state, channel, output);
+    }
+
+    // Only called ahead of non-zero audio
+    state.hasSignal = true;
+}
+
+void EventDetector::closeDropout(ChannelState& state, std::uint8_t channel, Output& output) noexcept {
+    if (state.hasSignal &&
+        state.zeros.length >= m_settings.dropoutMinFrames &&
+        state.zeros.length <= m_settings.dropoutMaxFrames) {
+        emit(output, common::MeterEventType::Dropout, channel, state.zeros);
+    }
+    state.zeros.length = 0;
+}
+
+void EventDetector::emit(
+    Output& output,
+    common::MeterEventType type,
+    std::uint8_t channel,
+    const Run& run
+) noexcept {
+    if (output.count >= output.capacity) {
+        ++m_droppedEvents;
+        return;
+    }
+
+    common::MeterEvent& event = output.events[output.count++];
+    event.startFrame = run.start;
+    event.lengthFrames = run.length;
+    event.magnitude = run.magnitude;
+    event.type = type;
+    event.channel = channel;
+}
+
+} // namespace openmeters::core::meters
@@ -0,0 +1,110 @@
+#pragma once
+
+#include "../../common/types.h"
+#include "../../common/audio-format.h"
+#include "../../common/meter-events.h"
+#include <array>
+
+namespace openmeters::core::meters {
+
+/**
+ * Sample-accurate detector for clips, inter-sample overs and dropouts.
+ *
+ * Buffers are scanned in fixed blocks with branch-free max/min reductions.
+ * Only blocks that could contain an event (loud samples, exact zeros, or an
+ * event run still open) fall back to the per-sample state machine, so normal
+ * programme material costs one vectorizable pass.
+ *
+ * Thread safety: Not thread-safe. Must be called from a single thread.
+ */
+class EventDetector {
+public:
+    /**
+     * Detection thresholds.
+     */
+    struct Settings {
+        float clipThreshold = 0.9999f;          // |x| at or above counts as full scale
+        std::uint32_t clipMinRun = 3;           // Consecutive full-scale samples for a clip
+        float overThreshold = 1.0f;             // Reconstructed peak above this is an over
+        std::uint32_t dropoutMinFrames = 16;    // Shortest zero run reported as a dropout
+        std::uint32_t dropoutMaxFrames = 4800;  // Longer zero runs are treated as silence
+    };
+
+    static constexpr std::size_t kMaxChannels = 2;
+
+    EventDetector() = default;
+    explicit EventDetector(const Settings& settings) noexcept;
+
+    /**
+     * Scan a buffer and append detected events to out.
+     * Events that span buffer boundaries are reported once they end.
+     *
+     * @param buffer Audio buffer (interleaved samples)
+     * @param frameCount Number of frames
+     * @param format Audio format descriptor
+     * @param streamFrame Absolute stream position of the first frame
+     * @param out Destination for detected events
+     * @param maxEvents Capacity of out; further events are counted as dropped
+     * @return Number of events written to out
+     */
+    std::size_t process(
+        const float* buffer,
+        std::size_t frameCount,
+        const common::AudioFormat& format,
+        std::uint64_t streamFrame,
+        common::MeterEvent* out,
+        std::size_t maxEvents
+    ) noexcept;
+
+    /**
+     * Reset all run state (call on stream restart or format change).
+     */
+    void reset() noexcept;
+
+    /**
+     * Number of events discarded because the output array was full.
+     */
+    [[nodiscard]] std::uint64_t droppedEvents() const noexcept { return m_droppedEvents; }
+
+    [[nodiscard]] const Settings& settings() const noexcept { return m_settings; }
+
+private:
+    /**
+     * Open run of one event type on one channel.
+     */
+    struct Run {
+        std::uint64_t start = 0;
+        std::uint32_t length = 0;
+        float magnitude = 0.0f;
+    };
+
+    struct ChannelState {
+        Run clip;
+        Run over;
+        Run zeros;
+        std::array<float, 3> history{}; // Last three samples, oldest first
+        bool hasSignal = false;         // Non-zero audio seen since the last reset
+    };
+
+    /**
+     * Output cursor used while processing one buffer.
+     */
+    struct Output {
+        common::MeterEvent* events;
+        std::size_t capacity;
+        std::size_t count;
+    };
+
+    void processSample(ChannelState& state, std::uint8_t channel, float sample,
+                       std::uint64_t frame, Output& output) noexcept;
+    void closeRuns(ChannelState& state, std::uint8_t channel, Output& output) noexcept;
+    void closeDropout(ChannelState& state, std::uint8_t channel, Output& output) noexcept;
+    void emit(Output& output, common::MeterEventType type, std::uint8_t channel, const Run& run) noexcept;
+
+    Settings m_settings;
+    std::array<ChannelState, kMaxChannels> m_channels{};
+    bool m_previousBlockQuiet = false;
+    std::uint64_t m_droppedEvents = 0;
+};
+
+} // namespace openmeters::core::meters
@@ -0,0 +1,64 @@
+#include "meter-pipeline.h"
+
+namespace openmeters::core::meters {
+
+bool MeterPipeline::prepare(const common::AudioFormat& format, std::size_t maxFramesPerBlock) {
+    if (!format.isValid()) {
+        return false;
+    }
+    m_format = format;
+    reset();
+    return m_plugins.prepare(format, maxFramesPerBlock);
+}
+
+const common::MeterSnapshot& MeterPipeline::process(const float* buffer, std::size_t frameCount) noexcept {
+    if (!buffer || frameCount == 0) {
+        return m_snapshot;
+    }
+    
+    const auto processingStart = std::chrono::steady_clock::now();
+    
+    // Compute peak and RMS
+    m_snapshot.peak = m_peakMeter.process(buffer, frameCount, m_format);
+    m_snapshot.rms = m_rmsMeter.process(buffer, frameCount, m_format);
+    m_snapshot.timestampMs = static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::milliseconds>(processingStart - m_startTime).count()
+    );
+    
+    // Detect clips, overs and dropouts at exact stream positions
+    const std::size_t eventCount = m_eventDetector.process(
+        buffer, frameCount, m_format, m_streamFrame,
+        m_eventScratch.data(), m_eventScratch.size()
+    );
+    for (std::size_t i = 0; i < eventCount; ++i) {
+        m_eventRing.push(m_eventScratch[i]);
+    }
+    
+    // Third-party meters see the same block in place
+    m_plugins.process(buffer, frameCount, m_format, m_streamFrame);
+    m_streamFrame += frameCount;
+    
+    m_latestSnapshot.store(m_snapshot);
+    
+    m_health.setDroppedEvents(m_eventDetector.droppedEvents());
+    m_health.recordProcessing(static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - processingStart
+        ).count()
+    ));
+    
+    return m_snapshot;
+}
+
+void MeterPipeline::reset() noexcept {
+    m_eventDetector.reset();
+    m_plugins.reset();
+    m_streamFrame = 0;
+    m_startTime = std::chrono::steady_clock::now();
+    
+    // Publish silence so readers polling the version see the restart
+    m_snapshot = common::MeterSnapshot{};
+    m_latestSnapshot.store(m_snapshot);
+}
+
+} // namespace openmeters::core::meters
@@ -0,0 +1,101 @@
+#pragma once
+
+#include "peak-meter.h"
+#include "rms-meter.h"
+#include "event-detector.h"
+#include "../../common/meter-source.h"
+#include "../../common/seqlock.h"
+#include "../../core/plugins/plugin-host.h"
+#include <array>
+#include <chrono>
+
+namespace openmeters::core::meters {
+
+/**
+ * The metering half of the engine, without any capture device.
+ * Turns interleaved float blocks into snapshots, events and plugin outputs,
+ * and exposes them through the lock-free IMeterSource view.
+ *
+ * The audio engine feeds it from the WASAPI capture thread; the embedding
+ * API (core/embed) lets a host application push its own blocks instead.
+ * Blocks are read in place and never copied.
+ *
+ * Usage:
+ *   1. plugins().loadDirectory()/addPlugin() (optional)
+ *   2. prepare() with the stream format
+ *   3. process() once per block, from one thread at a time
+ *   4. IMeterSource methods from any thread
+ *
+ * Thread safety: prepare()/process()/reset() from one thread at a time;
+ * IMeterSource methods from any thread.
+ */
+class MeterPipeline : public common::IMeterSource {
+public:
+    MeterPipeline() = default;
+
+    // Non-copyable, non-movable
+    MeterPipeline(const MeterPipeline&) = delete;
+    MeterPipeline& operator=(const MeterPipeline&) = delete;
+    MeterPipeline(MeterPipeline&&) = delete;
+    MeterPipeline& operator=(MeterPipeline&&) = delete;
+
+    /**
+     * Set the stream format, restart stream positions and prepare plugins.
+     * Not for the audio thread.
+     *
+     * @param maxFramesPerBlock Largest block plugins process in one call
+     */
+    bool prepare(const common::AudioFormat& format, std::size_t maxFramesPerBlock);
+
+    /**
+     * Meter one block of interleaved samples in the prepared format.
+     * Real-time safe: no allocation, locks or I/O.
+     *
+     * @return The snapshot just published (valid until the next call)
+     */
+    const common::MeterSnapshot& process(const float* buffer, std::size_t frameCount) noexcept;
+
+    /**
+     * Restart stream positions, detector state and the snapshot clock, and
+     * publish a zeroed snapshot (which advances snapshotVersion()).
+     * Same thread as process().
+     */
+    void reset() noexcept;
+
+    /**
+     * Absolute stream position after the last processed block.
+     */
+    [[nodiscard]] std::uint64_t streamFrame() const noexcept { return m_streamFrame; }
+
+    [[nodiscard]] plugins::PluginHost& plugins() noexcept { return m_plugins; }
+    [[nodiscard]] const plugins::PluginHost& plugins() const noexcept { return m_plugins; }
+
+    /**
+     * Counters shared with a capture device, which records packets and latency.
+     */
+    [[nodiscard]] common::EngineHealthCounters& healthCounters() noexcept { return m_health; }
+
+    // IMeterSource
+    [[nodiscard]] common::MeterSnapshot latestSnapshot() const noexcept override { return m_latestSnapshot.load(); }
+    [[nodiscard]] std::uint64_t snapshotVersion() const noexcept override { return m_latestSnapshot.version(); }
+    [[nodiscard]] const common::MeterEventRing& events() const noexcept override { return m_eventRing; }
+    [[nodiscard]] common::AudioFormat getFormat() const override { return m_format; }
+    [[nodiscard]] common::EngineHealth health() const noexcept override { return m_health.snapshot(); }
+
+private:
+    common::AudioFormat m_format;
+    PeakMeter m_peakMeter;
+    RmsMeter m_rmsMeter;
+    EventDetector m_eventDetector;
+    std::array<common::MeterEvent, 64> m_eventScratch{};
+    std::uint64_t m_streamFrame = 0;
+    std::chrono::steady_clock::time_point m_startTime = std::chrono::steady_clock::now();
+    common::MeterSnapshot m_snapshot;
+
+    common::MeterEventRing m_eventRing;
+    common::SeqlockCell<common::MeterSnapshot> m_latestSnapshot;
+    common::EngineHealthCounters m_health;
+    plugins::PluginHost m_plugins;
+};
+
+} // namespace openmeters::core::meters
@@ -0,0 +1,169 @@
+#pragma once
+
+#include "stream-protocol.h"
+#include "../../common/meter-values.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstddef>
+
+namespace openmeters::core::net {
+
+/**
+ * Binary messages of the WebSocket dashboard feed. All integers are
+ * little-endian; every message starts with a u8 type.
+ *
+ * Server -> client:
+ *   Hello:  u8 type=1, u8 version, u16 fieldsPerSource, u16 sourceCount,
+ *           u16 tickRateHz, then per source: u8 nameLength, name bytes
+ *   Update: u8 type=2, u32 tick, u32 baseTick, then records until the end
+ *           of the message: u16 sourceIndex, u8 fieldMask, i16 value for
+ *           each set bit of fieldMask (lowest bit first)
+ *
+ * Client -> server:
+ *   Ack:    u8 type=1, u32 tick
+ *
+ * Values are levels in 0.1 dBFS steps (-1200 = silence floor). Fields per
+ * source, in bit order: peak L, peak R, RMS L, RMS R.
+ *
+ * An Update holds only the fields that differ from the state at baseTick,
+ * the last tick the client acknowledged (kNoBase: differ from an all-floor
+ * state). Clients therefore keep the decoded state of every tick they have
+ * not yet seen acknowledged, apply each Update to the state of its
+ * baseTick, and Ack the tick once applied. A client that never acks just
+ * keeps receiving updates against an older base, which stay correct.
+ */
+namespace dashboard {
+
+inline constexpr std::uint8_t kVersion = 1;
+inline constexpr std::size_t kFieldsPerSource = 4;
+inline constexpr std::uint32_t kNoBase = 0xFFFFFFFFu;
+
+inline constexpr std::int16_t kFloor = -1200;   // -120.0 dBFS
+inline constexpr std::int16_t kCeiling = 200;   // +20.0 dBFS (inter-sample overs)
+
+enum class MessageType : std::uint8_t {
+    Hello = 1,
+    Update = 2
+};
+
+enum class ClientMessageType : std::uint8_t {
+    Ack = 1
+};
+
+inline constexpr std::size_t kUpdateHeaderSize = 9;
+inline constexpr std::size_t kMaxRecordSize = 3 + 2 * kFieldsPerSource;
+inline constexpr std::size_t kAckSize = 5;
+
+/**
+ * Quantize a linear level to 0.1 dB steps.
+ */
+[[nodiscard]] inline std::int16_t quantize(float linear) noexcept {
+    if (!(linear > 1e-6f)) {
+        return kFloor;
+    }
+    const float tenthsDb = 200.0f * std::log10(linear);
+    return static_cast<std::int16_t>(std::clamp(std::lround(tenthsDb), long(kFloor), long(kCeiling)));
+}
+
+/**
+ * Quantize all fields of one snapshot.
+ */
+inline void quantizeSnapshot(const common::MeterSnapshot& snapshot, std::int16_t* out) noexcept {
+    out[0] = quantize(snapshot.peak.left);
+    out[1] = quantize(snapshot.peak.right);
+    out[2] = quantize(snapshot.rms.left);
+    out[3] = quantize(snapshot.rms.right);
+}
+
+/**
+ * Encode an Update message.
+ *
+ * @param out Output buffer (at least kUpdateHeaderSize + sourceCount * kMaxRecordSize)
+ * @param current Current state, sourceCount * kFieldsPerSource values
+ * @param base Baseline state, or nullptr for kNoBase
+ * @return Message size; kUpdateHeaderSize means nothing changed
+ */
+inline std::size_t encodeUpdate(
+    std::uint8_t* out,
+    std::uint32_t tick,
+    std::uint32_t baseTick,
+    const std::int16_t* current,
+    const std::int16_t* base,
+    std::size_t sourceCount
+) noexcept {
+    out[0] = static_cast<std::uint8_t>(MessageType::Update);
+    stream::put32(out + 1, tick);
+    stream::put32(out + 5, base ? baseTick : kNoBase);
+    std::uint8_t* p = out + kUpdateHeaderSize;
+
+    for (std::size_t source = 0; source < sourceCount; ++source) {
+        const std::int16_t* now = current + source * kFieldsPerSource;
+        std::uint8_t mask = 0;
+        for (std::size_t field = 0; field < kFieldsPerSource; ++field) {
+            const std::int16_t before = base ? base[source * kFieldsPerSource + field] : kFloor;
+            mask |= static_cast<std::uint8_t>((now[field] != before) << field);
+        }
+        if (mask == 0) {
+            continue;
+        }
+
+        stream::put16(p, static_cast<std::uint16_t>(source));
+        p[2] = mask;
+        p += 3;
+        for (std::size_t field = 0; field < kFieldsPerSource; ++field) {
+            if (mask & (1u << field)) {
+                stream::put16(p, static_cast<std::uint16_t>(now[field]));
+                p += 2;
+            }
+        }
+    }
+    return static_cast<std::size_t>(p - out);
+}
+
+/**
+ * Apply an Update to a baseline state (reference decoder for clients/tests).
+ *
+ * @param state In: state at the message's baseTick (all kFloor for kNoBase).
+ *              Out: state at the message's tick.
+ * @return false if the message is malformed
+ */
+inline bool applyUpdate(
+    const std::uint8_t* message,
+    std::size_t length,
+    std::int16_t* state,
+    std::size_t sourceCount,
+    std::uint32_t& tick
+) noexcept {
+    if (length < kUpdateHeaderSize || message[0] != static_cast<std::uint8_t>(MessageType::Update)) {
+        return false;
+    }
+    tick = stream::get32(message + 1);
+    if (stream::get32(message + 5) == kNoBase) {
+        std::fill(state, state + sourceCount * kFieldsPerSource, kFloor);
+    }
+
+    std::size_t offset = kUpdateHeaderSize;
+    while (offset + 3 <= length) {
+        const std::size_t source = stream::get16(message + offset);
+        const std::uint8_t mask = message[offset + 2];
+        offset += 3;
+        if (source >= sourceCount) {
+            return false;
+        }
+        for (std::size_t field = 0; field < kFieldsPerSource; ++field) {
+            if (mask & (1u << field)) {
+                if (offset + 2 > length) {
+                    return false;
+                }
+                state[source * kFieldsPerSource + field] = static_cast<std::int16_t>(stream::get16(message + offset));
+                offset += 2;
+            }
+        }
+    }
+    return offset == length;
+}
+
+} // namespace dashboard
+
+} // namespace openmeters::core::net
@@ -0,0 +1,242 @@
+#include "line-writer.h"
+#include "tick-schedule.h"
+#include "../../common/logger.h"
+#include <chrono>
+#include <charconv>
+
+namespace openmeters::core::net {
+
+namespace {
+
+constexpr std::string_view kCsvHeader = "timestamp_ms,source,seq,peak_l,peak_r,rms_l,rms_r\n";
+
+void appendNumber(std::string& out, float value) {
+    char buffer[32];
+    const auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    out.append(buffer, result.ptr);
+}
+
+void appendNumber(std::string& out, std::uint64_t value) {
+    char buffer[24];
+    const auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    out.append(buffer, result.ptr);
+}
+
+/**
+ * Quote a CSV field if it contains a separator, quote or line break.
+ */
+std::string quoteCsv(const std::string& text) {
+    if (text.find_first_of(",\"\r\n") == std::string::npos) {
+        return text;
+    }
+    std::string quoted = "\"";
+    for (char c : text) {
+        if (c == '"') {
+            quoted += '"';
+        }
+        quoted += c;
+    }
+    quoted += '"';
+    return quoted;
+}
+
+} // namespace
+
+std::string quoteJson(std::string_view text) {
+    static constexpr char kHex[] = "0123456789abcdef";
+    std::string quoted = "\"";
+    for (char c : text) {
+        const auto byte = static_cast<unsigned char>(c);
+        if (c == '"' || c == '\\') {
+            quoted += '\\';
+            quoted += c;
+        } else if (byte < 0x20) {
+            quoted += "\\u00";
+            quoted += kHex[byte >> 4];
+            quoted += kHex[byte & 0xF];
+        } else {
+            quoted += c;
+        }
+    }
+    quoted += '"';
+    return quoted;
+}
+
+void appendNdjsonSnapshot(std::string& out, std::string_view quotedSource, std::uint64_t sequence,
+                          const common::MeterSnapshot& snapshot) {
+    out += "{\"t\":";
+    appendNumber(out, snapshot.timestampMs);
+    out += ",\"source\":";
+    out += quotedSource;
+    out += ",\"seq\":";
+    appendNumber(out, sequence);
+    out += ",\"peak\":[";
+    appendNumber(out, snapshot.peak.left);
+    out += ',';
+    appendNumber(out, snapshot.peak.right);
+    out += "],\"rms\":[";
+    appendNumber(out, snapshot.rms.left);
+    out += ',';
+    appendNumber(out, snapshot.rms.right);
+    out += "]}\n";
+}
+
+void appendNdjsonEvent(std::string& out, std::string_view quotedSource, const common::MeterEvent& event) {
+    out += "{\"source\":";
+    out += quotedSource;
+    out += ",\"event\":\"";
+    out += common::meterEventWireName(event.type);
+    out += "\",\"channel\":";
+    appendNumber(out, static_cast<std::uint64_t>(event.channel));
+    out += ",\"frame\":";
+    appendNumber(out, event.startFrame);
+    out += ",\"length\":";
+    appendNumber(out, static_cast<std::uint64_t>(event.lengthFrames));
+    out += ",\"magnitude\":";
+    appendNumber(out, event.magnitude);
+    out += "}\n";
+}
+
+void appendCsvSnapshot(std::string& out, std::string_view source, std::uint64_t sequence,
+                       const common::MeterSnapshot& snapshot) {
+    appendNumber(out, snapshot.timestampMs);
+    out += ',';
+    out += source;
+    out += ',';
+    appendNumber(out, sequence);
+    out += ',';
+    appendNumber(out, snapshot.peak.left);
+    out += ',';
+    appendNumber(out, snapshot.peak.right);
+    out += ',';
+    appendNumber(out, snapshot.rms.left);
+    out += ',';
+    appendNumber(out, snapshot.rms.right);
+    out += '\n';
+}
+
+LineWriter::~LineWriter() {
+    stop();
+}
+
+bool LineWriter::addSource(const std::string& name, const common::IMeterSource* source) {
+    if (m_running.load() || !source) {
+        return false;
+    }
+    Source entry;
+    entry.name = quoteCsv(name);
+    entry.quotedName = quoteJson(name);
+    entry.source = source;
+    m_sources.push_back(std::move(entry));
+    return true;
+}
+
+bool LineWriter::start(std::FILE* out, const LineWriterSettings& settings) {
+    if (m_running.load()) {
+        return true;
+    }
+    if (!out || !(settings.rateHz > 0.0f)) {
+        LOG_ERROR("Line writer needs an output stream and a positive rate");
+        return false;
+    }
+
+    m_settings = settings;
+    m_out = out;
+
+    // Headroom for one tick's worth of lines beyond the batch threshold
+    m_batch.clear();
+    m_batch.reserve(m_settings.batchBytes + 4096);
+    m_batchLines = 0;
+
+    for (Source& source : m_sources) {
+        source.lastVersion = source.source->snapshotVersion(); // Only snapshots published from now on
+        source.eventCursor = source.source->events().tail();
+    }
+
+    if (m_settings.format == LineFormat::Csv) {
+        m_batch += kCsvHeader;
+    }
+
+    m_running.store(true);
+    m_thread = std::thread(&LineWriter::run, this);
+    return true;
+}
+
+void LineWriter::stop() {
+    {
+        std::lock_guard<std::mutex> lock(m_wakeMutex);
+        if (!m_running.exchange(false)) {
+            return;
+        }
+    }
+    m_wake.notify_all();
+
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+    flush();
+}
+
+void LineWriter::run() {
+    const auto flushInterval = std::chrono::milliseconds(m_settings.flushIntervalMs);
+
+    TickSchedule schedule(m_settings.rateHz);
+    auto nextFlush = schedule.next() + flushInterval;
+    std::unique_lock<std::mutex> lock(m_wakeMutex);
+    while (m_running.load()) {
+        lock.unlock();
+        tick();
+        const auto now = TickSchedule::Clock::now();
+        if (m_batch.size() >= m_settings.batchBytes || now >= nextFlush) {
+            flush();
+            nextFlush = now + flushInterval;
+        }
+        lock.lock();
+
+        schedule.advance(now);
+        m_wake.wait_until(lock, schedule.next(), [this] { return !m_running.load(); });
+    }
+}
+
+void LineWriter::tick() {
+    const bool ndjson = m_settings.format == LineFormat::Ndjson;
+
+    for (Source& source : m_sources) {
+        const std::uint64_t version = source.source->snapshotVersion();
+        if (version != source.lastVersion) {
+            source.lastVersion = version;
+            const common::MeterSnapshot snapshot = source.source->latestSnapshot();
+            if (ndjson) {
+                appendNdjsonSnapshot(m_batch, source.quotedName, version, snapshot);
+            } else {
+                appendCsvSnapshot(m_batch, source.name, version, snapshot);
+            }
+            ++m_batchLines;
+        }
+
+        if (!ndjson || !m_settings.writeEvents) {
+            continue;
+        }
+        common::MeterEvent events[32];
+        std::size_t count = 0;
+        while ((count = source.source->events().read(source.eventCursor, events, std::size(events))) > 0) {
+            for (std::size_t i = 0; i < count; ++i) {
+                appendNdjsonEvent(m_batch, source.quotedName, events[i]);
+                ++m_batchLines;
+            }
+        }
+    }
+}
+
+void LineWriter::flush() {
+    if (m_batch.empty()) {
+        return;
+    }
+    std::fwrite(m_batch.data(), 1, m_batch.size(), m_out);
+    std::fflush(m_out);
+    m_linesWritten.fetch_add(m_batchLines);
+    m_batch.clear();
+    m_batchLines = 0;
+}
+
+} // namespace openmeters::core::net
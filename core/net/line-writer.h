@@ -0,0 +1,134 @@
+#pragma once
+
+#include "../../common/meter-source.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace openmeters::core::net {
+
+/**
+ * Text format of a snapshot line.
+ */
+enum class LineFormat {
+    Ndjson, // One JSON object per line; events as separate objects
+    Csv     // Header row, then one row per snapshot; events are not written
+};
+
+/**
+ * Line writer settings.
+ */
+struct LineWriterSettings {
+    LineFormat format = LineFormat::Ndjson;
+    float rateHz = 100.0f;                 // Upper bound on lines per second per source
+    std::uint32_t flushIntervalMs = 100;   // Longest time a line waits in the batch
+    std::size_t batchBytes = 64 * 1024;    // Write out early once the batch is this large
+    bool writeEvents = true;               // NDJSON only
+};
+
+/**
+ * Append one snapshot as an NDJSON object (including the newline).
+ * quotedSource must already be a JSON string literal (see quoteJson()).
+ */
+void appendNdjsonSnapshot(std::string& out, std::string_view quotedSource, std::uint64_t sequence,
+                          const common::MeterSnapshot& snapshot);
+
+/**
+ * Append one journal entry as an NDJSON object (including the newline).
+ */
+void appendNdjsonEvent(std::string& out, std::string_view quotedSource, const common::MeterEvent& event);
+
+/**
+ * Append one snapshot as a CSV row (including the newline).
+ * source is written verbatim; quote it beforehand if it may contain commas.
+ * Columns: timestamp_ms,source,seq,peak_l,peak_r,rms_l,rms_r
+ */
+void appendCsvSnapshot(std::string& out, std::string_view source, std::uint64_t sequence,
+                       const common::MeterSnapshot& snapshot);
+
+/**
+ * Quote and escape a string for JSON.
+ */
+[[nodiscard]] std::string quoteJson(std::string_view text);
+
+/**
+ * Streams meter snapshots as NDJSON or CSV lines to a file (usually stdout),
+ * for piping into other tools.
+ *
+ * A writer thread polls the sources' lock-free views at the configured rate
+ * and emits a line whenever a snapshot changed. Lines are formatted with
+ * std::to_chars into one reused buffer and written out in batches with a
+ * single fwrite, so the audio thread never notices the consumer and the
+ * writer costs little more than the formatting itself.
+ *
+ * Thread safety: addSource/start/stop from one control thread.
+ */
+class LineWriter {
+public:
+    LineWriter() = default;
+    ~LineWriter();
+
+    // Non-copyable, non-movable
+    LineWriter(const LineWriter&) = delete;
+    LineWriter& operator=(const LineWriter&) = delete;
+    LineWriter(LineWriter&&) = delete;
+    LineWriter& operator=(LineWriter&&) = delete;
+
+    /**
+     * Register a meter source. Must be called before start().
+     *
+     * @param name Value of the source column (e.g. "loopback")
+     * @param source Source (must outlive the writer)
+     */
+    bool addSource(const std::string& name, const common::IMeterSource* source);
+
+    /**
+     * Start the writer thread. Each source's first line is the first
+     * snapshot published after start().
+     *
+     * @param out Destination stream (not closed by the writer)
+     */
+    bool start(std::FILE* out, const LineWriterSettings& settings = LineWriterSettings());
+
+    /**
+     * Stop the writer thread after writing out anything still batched.
+     */
+    void stop();
+
+    [[nodiscard]] bool isRunning() const noexcept { return m_running.load(); }
+    [[nodiscard]] std::uint64_t linesWritten() const noexcept { return m_linesWritten.load(); }
+
+private:
+    struct Source {
+        std::string name;
+        std::string quotedName;
+        const common::IMeterSource* source = nullptr;
+        std::uint64_t lastVersion = 0;
+        common::MeterEventRing::Cursor eventCursor;
+    };
+
+    void run();
+    void tick();
+    void flush();
+
+    LineWriterSettings m_settings;
+    std::vector<Source> m_sources;
+    std::FILE* m_out = nullptr;
+
+    std::string m_batch;
+    std::uint64_t m_batchLines = 0;
+
+    std::thread m_thread;
+    std::mutex m_wakeMutex;
+    std::condition_variable m_wake;
+    std::atomic<bool> m_running{false};
+    std::atomic<std::uint64_t> m_linesWritten{0};
+};
+
+} // namespace openmeters::core::net
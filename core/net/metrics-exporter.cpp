@@ -0,0 +1,383 @@
+#include "metrics-exporter.h"
+#include "../../common/logger.h"
+#include <charconv>
+#include <cstring>
+#include <string_view>
+
+#ifndef _WIN32
+#include <poll.h>
+#endif
+
+namespace openmeters::core::net {
+
+namespace {
+
+// Upper bound on one wait so stop() is noticed promptly
+constexpr int kMaxWaitMs = 100;
+
+// Requests larger than this are rejected (a scrape is a few hundred bytes)
+constexpr std::size_t kMaxRequestSize = 8 * 1024;
+
+constexpr const char* kTextContentType = "text/plain; version=0.0.4; charset=utf-8";
+constexpr const char* kOpenMetricsContentType = "application/openmetrics-text; version=1.0.0; charset=utf-8";
+
+/**
+ * Wait until the listening socket has a pending connection.
+ */
+bool waitReadable(SocketHandle socket, int timeoutMs) {
+#ifdef _WIN32
+    WSAPOLLFD entry{socket, POLLRDNORM, 0};
+    return WSAPoll(&entry, 1, timeoutMs) > 0 && (entry.revents & POLLRDNORM);
+#else
+    pollfd entry{socket, POLLIN, 0};
+    return poll(&entry, 1, timeoutMs) > 0 && (entry.revents & POLLIN);
+#endif
+}
+
+constexpr std::array<const char*, 3> kEventTypeLabels = {"clip", "inter_sample_over", "dropout"};
+
+std::string escapeLabel(const std::string& value) {
+    std::string escaped;
+    escaped.reserve(value.size());
+    for (const char c : value) {
+        switch (c) {
+            case '\\': escaped += "\\\\"; break;
+            case '"':  escaped += "\\\""; break;
+            case '\n': escaped += "\\n"; break;
+            default:   escaped += c; break;
+        }
+    }
+    return escaped;
+}
+
+/**
+ * Appends exposition lines to a reused string without temporaries.
+ */
+class Writer {
+public:
+    Writer(std::string& out, bool openMetrics) : m_out(out), m_openMetrics(openMetrics) {}
+
+    /**
+     * Family metadata. Counter names are given without the _total suffix.
+     */
+    void family(std::string_view name, std::string_view type, std::string_view help) {
+        const bool counter = type == "counter";
+        m_out += "# HELP ";
+        familyName(name, counter);
+        m_out += ' ';
+        m_out += help;
+        m_out += "\n# TYPE ";
+        familyName(name, counter);
+        m_out += ' ';
+        m_out += type;
+        m_out += '\n';
+    }
+
+    /**
+     * One sample line. @p labels is a prebuilt label list (e.g. the
+     * source's); @p extraName="extraValue" is appended to it when given.
+     */
+    template <typename T>
+    void sample(std::string_view name, std::string_view labels, T value,
+                std::string_view extraName = {}, std::string_view extraValue = {}) {
+        begin(name, labels, extraName, extraValue);
+        char buffer[32];
+        const auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+        m_out.append(buffer, result.ptr);
+        m_out += '\n';
+    }
+
+private:
+    void familyName(std::string_view name, bool counter) {
+        m_out += name;
+        // The text format names counter families after their sample
+        if (counter && !m_openMetrics) {
+            m_out += "_total";
+        }
+    }
+
+    void begin(std::string_view name, std::string_view labels, std::string_view extraName,
+               std::string_view extraValue) {
+        m_out += name;
+        if (!labels.empty() || !extraName.empty()) {
+            m_out += '{';
+            m_out += labels;
+            if (!extraName.empty()) {
+                if (!labels.empty()) {
+                    m_out += ',';
+                }
+                m_out += extraName;
+                m_out += "=\"";
+                m_out += extraValue;
+                m_out += '"';
+            }
+            m_out += '}';
+        }
+        m_out += ' ';
+    }
+
+    std::string& m_out;
+    bool m_openMetrics;
+};
+
+} // namespace
+
+MetricsExporter::~MetricsExporter() {
+    stop();
+}
+
+bool MetricsExporter::addSource(const std::string& name, const common::IMeterSource* source) {
+    if (m_running.load() || !source) {
+        return false;
+    }
+    Source entry;
+    entry.labels = "source=\"" + escapeLabel(name) + '"';
+    entry.source = source;
+    entry.eventCursor = source->events().tail();
+    m_sources.push_back(std::move(entry));
+    return true;
+}
+
+bool MetricsExporter::start(const MetricsExporterSettings& settings) {
+    if (m_running.load()) {
+        return true;
+    }
+
+    m_settings = settings;
+    if (!initializeSockets()) {
+        LOG_ERROR("Failed to initialize sockets");
+        return false;
+    }
+
+    m_listenSocket = listenTcpLoopback(m_settings.port, m_port);
+    if (m_listenSocket == kInvalidSocket) {
+        LOG_ERROR("Failed to listen on metrics port {}: {}", m_settings.port, lastSocketError());
+        shutdownSockets();
+        return false;
+    }
+
+    m_request.reserve(kMaxRequestSize);
+    m_body.reserve(4096);
+    m_response.reserve(256);
+
+    m_running.store(true);
+    m_thread = std::thread(&MetricsExporter::run, this);
+
+    LOG_INFO("Metrics exporter listening on http://127.0.0.1:{}/metrics", m_port);
+    return true;
+}
+
+void MetricsExporter::stop() {
+    if (!m_running.exchange(false)) {
+        return;
+    }
+
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+
+    closeSocket(m_listenSocket);
+    m_listenSocket = kInvalidSocket;
+    shutdownSockets();
+
+    LOG_INFO("Metrics exporter stopped");
+}
+
+void MetricsExporter::run() {
+    while (m_running.load()) {
+        if (!waitReadable(m_listenSocket, kMaxWaitMs)) {
+            continue;
+        }
+
+        const SocketHandle client = accept(m_listenSocket, nullptr, nullptr);
+        if (client == kInvalidSocket) {
+            continue;
+        }
+        setSocketTimeouts(client, m_settings.requestTimeoutMs);
+        serve(client);
+        closeSocket(client);
+    }
+}
+
+void MetricsExporter::serve(SocketHandle client) {
+    // Read until the end of the request headers (bodies are not expected)
+    m_request.clear();
+    char chunk[1024];
+    while (m_request.find("\r\n\r\n") == std::string::npos) {
+        const auto n = recv(client, chunk, static_cast<int>(sizeof(chunk)), 0);
+        if (n <= 0 || m_request.size() + static_cast<std::size_t>(n) > kMaxRequestSize) {
+            return;
+        }
+        m_request.append(chunk, static_cast<std::size_t>(n));
+    }
+
+    const std::string_view request(m_request);
+    const std::string_view requestLine = request.substr(0, request.find("\r\n"));
+    const std::size_t methodEnd = requestLine.find(' ');
+    const std::size_t pathEnd = requestLine.find(' ', methodEnd + 1);
+    const std::string_view method = requestLine.substr(0, methodEnd);
+    std::string_view path = methodEnd == std::string_view::npos
+        ? std::string_view()
+        : requestLine.substr(methodEnd + 1, pathEnd - methodEnd - 1);
+    path = path.substr(0, path.find('?'));
+
+    const char* status = "200 OK";
+    const char* contentType = kTextContentType;
+    if (method != "GET" && method != "HEAD") {
+        status = "405 Method Not Allowed";
+        m_body = "Only GET is supported\n";
+    } else if (path != "/metrics") {
+        status = "404 Not Found";
+        m_body = "Metrics are served at /metrics\n";
+    } else {
+        const bool openMetrics = request.find("application/openmetrics-text") != std::string_view::npos;
+        contentType = openMetrics ? kOpenMetricsContentType : kTextContentType;
+        render(openMetrics);
+        m_scrapes.fetch_add(1);
+    }
+
+    m_response.clear();
+    m_response += "HTTP/1.1 ";
+    m_response += status;
+    m_response += "\r\nContent-Type: ";
+    m_response += contentType;
+    m_response += "\r\nContent-Length: ";
+    char length[24];
+    m_response.append(length, std::to_chars(length, length + sizeof(length), m_body.size()).ptr);
+    m_response += "\r\nConnection: close\r\n\r\n";
+    if (method != "HEAD") {
+        m_response += m_body;
+    }
+
+    std::size_t sent = 0;
+    while (sent < m_response.size()) {
+        const auto n = send(client, m_response.data() + sent, static_cast<int>(m_response.size() - sent), 0);
+        if (n <= 0) {
+            return;
+        }
+        sent += static_cast<std::size_t>(n);
+    }
+}
+
+void MetricsExporter::render(bool openMetrics) {
+    m_body.clear();
+    Writer out(m_body, openMetrics);
+
+    // Pick up new events first so the counters below are current
+    for (Source& source : m_sources) {
+        const std::uint64_t droppedBefore = source.eventCursor.dropped;
+        common::MeterEvent events[64];
+        std::size_t count = 0;
+        while ((count = source.source->events().read(source.eventCursor, events, std::size(events))) > 0) {
+            for (std::size_t i = 0; i < count; ++i) {
+                const auto type = static_cast<std::size_t>(events[i].type);
+                if (type < source.eventCounts.size()) {
+                    ++source.eventCounts[type];
+                }
+            }
+        }
+        source.eventOverruns += source.eventCursor.dropped - droppedBefore;
+    }
+
+    // Read each source once so all families describe the same instant
+    for (Source& source : m_sources) {
+        source.snapshot = source.source->latestSnapshot();
+        source.health = source.source->health();
+    }
+
+    out.family("openmeters_peak_ratio", "gauge", "Sample peak of the latest buffer (linear, 1.0 = full scale).");
+    for (const Source& source : m_sources) {
+        out.sample("openmeters_peak_ratio", source.labels, static_cast<double>(source.snapshot.peak.left),
+                   "channel", "left");
+        out.sample("openmeters_peak_ratio", source.labels, static_cast<double>(source.snapshot.peak.right),
+                   "channel", "right");
+    }
+
+    out.family("openmeters_rms_ratio", "gauge", "RMS level of the latest buffer (linear, 1.0 = full scale).");
+    for (const Source& source : m_sources) {
+        out.sample("openmeters_rms_ratio", source.labels, static_cast<double>(source.snapshot.rms.left),
+                   "channel", "left");
+        out.sample("openmeters_rms_ratio", source.labels, static_cast<double>(source.snapshot.rms.right),
+                   "channel", "right");
+    }
+
+    out.family("openmeters_snapshots", "counter", "Meter snapshots produced.");
+    for (const Source& source : m_sources) {
+        out.sample("openmeters_snapshots_total", source.labels, source.source->snapshotVersion());
+    }
+
+    out.family("openmeters_sample_rate_hertz", "gauge", "Sample rate of the metered stream.");
+    for (const Source& source : m_sources) {
+        out.sample("openmeters_sample_rate_hertz", source.labels,
+                   static_cast<std::uint64_t>(source.source->getFormat().sampleRate));
+    }
+
+    out.family("openmeters_events", "counter", "Clip, inter-sample over and dropout events seen since the exporter started.");
+    for (const Source& source : m_sources) {
+        for (std::size_t type = 0; type < kEventTypeLabels.size(); ++type) {
+            out.sample("openmeters_events_total", source.labels, source.eventCounts[type], "type", kEventTypeLabels[type]);
+        }
+    }
+
+    out.family("openmeters_event_journal_overruns", "counter", "Events overwritten before the exporter read them.");
+    for (const Source& source : m_sources) {
+        out.sample("openmeters_event_journal_overruns_total", source.labels, source.eventOverruns);
+    }
+
+    // Capture health, one family at a time so each keeps its metadata together
+    struct HealthCounter {
+        const char* family;
+        const char* sample;
+        const char* help;
+        std::uint64_t common::EngineHealth::*field;
+    };
+    static constexpr HealthCounter kHealthCounters[] = {
+        {"openmeters_capture_packets", "openmeters_capture_packets_total", "Capture packets delivered by the device.", &common::EngineHealth::packets},
+        {"openmeters_capture_frames", "openmeters_capture_frames_total", "Audio frames delivered by the device.", &common::EngineHealth::frames},
+        {"openmeters_capture_silent_packets", "openmeters_capture_silent_packets_total", "Packets the device flagged as silent.", &common::EngineHealth::silentPackets},
+        {"openmeters_capture_discontinuities", "openmeters_capture_discontinuities_total", "Packets that followed a gap in the capture stream.", &common::EngineHealth::discontinuities},
+        {"openmeters_capture_buffer_errors", "openmeters_capture_buffer_errors_total", "Failed capture buffer fetches.", &common::EngineHealth::bufferErrors},
+        {"openmeters_events_dropped", "openmeters_events_dropped_total", "Events the detector could not report.", &common::EngineHealth::droppedEvents},
+    };
+
+    for (const HealthCounter& counter : kHealthCounters) {
+        out.family(counter.family, "counter", counter.help);
+        for (const Source& source : m_sources) {
+            out.sample(counter.sample, source.labels, source.health.*counter.field);
+        }
+    }
+
+    out.family("openmeters_callback_latency_seconds", "summary", "Delay from device timestamp to capture callback.");
+    for (const Source& source : m_sources) {
+        out.sample("openmeters_callback_latency_seconds_sum", source.labels,
+                   static_cast<double>(source.health.latencySumUs) * 1e-6);
+        out.sample("openmeters_callback_latency_seconds_count", source.labels, source.health.latencyCount);
+    }
+
+    out.family("openmeters_callback_latency_max_seconds", "gauge", "Largest observed callback latency.");
+    for (const Source& source : m_sources) {
+        out.sample("openmeters_callback_latency_max_seconds", source.labels,
+                   static_cast<double>(source.health.latencyMaxUs) * 1e-6);
+    }
+
+    out.family("openmeters_callback_processing_seconds", "counter", "Time spent metering inside the capture callback.");
+    for (const Source& source : m_sources) {
+        out.sample("openmeters_callback_processing_seconds_total", source.labels,
+                   static_cast<double>(source.health.processingSumUs) * 1e-6);
+    }
+
+    out.family("openmeters_callback_processing_max_seconds", "gauge", "Longest single metering callback.");
+    for (const Source& source : m_sources) {
+        out.sample("openmeters_callback_processing_max_seconds", source.labels,
+                   static_cast<double>(source.health.processingMaxUs) * 1e-6);
+    }
+
+    out.family("openmeters_scrapes", "counter", "Scrapes served by this exporter.");
+    out.sample("openmeters_scrapes_total", std::string_view(), m_scrapes.load() + 1);
+
+    if (openMetrics) {
+        m_body += "# EOF\n";
+    }
+}
+
+} // namespace openmeters::core::net
@@ -0,0 +1,102 @@
+#pragma once
+
+#include "socket.h"
+#include "../../common/meter-source.h"
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace openmeters::core::net {
+
+/**
+ * Metrics exporter settings.
+ */
+struct MetricsExporterSettings {
+    std::uint16_t port = 9464;            // 0 picks an ephemeral port
+    std::uint32_t requestTimeoutMs = 1000; // Per-connection read/write bound
+};
+
+/**
+ * Prometheus / OpenMetrics scrape endpoint on 127.0.0.1.
+ *
+ * Serves GET /metrics over HTTP/1.1 (one request per connection) with the
+ * current peak/RMS values and event counts of every source plus the capture
+ * health counters. The text exposition format is the default; clients that
+ * send "Accept: application/openmetrics-text" get OpenMetrics 1.0.
+ *
+ * Scrapes are handled one at a time on the exporter's own thread. The body
+ * is rendered into a buffer that is reused across scrapes, and all values
+ * come from the sources' lock-free views, so a scrape never touches a lock
+ * the audio thread holds.
+ *
+ * Thread safety: addSource/start/stop from one control thread.
+ */
+class MetricsExporter {
+public:
+    MetricsExporter() = default;
+    ~MetricsExporter();
+
+    // Non-copyable, non-movable
+    MetricsExporter(const MetricsExporter&) = delete;
+    MetricsExporter& operator=(const MetricsExporter&) = delete;
+    MetricsExporter(MetricsExporter&&) = delete;
+    MetricsExporter& operator=(MetricsExporter&&) = delete;
+
+    /**
+     * Register a meter source. Must be called before start().
+     *
+     * @param name Value of the "source" label
+     * @param source Source (must outlive the exporter)
+     * @return false if the server is running or the source is null
+     */
+    bool addSource(const std::string& name, const common::IMeterSource* source);
+
+    /**
+     * Bind the port and start the exporter thread.
+     */
+    bool start(const MetricsExporterSettings& settings = MetricsExporterSettings());
+
+    /**
+     * Stop the exporter thread and close the port.
+     */
+    void stop();
+
+    [[nodiscard]] bool isRunning() const noexcept { return m_running.load(); }
+    [[nodiscard]] std::uint16_t port() const noexcept { return m_port; }
+    [[nodiscard]] std::uint64_t scrapeCount() const noexcept { return m_scrapes.load(); }
+
+private:
+    struct Source {
+        std::string labels;                       // source="<escaped name>", built once
+        const common::IMeterSource* source = nullptr;
+        common::MeterEventRing::Cursor eventCursor;
+        std::array<std::uint64_t, 3> eventCounts{}; // Indexed by MeterEventType
+        std::uint64_t eventOverruns = 0;
+        common::MeterSnapshot snapshot;             // Values for the current scrape
+        common::EngineHealth health;
+    };
+
+    void run();
+    void serve(SocketHandle client);
+    void render(bool openMetrics);
+
+    MetricsExporterSettings m_settings;
+    std::vector<Source> m_sources;
+
+    SocketHandle m_listenSocket = kInvalidSocket;
+    std::uint16_t m_port = 0;
+
+    // Reused across scrapes (touched only by the exporter thread)
+    std::string m_request;
+    std::string m_body;
+    std::string m_response;
+
+    std::thread m_thread;
+    std::atomic<bool> m_running{false};
+    std::atomic<std::uint64_t> m_scrapes{0};
+};
+
+} // namespace openmeters::core::net
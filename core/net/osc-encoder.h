@@ -0,0 +1,162 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <string_view>
+
+namespace openmeters::core::net {
+
+/**
+ * OSC 1.0 packet encoder writing into a caller-owned buffer.
+ *
+ * Builds either a single message or a bundle of messages without any
+ * allocation. Strings are NUL-terminated and padded to 4 bytes; numbers are
+ * big-endian. Once the buffer would overflow, every further call is ignored
+ * and overflowed() reports it, so callers check once at the end.
+ *
+ *   OscEncoder osc(buffer, sizeof(buffer));
+ *   osc.beginBundle();
+ *   osc.beginMessage("/openmeters/main/levels", ",ffff");
+ *   osc.addFloat(peakL); ...
+ *   osc.endMessage();
+ *   send(buffer, osc.size());
+ */
+class OscEncoder {
+public:
+    // "Execute immediately" time tag
+    static constexpr std::uint64_t kImmediately = 1;
+
+    OscEncoder(std::uint8_t* buffer, std::size_t capacity) noexcept
+        : m_buffer(buffer), m_capacity(capacity) {}
+
+    /**
+     * Discard everything written so far.
+     */
+    void reset() noexcept {
+        m_size = 0;
+        m_messageStart = 0;
+        m_inBundle = false;
+        m_inMessage = false;
+        m_overflowed = false;
+    }
+
+    /**
+     * Start a bundle. Must be the first call after construction or reset().
+     */
+    void beginBundle(std::uint64_t timeTag = kImmediately) noexcept {
+        m_inBundle = true;
+        addString("#bundle");
+        put64(timeTag);
+    }
+
+    /**
+     * Start a message. Inside a bundle the element size is patched in endMessage().
+     *
+     * @param address OSC address pattern (e.g. "/openmeters/main/levels")
+     * @param typeTags Type tag string including the leading ',' (e.g. ",ffi")
+     */
+    void beginMessage(std::string_view address, std::string_view typeTags) noexcept {
+        if (m_inBundle) {
+            m_messageStart = m_size;
+            put32(0);
+        }
+        m_inMessage = true;
+        addString(address);
+        addString(typeTags);
+    }
+
+    void addFloat(float value) noexcept {
+        std::uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        put32(bits);
+    }
+
+    void addInt(std::int32_t value) noexcept { put32(static_cast<std::uint32_t>(value)); }
+
+    void addInt64(std::int64_t value) noexcept { put64(static_cast<std::uint64_t>(value)); }
+
+    void addString(std::string_view value) noexcept {
+        const std::size_t padded = (value.size() + 4) & ~std::size_t(3);
+        if (!reserve(padded)) {
+            return;
+        }
+        std::memcpy(m_buffer + m_size, value.data(), value.size());
+        std::memset(m_buffer + m_size + value.size(), 0, padded - value.size());
+        m_size += padded;
+    }
+
+    /**
+     * Finish the current message.
+     */
+    void endMessage() noexcept {
+        if (m_inBundle && m_inMessage && !m_overflowed) {
+            const auto length = static_cast<std::uint32_t>(m_size - m_messageStart - 4);
+            writeBe32(m_buffer + m_messageStart, length);
+        }
+        m_inMessage = false;
+    }
+
+    /**
+     * Bytes that would be written by a message with these parts (inside a
+     * bundle, including the element size). Lets callers split bundles before
+     * they overflow a datagram.
+     */
+    [[nodiscard]] static constexpr std::size_t messageSize(
+        std::size_t addressLength,
+        std::size_t typeTagLength,
+        std::size_t argumentBytes
+    ) noexcept {
+        return 4 + ((addressLength + 4) & ~std::size_t(3)) + ((typeTagLength + 4) & ~std::size_t(3)) + argumentBytes;
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept { return m_size; }
+    [[nodiscard]] std::size_t capacity() const noexcept { return m_capacity; }
+    [[nodiscard]] bool overflowed() const noexcept { return m_overflowed; }
+
+    /**
+     * Bytes of a bundle with no messages yet ("#bundle" plus time tag).
+     */
+    static constexpr std::size_t kBundleHeaderSize = 16;
+
+private:
+    bool reserve(std::size_t bytes) noexcept {
+        if (m_overflowed || m_size + bytes > m_capacity) {
+            m_overflowed = true;
+            return false;
+        }
+        return true;
+    }
+
+    static void writeBe32(std::uint8_t* out, std::uint32_t value) noexcept {
+        out[0] = static_cast<std::uint8_t>(value >> 24);
+        out[1] = static_cast<std::uint8_t>(value >> 16);
+        out[2] = static_cast<std::uint8_t>(value >> 8);
+        out[3] = static_cast<std::uint8_t>(value);
+    }
+
+    void put32(std::uint32_t value) noexcept {
+        if (reserve(4)) {
+            writeBe32(m_buffer + m_size, value);
+            m_size += 4;
+        }
+    }
+
+    void put64(std::uint64_t value) noexcept {
+        if (reserve(8)) {
+            writeBe32(m_buffer + m_size, static_cast<std::uint32_t>(value >> 32));
+            writeBe32(m_buffer + m_size + 4, static_cast<std::uint32_t>(value));
+            m_size += 8;
+        }
+    }
+
+    std::uint8_t* m_buffer;
+    std::size_t m_capacity;
+    std::size_t m_size = 0;
+    std::size_t m_messageStart = 0;
+    bool m_inBundle = false;
+    bool m_inMessage = false;
+    bool m_overflowed = false;
+};
+
+} // namespace openmeters::core::net
@@ -0,0 +1,229 @@
+#include "osc-sender.h"
+#include "tick-schedule.h"
+#include "../../common/logger.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+#ifndef _WIN32
+#include <netdb.h>
+#include <netinet/in.h>
+#endif
+
+namespace openmeters::core::net {
+
+namespace {
+
+// ",ffff" levels and ",sihf" event layouts
+constexpr std::string_view kLevelsTags = ",ffff";
+constexpr std::string_view kEventTags = ",sihf";
+constexpr std::size_t kLevelsArgumentBytes = 4 * 4;
+constexpr std::size_t kEventArgumentBytes = 8 + 4 + 8 + 4; // Longest wire name ("dropout" + NUL) padded to 8
+
+/**
+ * Replace characters OSC reserves in address patterns.
+ */
+std::string sanitizeAddressPart(const std::string& name) {
+    std::string part = name.empty() ? std::string("source") : name;
+    for (char& c : part) {
+        if (c == ' ' || c == '#' || c == '*' || c == ',' || c == '/' || c == '?' ||
+            c == '[' || c == ']' || c == '{' || c == '}') {
+            c = '_';
+        }
+    }
+    return part;
+}
+
+} // namespace
+
+OscSender::~OscSender() {
+    stop();
+}
+
+bool OscSender::addSource(const std::string& name, const common::IMeterSource* source) {
+    if (m_running.load() || !source) {
+        return false;
+    }
+    Source entry;
+    entry.name = sanitizeAddressPart(name);
+    entry.source = source;
+    m_sources.push_back(std::move(entry));
+    return true;
+}
+
+bool OscSender::start(const OscSenderSettings& settings) {
+    if (m_running.load()) {
+        return true;
+    }
+
+    m_settings = settings;
+    m_settings.rateHz = std::clamp(m_settings.rateHz, 1.0f, 1000.0f);
+    m_settings.maxDatagramBytes = std::clamp<std::size_t>(m_settings.maxDatagramBytes, 256, 65507);
+
+    if (!initializeSockets()) {
+        LOG_ERROR("Failed to initialize sockets");
+        return false;
+    }
+
+    // Resolve the destination (IPv4; multicast groups are plain addresses)
+    addrinfo hints{};
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_DGRAM;
+    addrinfo* resolved = nullptr;
+    const std::string port = std::to_string(m_settings.port);
+    if (getaddrinfo(m_settings.host.c_str(), port.c_str(), &hints, &resolved) != 0 || !resolved) {
+        LOG_ERROR("Failed to resolve OSC destination {}", m_settings.host);
+        shutdownSockets();
+        return false;
+    }
+    std::memcpy(&m_destination, resolved->ai_addr, resolved->ai_addrlen);
+    m_destinationLength = static_cast<int>(resolved->ai_addrlen);
+    freeaddrinfo(resolved);
+
+    m_socket = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (m_socket == kInvalidSocket || !setNonBlocking(m_socket)) {
+        LOG_ERROR("Failed to create OSC socket: {}", lastSocketError());
+        closeSocket(m_socket);
+        m_socket = kInvalidSocket;
+        shutdownSockets();
+        return false;
+    }
+
+    const auto* destination = reinterpret_cast<const sockaddr_in*>(&m_destination);
+    const bool multicast = (ntohl(destination->sin_addr.s_addr) >> 28) == 0xE;
+    if (multicast) {
+        const int ttl = m_settings.multicastTtl;
+        setsockopt(m_socket, IPPROTO_IP, IP_MULTICAST_TTL, reinterpret_cast<const char*>(&ttl), sizeof(ttl));
+    }
+
+    // Addresses are built once; ticks only copy them into the datagram
+    for (Source& source : m_sources) {
+        source.levelsAddress = m_settings.addressPrefix + "/" + source.name + "/levels";
+        source.eventAddress = m_settings.addressPrefix + "/" + source.name + "/event";
+        // Send current values on the first tick; a source that never published
+        // has nothing to send until it does
+        const std::uint64_t version = source.source->snapshotVersion();
+        source.lastVersion = version == 0 ? 0 : version - 1;
+        source.eventCursor = source.source->events().tail();
+    }
+
+    m_buffer.assign(m_settings.maxDatagramBytes, 0);
+    m_encoder = OscEncoder(m_buffer.data(), m_buffer.size());
+
+    m_running.store(true);
+    m_thread = std::thread(&OscSender::run, this);
+
+    LOG_INFO("Sending OSC to {}:{}{}", m_settings.host, port, multicast ? " (multicast)" : "");
+    return true;
+}
+
+void OscSender::stop() {
+    {
+        std::lock_guard<std::mutex> lock(m_wakeMutex);
+        if (!m_running.exchange(false)) {
+            return;
+        }
+    }
+    m_wake.notify_all();
+
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+
+    closeSocket(m_socket);
+    m_socket = kInvalidSocket;
+    shutdownSockets();
+
+    LOG_INFO("OSC sender stopped");
+}
+
+void OscSender::run() {
+    TickSchedule schedule(m_settings.rateHz);
+    std::unique_lock<std::mutex> lock(m_wakeMutex);
+    while (m_running.load()) {
+        lock.unlock();
+        tick();
+        lock.lock();
+
+        schedule.advance(TickSchedule::Clock::now());
+        m_wake.wait_until(lock, schedule.next(), [this] { return !m_running.load(); });
+    }
+}
+
+void OscSender::tick() {
+    m_encoder.reset();
+    m_encoder.beginBundle();
+    std::size_t messages = 0;
+
+    for (Source& source : m_sources) {
+        const std::uint64_t version = source.source->snapshotVersion();
+        if (version != source.lastVersion) {
+            source.lastVersion = version;
+            const common::MeterSnapshot snapshot = source.source->latestSnapshot();
+
+            ensureRoom(OscEncoder::messageSize(source.levelsAddress.size(), kLevelsTags.size(), kLevelsArgumentBytes));
+            m_encoder.beginMessage(source.levelsAddress, kLevelsTags);
+            m_encoder.addFloat(snapshot.peak.left);
+            m_encoder.addFloat(snapshot.peak.right);
+            m_encoder.addFloat(snapshot.rms.left);
+            m_encoder.addFloat(snapshot.rms.right);
+            m_encoder.endMessage();
+            ++messages;
+        }
+
+        if (!m_settings.sendEvents) {
+            continue;
+        }
+        common::MeterEvent events[32];
+        std::size_t count = 0;
+        while ((count = source.source->events().read(source.eventCursor, events, std::size(events))) > 0) {
+            for (std::size_t i = 0; i < count; ++i) {
+                ensureRoom(OscEncoder::messageSize(source.eventAddress.size(), kEventTags.size(), kEventArgumentBytes));
+                m_encoder.beginMessage(source.eventAddress, kEventTags);
+                m_encoder.addString(common::meterEventWireName(events[i].type));
+                m_encoder.addInt(events[i].channel);
+                m_encoder.addInt64(static_cast<std::int64_t>(events[i].startFrame));
+                m_encoder.addFloat(events[i].magnitude);
+                m_encoder.endMessage();
+                ++messages;
+            }
+        }
+    }
+
+    if (messages > 0) {
+        flush();
+    }
+}
+
+void OscSender::ensureRoom(std::size_t messageBytes) {
+    if (m_encoder.size() + messageBytes > m_encoder.capacity() &&
+        m_encoder.size() > OscEncoder::kBundleHeaderSize) {
+        flush();
+        m_encoder.reset();
+        m_encoder.beginBundle();
+    }
+}
+
+void OscSender::flush() {
+    if (m_encoder.overflowed() || m_encoder.size() <= OscEncoder::kBundleHeaderSize) {
+        // A single message larger than a datagram (absurdly long source name)
+        m_datagramsDropped.fetch_add(1);
+        return;
+    }
+
+    const auto sent = sendto(
+        m_socket,
+        reinterpret_cast<const char*>(m_buffer.data()),
+        static_cast<int>(m_encoder.size()),
+        0,
+        reinterpret_cast<const sockaddr*>(&m_destination),
+        m_destinationLength
+    );
+    if (sent > 0 && static_cast<std::size_t>(sent) == m_encoder.size()) {
+        m_datagramsSent.fetch_add(1);
+    } else {
+        m_datagramsDropped.fetch_add(1);
+    }
+}
+
+} // namespace openmeters::core::net
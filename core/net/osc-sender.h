@@ -0,0 +1,119 @@
+#pragma once
+
+#include "socket.h"
+#include "osc-encoder.h"
+#include "../../common/meter-source.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace openmeters::core::net {
+
+/**
+ * OSC sender settings.
+ */
+struct OscSenderSettings {
+    std::string host = "127.0.0.1";      // IPv4 unicast or multicast (224.0.0.0/4) address
+    std::uint16_t port = 9000;
+    float rateHz = 30.0f;                 // Upper bound on bundles per second
+    std::string addressPrefix = "/openmeters";
+    std::size_t maxDatagramBytes = 1472;  // Largest unfragmented UDP payload on Ethernet
+    int multicastTtl = 1;                 // Hops for multicast destinations
+    bool sendEvents = true;
+};
+
+/**
+ * Sends meter values as OSC over UDP.
+ *
+ * Once per tick every source whose snapshot changed contributes one message
+ *
+ *   <prefix>/<source>/levels ,ffff   peakL peakR rmsL rmsR
+ *
+ * and each new journal entry one message
+ *
+ *   <prefix>/<source>/event ,sihf    type channel startFrame magnitude
+ *
+ * All messages of a tick go out in one bundle; the bundle is only split when
+ * it would exceed maxDatagramBytes. Packing a source's four levels into one
+ * message keeps it at 52 bytes in the bundle (size prefix included) for a
+ * short name such as "main", so a single 1472-byte datagram carries about
+ * 28 sources.
+ *
+ * Runs on its own thread and encodes into a preallocated buffer. Sends are
+ * non-blocking; a datagram the socket cannot take is dropped and counted.
+ *
+ * Thread safety: addSource/start/stop from one control thread.
+ */
+class OscSender {
+public:
+    OscSender() = default;
+    ~OscSender();
+
+    // Non-copyable, non-movable
+    OscSender(const OscSender&) = delete;
+    OscSender& operator=(const OscSender&) = delete;
+    OscSender(OscSender&&) = delete;
+    OscSender& operator=(OscSender&&) = delete;
+
+    /**
+     * Register a meter source. Must be called before start().
+     *
+     * @param name Address component for this source (e.g. "main")
+     * @param source Source (must outlive the sender)
+     */
+    bool addSource(const std::string& name, const common::IMeterSource* source);
+
+    /**
+     * Resolve the destination, open the socket and start the sender thread.
+     * Sources added after a previous stop() keep their names.
+     */
+    bool start(const OscSenderSettings& settings = OscSenderSettings());
+
+    /**
+     * Stop the sender thread and close the socket.
+     */
+    void stop();
+
+    [[nodiscard]] bool isRunning() const noexcept { return m_running.load(); }
+    [[nodiscard]] std::uint64_t datagramsSent() const noexcept { return m_datagramsSent.load(); }
+    [[nodiscard]] std::uint64_t datagramsDropped() const noexcept { return m_datagramsDropped.load(); }
+
+private:
+    struct Source {
+        std::string name;
+        const common::IMeterSource* source = nullptr;
+        std::string levelsAddress;
+        std::string eventAddress;
+        std::uint64_t lastVersion = 0;
+        common::MeterEventRing::Cursor eventCursor;
+    };
+
+    void run();
+    void tick();
+    void ensureRoom(std::size_t messageBytes);
+    void flush();
+
+    OscSenderSettings m_settings;
+    std::vector<Source> m_sources;
+
+    SocketHandle m_socket = kInvalidSocket;
+    sockaddr_storage m_destination{};
+    int m_destinationLength = 0;
+
+    // Preallocated datagram buffer and encoder over it
+    std::vector<std::uint8_t> m_buffer;
+    OscEncoder m_encoder{nullptr, 0};
+
+    std::thread m_thread;
+    std::mutex m_wakeMutex;
+    std::condition_variable m_wake;
+    std::atomic<bool> m_running{false};
+    std::atomic<std::uint64_t> m_datagramsSent{0};
+    std::atomic<std::uint64_t> m_datagramsDropped{0};
+};
+
+} // namespace openmeters::core::net
@@ -0,0 +1,137 @@
+#include "socket.h"
+#include <atomic>
+#include <cstring>
+
+#ifndef _WIN32
+#include <cerrno>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <signal.h>
+#include <sys/time.h>
+#include <unistd.h>
+#endif
+
+namespace openmeters::core::net {
+
+namespace {
+
+std::atomic<int> s_initCount{0};
+
+} // namespace
+
+bool initializeSockets() {
+#ifdef _WIN32
+    WSADATA data;
+    if (WSAStartup(MAKEWORD(2, 2), &data) != 0) {
+        return false;
+    }
+#else
+    // Writes to a closed peer must fail with EPIPE, not kill the process
+    if (s_initCount.load() == 0) {
+        signal(SIGPIPE, SIG_IGN);
+    }
+#endif
+    s_initCount.fetch_add(1);
+    return true;
+}
+
+void shutdownSockets() {
+    if (s_initCount.fetch_sub(1) <= 0) {
+        s_initCount.fetch_add(1);
+        return;
+    }
+#ifdef _WIN32
+    WSACleanup();
+#endif
+}
+
+void closeSocket(SocketHandle socket) {
+    if (socket == kInvalidSocket) {
+        return;
+    }
+#ifdef _WIN32
+    closesocket(socket);
+#else
+    close(socket);
+#endif
+}
+
+bool setNonBlocking(SocketHandle socket) {
+#ifdef _WIN32
+    u_long mode = 1;
+    return ioctlsocket(socket, FIONBIO, &mode) == 0;
+#else
+    const int flags = fcntl(socket, F_GETFL, 0);
+    return flags >= 0 && fcntl(socket, F_SETFL, flags | O_NONBLOCK) == 0;
+#endif
+}
+
+SocketHandle listenTcpLoopback(std::uint16_t port, std::uint16_t& boundPort) {
+    const SocketHandle listenSocket = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (listenSocket == kInvalidSocket) {
+        return kInvalidSocket;
+    }
+
+    // Allow an immediate restart while old connections sit in TIME_WAIT
+    // (Windows already behaves this way; SO_REUSEADDR there means port sharing)
+#ifndef _WIN32
+    const int reuse = 1;
+    setsockopt(listenSocket, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+#endif
+
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = htons(port);
+
+    sockaddr_in bound{};
+    socklen_t boundLength = sizeof(bound);
+    if (bind(listenSocket, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0 ||
+        listen(listenSocket, 16) != 0 ||
+        getsockname(listenSocket, reinterpret_cast<sockaddr*>(&bound), &boundLength) != 0) {
+        closeSocket(listenSocket);
+        return kInvalidSocket;
+    }
+
+    boundPort = ntohs(bound.sin_port);
+    return listenSocket;
+}
+
+bool setSocketTimeouts(SocketHandle socket, std::uint32_t timeoutMs) {
+#ifdef _WIN32
+    const DWORD timeout = timeoutMs;
+#else
+    timeval timeout{};
+    timeout.tv_sec = static_cast<time_t>(timeoutMs / 1000);
+    timeout.tv_usec = static_cast<suseconds_t>((timeoutMs % 1000) * 1000);
+#endif
+    const char* value = reinterpret_cast<const char*>(&timeout);
+    return setsockopt(socket, SOL_SOCKET, SO_RCVTIMEO, value, sizeof(timeout)) == 0 &&
+           setsockopt(socket, SOL_SOCKET, SO_SNDTIMEO, value, sizeof(timeout)) == 0;
+}
+
+bool lastErrorWouldBlock() {
+#ifdef _WIN32
+    return WSAGetLastError() == WSAEWOULDBLOCK;
+#else
+    return errno == EAGAIN || errno == EWOULDBLOCK;
+#endif
+}
+
+bool lastErrorConnectionRefused() {
+#ifdef _WIN32
+    return WSAGetLastError() == WSAECONNREFUSED;
+#else
+    return errno == ECONNREFUSED;
+#endif
+}
+
+std::string lastSocketError() {
+#ifdef _WIN32
+    return "WSA error " + std::to_string(WSAGetLastError());
+#else
+    return std::strerror(errno);
+#endif
+}
+
+} // namespace openmeters::core::net
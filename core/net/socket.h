@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <sys/socket.h>
+#endif
+
+namespace openmeters::core::net {
+
+#ifdef _WIN32
+using SocketHandle = SOCKET;
+inline constexpr SocketHandle kInvalidSocket = INVALID_SOCKET;
+#else
+using SocketHandle = int;
+inline constexpr SocketHandle kInvalidSocket = -1;
+#endif
+
+/**
+ * Initialise the socket library (WSAStartup on Windows).
+ * Reference counted; pair every successful call with shutdownSockets().
+ */
+bool initializeSockets();
+
+/**
+ * Release the socket library.
+ */
+void shutdownSockets();
+
+/**
+ * Close a socket handle (no-op for kInvalidSocket).
+ */
+void closeSocket(SocketHandle socket);
+
+/**
+ * Switch a socket to non-blocking mode.
+ */
+bool setNonBlocking(SocketHandle socket);
+
+/**
+ * Create a TCP socket listening on 127.0.0.1.
+ *
+ * @param port Port to bind (0 picks an ephemeral port)
+ * @param boundPort Receives the port actually bound
+ * @return Listening socket, or kInvalidSocket on failure
+ */
+[[nodiscard]] SocketHandle listenTcpLoopback(std::uint16_t port, std::uint16_t& boundPort);
+
+/**
+ * Bound blocking send/recv calls on a socket.
+ */
+bool setSocketTimeouts(SocketHandle socket, std::uint32_t timeoutMs);
+
+/**
+ * True if the last socket call failed only because it would block.
+ */
+[[nodiscard]] bool lastErrorWouldBlock();
+
+/**
+ * True if the last connect() failed because nothing is listening.
+ */
+[[nodiscard]] bool lastErrorConnectionRefused();
+
+/**
+ * Last socket error as text (for logging).
+ */
+[[nodiscard]] std::string lastSocketError();
+
+} // namespace openmeters::core::net
@@ -0,0 +1,228 @@
+#pragma once
+
+#include "../../common/meter-values.h"
+#include "../../common/meter-events.h"
+#include "../../common/wire-format.h"
+#include <cmath>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+namespace openmeters::core::net {
+
+/**
+ * Binary framing for the local meter streaming socket.
+ *
+ * Every frame is an 8-byte header followed by payloadLength bytes. All
+ * integers and floats are little-endian.
+ *
+ *   u16 magic ('O','M')  u8 version  u8 type  u32 payloadLength
+ *
+ * Client -> server:
+ *   Subscribe: u32 sourceMask, u32 meterMask, f32 rateHz
+ *
+ * Server -> client:
+ *   Hello:    u16 protocolVersion, u16 reserved, u32 sourceMask
+ *   Snapshot: u16 sourceId, u16 meterMask, u32 reserved, u64 timestampMs,
+ *             [f32 peakL, f32 peakR] if Peak, [f32 rmsL, f32 rmsR] if Rms
+ *   Event:    u16 sourceId, u8 type, u8 channel, u32 lengthFrames,
+ *             u64 startFrame, f32 magnitude
+ *   WireSnapshot (when kMeterWireFormat is subscribed):
+ *             u16 sourceId, u16 reserved, u32 reserved, then a message in the
+ *             common wire format (common/wire-format.h)
+ */
+namespace stream {
+
+inline constexpr std::uint16_t kMagic = 0x4D4F; // "OM"
+inline constexpr std::uint8_t kVersion = 1;
+inline constexpr std::size_t kHeaderSize = 8;
+inline constexpr std::size_t kMaxPayloadSize = 256;
+
+enum class FrameType : std::uint8_t {
+    Hello = 1,
+    Subscribe = 2,
+    Snapshot = 3,
+    Event = 4,
+    WireSnapshot = 5
+};
+
+/**
+ * Meter selection bits for Subscribe and Snapshot frames.
+ */
+enum MeterBits : std::uint32_t {
+    kMeterPeak = 1u << 0,
+    kMeterRms = 1u << 1,
+    kMeterEvents = 1u << 2,
+    kMeterWireFormat = 1u << 3 // Send snapshots as WireSnapshot frames
+};
+
+struct Subscribe {
+    std::uint32_t sourceMask = 1;
+    std::uint32_t meterMask = kMeterPeak | kMeterRms;
+    float rateHz = 30.0f;
+};
+
+inline constexpr std::size_t kSubscribeSize = 12;
+inline constexpr std::size_t kHelloSize = 8;
+inline constexpr std::size_t kEventSize = 24;
+inline constexpr std::size_t kMaxSnapshotSize = 16 + 16;
+
+// Little-endian field helpers (the engine only targets little-endian hosts,
+// so these are plain copies with explicit widths)
+inline void put16(std::uint8_t* out, std::uint16_t v) noexcept { std::memcpy(out, &v, 2); }
+inline void put32(std::uint8_t* out, std::uint32_t v) noexcept { std::memcpy(out, &v, 4); }
+inline void put64(std::uint8_t* out, std::uint64_t v) noexcept { std::memcpy(out, &v, 8); }
+inline void putF32(std::uint8_t* out, float v) noexcept { std::memcpy(out, &v, 4); }
+inline std::uint16_t get16(const std::uint8_t* in) noexcept { std::uint16_t v; std::memcpy(&v, in, 2); return v; }
+inline std::uint32_t get32(const std::uint8_t* in) noexcept { std::uint32_t v; std::memcpy(&v, in, 4); return v; }
+inline std::uint64_t get64(const std::uint8_t* in) noexcept { std::uint64_t v; std::memcpy(&v, in, 8); return v; }
+inline float getF32(const std::uint8_t* in) noexcept { float v; std::memcpy(&v, in, 4); return v; }
+
+/**
+ * Write a frame header.
+ */
+inline void writeHeader(std::uint8_t* out, FrameType type, std::uint32_t payloadLength) noexcept {
+    put16(out, kMagic);
+    out[2] = kVersion;
+    out[3] = static_cast<std::uint8_t>(type);
+    put32(out + 4, payloadLength);
+}
+
+/**
+ * Parse a frame header.
+ *
+ * @return false if the header is malformed
+ */
+inline bool readHeader(const std::uint8_t* in, FrameType& type, std::uint32_t& payloadLength) noexcept {
+    if (get16(in) != kMagic || in[2] != kVersion) {
+        return false;
+    }
+    type = static_cast<FrameType>(in[3]);
+    payloadLength = get32(in + 4);
+    return payloadLength <= kMaxPayloadSize;
+}
+
+/**
+ * Encode a complete Subscribe frame.
+ *
+ * @return Bytes written (kHeaderSize + kSubscribeSize)
+ */
+inline std::size_t encodeSubscribe(std::uint8_t* out, const Subscribe& subscribe) noexcept {
+    writeHeader(out, FrameType::Subscribe, kSubscribeSize);
+    put32(out + 8, subscribe.sourceMask);
+    put32(out + 12, subscribe.meterMask);
+    putF32(out + 16, subscribe.rateHz);
+    return kHeaderSize + kSubscribeSize;
+}
+
+/**
+ * Decode a Subscribe payload.
+ *
+ * @return false if the payload is short or the rate is not finite
+ */
+inline bool decodeSubscribe(const std::uint8_t* payload, std::size_t length, Subscribe& subscribe) noexcept {
+    if (length < kSubscribeSize) {
+        return false;
+    }
+    subscribe.sourceMask = get32(payload);
+    subscribe.meterMask = get32(payload + 4);
+    subscribe.rateHz = getF32(payload + 8);
+    return std::isfinite(subscribe.rateHz); // NaN or infinite rates are malformed
+}
+
+/**
+ * Encode a complete Hello frame.
+ */
+inline std::size_t encodeHello(std::uint8_t* out, std::uint32_t sourceMask) noexcept {
+    writeHeader(out, FrameType::Hello, kHelloSize);
+    put16(out + 8, kVersion);
+    put16(out + 10, 0);
+    put32(out + 12, sourceMask);
+    return kHeaderSize + kHelloSize;
+}
+
+/**
+ * Encode a complete Snapshot frame containing only the selected meters.
+ *
+ * @return Bytes written (at most kHeaderSize + kMaxSnapshotSize)
+ */
+inline std::size_t encodeSnapshot(
+    std::uint8_t* out,
+    std::uint16_t sourceId,
+    std::uint32_t meterMask,
+    const common::MeterSnapshot& snapshot
+) noexcept {
+    std::uint8_t* p = out + kHeaderSize;
+    put16(p, sourceId);
+    put16(p + 2, static_cast<std::uint16_t>(meterMask & (kMeterPeak | kMeterRms)));
+    put32(p + 4, 0);
+    put64(p + 8, snapshot.timestampMs);
+    p += 16;
+
+    if (meterMask & kMeterPeak) {
+        putF32(p, snapshot.peak.left);
+        putF32(p + 4, snapshot.peak.right);
+        p += 8;
+    }
+    if (meterMask & kMeterRms) {
+        putF32(p, snapshot.rms.left);
+        putF32(p + 4, snapshot.rms.right);
+        p += 8;
+    }
+
+    const auto payloadLength = static_cast<std::uint32_t>(p - out - kHeaderSize);
+    writeHeader(out, FrameType::Snapshot, payloadLength);
+    return kHeaderSize + payloadLength;
+}
+
+inline constexpr std::size_t kWireSnapshotPrefixSize = 8;
+inline constexpr std::size_t kMaxWireSnapshotSize = kWireSnapshotPrefixSize + common::wire::maxSnapshotSize();
+static_assert(kMaxWireSnapshotSize <= kMaxPayloadSize, "WireSnapshot must fit a frame");
+
+/**
+ * Encode a complete WireSnapshot frame. The wire message is serialized
+ * straight into the frame; out must be 8-byte aligned.
+ *
+ * @return Bytes written (0 if the snapshot did not fit)
+ */
+inline std::size_t encodeWireSnapshot(
+    std::uint8_t* out,
+    std::uint16_t sourceId,
+    const common::MeterSnapshot& snapshot,
+    const common::AudioFormat& format
+) noexcept {
+    std::uint8_t* p = out + kHeaderSize;
+    put16(p, sourceId);
+    put16(p + 2, 0);
+    put32(p + 4, 0);
+
+    const std::size_t messageSize = common::wire::encodeSnapshot(
+        p + kWireSnapshotPrefixSize, kMaxWireSnapshotSize - kWireSnapshotPrefixSize, snapshot, format
+    );
+    if (messageSize == 0) {
+        return 0;
+    }
+    const auto payloadLength = static_cast<std::uint32_t>(kWireSnapshotPrefixSize + messageSize);
+    writeHeader(out, FrameType::WireSnapshot, payloadLength);
+    return kHeaderSize + payloadLength;
+}
+
+/**
+ * Encode a complete Event frame.
+ */
+inline std::size_t encodeEvent(std::uint8_t* out, std::uint16_t sourceId, const common::MeterEvent& event) noexcept {
+    writeHeader(out, FrameType::Event, kEventSize);
+    std::uint8_t* p = out + kHeaderSize;
+    put16(p, sourceId);
+    p[2] = static_cast<std::uint8_t>(event.type);
+    p[3] = event.channel;
+    put32(p + 4, event.lengthFrames);
+    put64(p + 8, event.startFrame);
+    putF32(p + 16, event.magnitude);
+    put32(p + 20, 0);
+    return kHeaderSize + kEventSize;
+}
+
+} // namespace stream
+
+} // namespace openmeters::core::net
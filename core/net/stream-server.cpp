@@ -0,0 +1,526 @@
+#include "stream-server.h"
+#include "../../common/logger.h"
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+
+#ifdef _WIN32
+#include <afunix.h>
+#else
+#include <sys/epoll.h>
+#include <sys/uio.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace openmeters::core::net {
+
+namespace {
+
+// Upper bound on one wait so stop() is noticed promptly
+constexpr int kMaxWaitMs = 50;
+
+} // namespace
+
+std::string defaultStreamSocketPath() {
+#ifdef _WIN32
+    char tempPath[MAX_PATH];
+    const DWORD length = GetTempPathA(MAX_PATH, tempPath);
+    if (length > 0 && length < MAX_PATH) {
+        return (std::filesystem::path(tempPath) / "openmeters.sock").string();
+    }
+    return "openmeters.sock";
+#else
+    const char* runtimeDir = std::getenv("XDG_RUNTIME_DIR");
+    const std::filesystem::path base = (runtimeDir && *runtimeDir) ? runtimeDir : "/tmp";
+    return (base / "openmeters.sock").string();
+#endif
+}
+
+StreamServer::~StreamServer() {
+    stop();
+}
+
+bool StreamServer::addSource(std::uint16_t sourceId, const common::IMeterSource* source) {
+    if (m_running.load() || sourceId >= kMaxSources || !source) {
+        return false;
+    }
+    m_sources[sourceId] = source;
+    m_sourceMask |= 1u << sourceId;
+    return true;
+}
+
+bool StreamServer::start(const StreamServerSettings& settings) {
+    if (m_running.load()) {
+        return true;
+    }
+
+    m_settings = settings;
+    if (m_settings.socketPath.empty()) {
+        m_settings.socketPath = defaultStreamSocketPath();
+    }
+
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if (m_settings.socketPath.size() >= sizeof(address.sun_path)) {
+        LOG_ERROR("Stream socket path too long: {}", m_settings.socketPath);
+        return false;
+    }
+    std::copy(m_settings.socketPath.begin(), m_settings.socketPath.end(), address.sun_path);
+
+    if (!initializeSockets()) {
+        LOG_ERROR("Failed to initialize sockets");
+        return false;
+    }
+
+    // A socket file left by a crashed run would make bind fail. Remove it
+    // only if nothing answers on it; a live server keeps its path
+    std::error_code ignored;
+    if (std::filesystem::exists(m_settings.socketPath, ignored)) {
+        const SocketHandle probe = socket(AF_UNIX, SOCK_STREAM, 0);
+        const bool connected = probe != kInvalidSocket &&
+            connect(probe, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0;
+        const bool stale = !connected && probe != kInvalidSocket && lastErrorConnectionRefused();
+        closeSocket(probe);
+        if (!stale) {
+            LOG_ERROR("Stream socket {} is in use by another server", m_settings.socketPath);
+            shutdownSockets();
+            return false;
+        }
+        std::filesystem::remove(m_settings.socketPath, ignored);
+    }
+
+    m_listenSocket = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (m_listenSocket == kInvalidSocket ||
+        bind(m_listenSocket, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0 ||
+        listen(m_listenSocket, 64) != 0 ||
+        !setNonBlocking(m_listenSocket)) {
+        LOG_ERROR("Failed to listen on stream socket {}: {}", m_settings.socketPath, lastSocketError());
+        closeSocket(m_listenSocket);
+        m_listenSocket = kInvalidSocket;
+        shutdownSockets();
+        return false;
+    }
+
+#ifndef _WIN32
+    m_epoll = epoll_create1(EPOLL_CLOEXEC);
+    epoll_event listenEvent{};
+    listenEvent.events = EPOLLIN;
+    listenEvent.data.ptr = nullptr; // nullptr marks the listening socket
+    if (m_epoll < 0 || epoll_ctl(m_epoll, EPOLL_CTL_ADD, m_listenSocket, &listenEvent) != 0) {
+        LOG_ERROR("Failed to create epoll instance: {}", lastSocketError());
+        if (m_epoll >= 0) {
+            ::close(m_epoll);
+            m_epoll = -1;
+        }
+        closeSocket(m_listenSocket);
+        m_listenSocket = kInvalidSocket;
+        shutdownSockets();
+        return false;
+    }
+#endif
+
+    m_clients.reserve(m_settings.maxClients);
+    m_running.store(true);
+    m_thread = std::thread(&StreamServer::run, this);
+
+    LOG_INFO("Meter stream server listening on {}", m_settings.socketPath);
+    return true;
+}
+
+void StreamServer::stop() {
+    if (!m_running.exchange(false)) {
+        return;
+    }
+
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+
+    for (auto& client : m_clients) {
+        closeClient(*client);
+    }
+    m_clients.clear();
+    m_clientCount.store(0);
+
+#ifndef _WIN32
+    if (m_epoll >= 0) {
+        ::close(m_epoll);
+        m_epoll = -1;
+    }
+#endif
+
+    closeSocket(m_listenSocket);
+    m_listenSocket = kInvalidSocket;
+
+    std::error_code ignored;
+    std::filesystem::remove(m_settings.socketPath, ignored);
+    shutdownSockets();
+
+    LOG_INFO("Meter stream server stopped");
+}
+
+void StreamServer::run() {
+#ifdef _WIN32
+    std::vector<WSAPOLLFD> pollSet;
+    pollSet.reserve(m_settings.maxClients + 1);
+#else
+    std::array<epoll_event, 64> ready{};
+#endif
+
+    while (m_running.load()) {
+        // Sleep until the next client is due (or a socket needs attention)
+        Clock::time_point now = Clock::now();
+        auto wait = std::chrono::milliseconds(kMaxWaitMs);
+        for (const auto& client : m_clients) {
+            if (client->subscribed) {
+                const auto untilDue = std::chrono::duration_cast<std::chrono::milliseconds>(client->nextDue - now);
+                wait = std::clamp(untilDue, std::chrono::milliseconds(0), wait);
+            }
+        }
+        const int timeoutMs = static_cast<int>(wait.count());
+
+#ifdef _WIN32
+        pollSet.clear();
+        pollSet.push_back(WSAPOLLFD{m_listenSocket, POLLRDNORM, 0});
+        for (const auto& client : m_clients) {
+            const SHORT events = static_cast<SHORT>(POLLRDNORM | (client->wantsWrite ? POLLWRNORM : 0));
+            pollSet.push_back(WSAPOLLFD{client->socket, events, 0});
+        }
+
+        const int count = WSAPoll(pollSet.data(), static_cast<ULONG>(pollSet.size()), timeoutMs);
+        if (count > 0) {
+            for (std::size_t i = 1; i < pollSet.size(); ++i) {
+                Client& client = *m_clients[i - 1];
+                const SHORT revents = pollSet[i].revents;
+                if (revents & (POLLERR | POLLHUP | POLLNVAL)) {
+                    client.closing = true;
+                    continue;
+                }
+                if (revents & POLLRDNORM) {
+                    readClient(client);
+                }
+                if ((revents & POLLWRNORM) && !client.closing) {
+                    flush(client);
+                }
+            }
+            if (pollSet[0].revents & POLLRDNORM) {
+                acceptClients();
+            }
+        }
+#else
+        const int count = epoll_wait(m_epoll, ready.data(), static_cast<int>(ready.size()), timeoutMs);
+        for (int i = 0; i < count; ++i) {
+            auto* client = static_cast<Client*>(ready[i].data.ptr);
+            if (!client) {
+                acceptClients();
+                continue;
+            }
+            if (client->closing) {
+                continue;
+            }
+            if (ready[i].events & (EPOLLERR | EPOLLHUP)) {
+                client->closing = true;
+                continue;
+            }
+            if (ready[i].events & EPOLLIN) {
+                readClient(*client);
+            }
+            if ((ready[i].events & EPOLLOUT) && !client->closing) {
+                flush(*client);
+            }
+        }
+#endif
+
+        // Produce and send frames for every client whose tick is due
+        now = Clock::now();
+        for (auto& client : m_clients) {
+            if (!client->subscribed || client->closing || now < client->nextDue) {
+                continue;
+            }
+            produceFrames(*client, now);
+            if (!client->closing) {
+                flush(*client);
+            }
+            client->nextDue += client->period;
+            if (client->nextDue < now) {
+                client->nextDue = now + client->period;
+            }
+        }
+
+        // Reap disconnected and dropped clients
+        for (auto& client : m_clients) {
+            if (client->closing) {
+                closeClient(*client);
+            }
+        }
+        m_clients.erase(
+            std::remove_if(m_clients.begin(), m_clients.end(),
+                           [](const std::unique_ptr<Client>& client) { return client->socket == kInvalidSocket; }),
+            m_clients.end()
+        );
+        m_clientCount.store(m_clients.size());
+    }
+}
+
+void StreamServer::acceptClients() {
+    for (;;) {
+        const SocketHandle socket = accept(m_listenSocket, nullptr, nullptr);
+        if (socket == kInvalidSocket) {
+            return;
+        }
+
+        if (m_clients.size() >= m_settings.maxClients || !setNonBlocking(socket)) {
+            closeSocket(socket);
+            continue;
+        }
+
+        auto client = std::make_unique<Client>();
+        client->socket = socket;
+        client->queue.resize(m_settings.sendQueueBytes);
+
+#ifndef _WIN32
+        epoll_event event{};
+        event.events = EPOLLIN;
+        event.data.ptr = client.get();
+        if (epoll_ctl(m_epoll, EPOLL_CTL_ADD, socket, &event) != 0) {
+            closeSocket(socket);
+            continue;
+        }
+#endif
+
+        std::uint8_t hello[stream::kHeaderSize + stream::kHelloSize];
+        const std::size_t size = stream::encodeHello(hello, m_sourceMask);
+        enqueue(*client, hello, size, Clock::now());
+        flush(*client);
+
+        LOG_DEBUG("Stream client connected");
+        m_clients.push_back(std::move(client));
+    }
+}
+
+void StreamServer::readClient(Client& client) {
+    for (;;) {
+        const std::size_t space = client.inbox.size() - client.inboxSize;
+        const auto received = recv(client.socket,
+                                   reinterpret_cast<char*>(client.inbox.data() + client.inboxSize),
+                                   static_cast<int>(space), 0);
+        if (received == 0) {
+            client.closing = true;
+            return;
+        }
+        if (received < 0) {
+            if (!lastErrorWouldBlock()) {
+                client.closing = true;
+            }
+            return;
+        }
+        client.inboxSize += static_cast<std::size_t>(received);
+
+        // Dispatch every complete frame in the inbox
+        std::size_t offset = 0;
+        while (client.inboxSize - offset >= stream::kHeaderSize) {
+            stream::FrameType type;
+            std::uint32_t payloadLength = 0;
+            if (!stream::readHeader(client.inbox.data() + offset, type, payloadLength)) {
+                LOG_WARNING("Malformed frame from stream client, disconnecting");
+                client.closing = true;
+                return;
+            }
+            if (client.inboxSize - offset < stream::kHeaderSize + payloadLength) {
+                break;
+            }
+            handleFrame(client, type, client.inbox.data() + offset + stream::kHeaderSize, payloadLength);
+            offset += stream::kHeaderSize + payloadLength;
+        }
+
+        if (offset > 0) {
+            std::copy(client.inbox.begin() + static_cast<std::ptrdiff_t>(offset),
+                      client.inbox.begin() + static_cast<std::ptrdiff_t>(client.inboxSize),
+                      client.inbox.begin());
+            client.inboxSize -= offset;
+        }
+    }
+}
+
+void StreamServer::handleFrame(Client& client, stream::FrameType type, const std::uint8_t* payload, std::size_t length) {
+    if (type != stream::FrameType::Subscribe) {
+        return; // Unknown client frames are ignored for forward compatibility
+    }
+
+    stream::Subscribe subscribe;
+    if (!stream::decodeSubscribe(payload, length, subscribe)) {
+        client.closing = true;
+        return;
+    }
+
+    subscribe.sourceMask &= m_sourceMask;
+    subscribe.rateHz = std::clamp(subscribe.rateHz, 1.0f, m_settings.maxRateHz);
+
+    client.subscription = subscribe;
+    client.period = std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(1.0 / static_cast<double>(subscribe.rateHz))
+    );
+    client.nextDue = Clock::now();
+    client.lastVersion.fill(0);
+    for (std::size_t id = 0; id < kMaxSources; ++id) {
+        if (subscribe.sourceMask & (1u << id)) {
+            client.eventCursors[id] = m_sources[id]->events().tail();
+        }
+    }
+    client.subscribed = true;
+}
+
+void StreamServer::produceFrames(Client& client, Clock::time_point now) {
+    const stream::Subscribe& subscription = client.subscription;
+    alignas(8) std::uint8_t frame[stream::kHeaderSize + stream::kMaxPayloadSize];
+
+    for (std::size_t id = 0; id < kMaxSources; ++id) {
+        if (!(subscription.sourceMask & (1u << id))) {
+            continue;
+        }
+        const common::IMeterSource* source = m_sources[id];
+        const auto sourceId = static_cast<std::uint16_t>(id);
+
+        // Snapshot, only when the source produced a new one
+        if (subscription.meterMask & (stream::kMeterPeak | stream::kMeterRms)) {
+            const std::uint64_t version = source->snapshotVersion();
+            if (version != client.lastVersion[id]) {
+                client.lastVersion[id] = version;
+                const std::size_t size = (subscription.meterMask & stream::kMeterWireFormat)
+                    ? stream::encodeWireSnapshot(frame, sourceId, source->latestSnapshot(), source->getFormat())
+                    : stream::encodeSnapshot(frame, sourceId, subscription.meterMask, source->latestSnapshot());
+                if (!enqueue(client, frame, size, now)) {
+                    return;
+                }
+            }
+        }
+
+        // Events journaled since the last tick. Only as many are taken from
+        // the journal as the queue has room for; the rest wait for the next tick
+        if (subscription.meterMask & stream::kMeterEvents) {
+            constexpr std::size_t kEventFrameSize = stream::kHeaderSize + stream::kEventSize;
+            common::MeterEventRing::Cursor& cursor = client.eventCursors[id];
+            common::MeterEvent events[16];
+            while (source->events().writePosition() > cursor.position) {
+                const std::size_t room = (client.queue.size() - client.queueSize) / kEventFrameSize;
+                if (room == 0) {
+                    noteQueueFull(client, now);
+                    return;
+                }
+                const std::size_t count = source->events().read(cursor, events, std::min(room, std::size(events)));
+                for (std::size_t i = 0; i < count; ++i) {
+                    const std::size_t size = stream::encodeEvent(frame, sourceId, events[i]);
+                    enqueue(client, frame, size, now);
+                }
+            }
+        }
+    }
+}
+
+bool StreamServer::enqueue(Client& client, const std::uint8_t* data, std::size_t size, Clock::time_point now) {
+    const std::size_t capacity = client.queue.size();
+
+    if (capacity - client.queueSize < size) {
+        // Slow client: drop this frame
+        noteQueueFull(client, now);
+        return false;
+    }
+
+    client.isFull = false;
+    std::size_t tail = (client.queueHead + client.queueSize) % capacity;
+    const std::size_t first = std::min(size, capacity - tail);
+    std::copy(data, data + first, client.queue.begin() + static_cast<std::ptrdiff_t>(tail));
+    std::copy(data + first, data + size, client.queue.begin());
+    client.queueSize += size;
+    return true;
+}
+
+void StreamServer::noteQueueFull(Client& client, Clock::time_point now) {
+    // Drop the client if its queue stays full
+    if (!client.isFull) {
+        client.isFull = true;
+        client.fullSince = now;
+    } else if (now - client.fullSince > std::chrono::milliseconds(m_settings.slowClientTimeoutMs)) {
+        LOG_WARNING("Dropping slow stream client");
+        m_droppedClients.fetch_add(1);
+        client.closing = true;
+    }
+}
+
+void StreamServer::flush(Client& client) {
+    const std::size_t capacity = client.queue.size();
+
+    while (client.queueSize > 0) {
+        // Queued frames form at most two contiguous runs; send both in one call
+        const std::size_t first = std::min(client.queueSize, capacity - client.queueHead);
+        const std::size_t second = client.queueSize - first;
+
+#ifdef _WIN32
+        WSABUF buffers[2];
+        buffers[0].buf = reinterpret_cast<char*>(client.queue.data() + client.queueHead);
+        buffers[0].len = static_cast<ULONG>(first);
+        buffers[1].buf = reinterpret_cast<char*>(client.queue.data());
+        buffers[1].len = static_cast<ULONG>(second);
+        DWORD sent = 0;
+        const int result = WSASend(client.socket, buffers, second > 0 ? 2 : 1, &sent, 0, nullptr, nullptr);
+        const long long written = result == 0 ? static_cast<long long>(sent) : -1;
+#else
+        iovec buffers[2];
+        buffers[0].iov_base = client.queue.data() + client.queueHead;
+        buffers[0].iov_len = first;
+        buffers[1].iov_base = client.queue.data();
+        buffers[1].iov_len = second;
+        const long long written = writev(client.socket, buffers, second > 0 ? 2 : 1);
+#endif
+
+        if (written < 0) {
+            if (lastErrorWouldBlock()) {
+                if (!client.wantsWrite) {
+                    client.wantsWrite = true;
+                    updateInterest(client);
+                }
+            } else {
+                client.closing = true;
+            }
+            return;
+        }
+
+        client.queueHead = (client.queueHead + static_cast<std::size_t>(written)) % capacity;
+        client.queueSize -= static_cast<std::size_t>(written);
+    }
+
+    client.queueHead = 0;
+    client.isFull = false;
+    if (client.wantsWrite) {
+        client.wantsWrite = false;
+        updateInterest(client);
+    }
+}
+
+void StreamServer::updateInterest(Client& client) {
+#ifdef _WIN32
+    (void)client; // The poll set is rebuilt every iteration
+#else
+    epoll_event event{};
+    event.events = EPOLLIN | (client.wantsWrite ? EPOLLOUT : 0u);
+    event.data.ptr = &client;
+    epoll_ctl(m_epoll, EPOLL_CTL_MOD, client.socket, &event);
+#endif
+}
+
+void StreamServer::closeClient(Client& client) {
+    if (client.socket == kInvalidSocket) {
+        return;
+    }
+#ifndef _WIN32
+    if (m_epoll >= 0) {
+        epoll_ctl(m_epoll, EPOLL_CTL_DEL, client.socket, nullptr);
+    }
+#endif
+    closeSocket(client.socket);
+    client.socket = kInvalidSocket;
+    LOG_DEBUG("Stream client disconnected");
+}
+
+} // namespace openmeters::core::net
@@ -0,0 +1,141 @@
+#pragma once
+
+#include "socket.h"
+#include "stream-protocol.h"
+#include "../../common/meter-source.h"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace openmeters::core::net {
+
+/**
+ * Stream server settings.
+ */
+struct StreamServerSettings {
+    std::string socketPath;                   // Empty: defaultStreamSocketPath()
+    std::size_t maxClients = 512;
+    std::size_t sendQueueBytes = 16 * 1024;   // Per-client bound
+    float maxRateHz = 240.0f;
+    std::uint32_t slowClientTimeoutMs = 2000; // Drop clients whose queue stays full this long
+};
+
+/**
+ * Default socket path: %TEMP%\openmeters.sock on Windows,
+ * $XDG_RUNTIME_DIR/openmeters.sock (or /tmp) elsewhere.
+ */
+[[nodiscard]] std::string defaultStreamSocketPath();
+
+/**
+ * Local meter streaming server on a Unix domain socket.
+ *
+ * Clients connect, send a Subscribe frame (sources, meters, rate) and then
+ * receive binary Snapshot/Event frames (see stream-protocol.h). One thread
+ * multiplexes all clients with epoll (WSAPoll on Windows). Each client has a
+ * fixed-size send ring that is flushed with a single writev per tick; a
+ * client whose ring stays full past the timeout is disconnected rather than
+ * allowed to hold up anyone else. Meter values are read from the sources'
+ * lock-free views, so the engine never notices the subscribers.
+ *
+ * Thread safety: addSource/start/stop from one control thread.
+ */
+class StreamServer {
+public:
+    static constexpr std::size_t kMaxSources = 32;
+
+    StreamServer() = default;
+    ~StreamServer();
+
+    // Non-copyable, non-movable
+    StreamServer(const StreamServer&) = delete;
+    StreamServer& operator=(const StreamServer&) = delete;
+    StreamServer(StreamServer&&) = delete;
+    StreamServer& operator=(StreamServer&&) = delete;
+
+    /**
+     * Register a meter source. Must be called before start().
+     *
+     * @param sourceId Source index (0-31) used in subscriptions and frames
+     * @param source Source (must outlive the server)
+     * @return false if the id is out of range or the server is running
+     */
+    bool addSource(std::uint16_t sourceId, const common::IMeterSource* source);
+
+    /**
+     * Bind the socket and start the server thread. A leftover socket file
+     * is replaced only when nothing is listening on it; fails if another
+     * server owns the path.
+     */
+    bool start(const StreamServerSettings& settings = StreamServerSettings());
+
+    /**
+     * Disconnect all clients and stop the server thread.
+     */
+    void stop();
+
+    [[nodiscard]] bool isRunning() const noexcept { return m_running.load(); }
+    [[nodiscard]] std::size_t clientCount() const noexcept { return m_clientCount.load(); }
+    [[nodiscard]] std::uint64_t droppedClients() const noexcept { return m_droppedClients.load(); }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Client {
+        SocketHandle socket = kInvalidSocket;
+
+        // Bounded send ring
+        std::vector<std::uint8_t> queue;
+        std::size_t queueHead = 0;
+        std::size_t queueSize = 0;
+        bool wantsWrite = false;
+        Clock::time_point fullSince{};
+        bool isFull = false;
+
+        // Partial inbound frame
+        std::array<std::uint8_t, stream::kHeaderSize + stream::kMaxPayloadSize> inbox{};
+        std::size_t inboxSize = 0;
+
+        // Subscription
+        bool subscribed = false;
+        stream::Subscribe subscription;
+        Clock::duration period{};
+        Clock::time_point nextDue{};
+        std::array<std::uint64_t, kMaxSources> lastVersion{};
+        std::array<common::MeterEventRing::Cursor, kMaxSources> eventCursors{};
+
+        bool closing = false;
+    };
+
+    void run();
+    void acceptClients();
+    void readClient(Client& client);
+    void handleFrame(Client& client, stream::FrameType type, const std::uint8_t* payload, std::size_t length);
+    void produceFrames(Client& client, Clock::time_point now);
+    bool enqueue(Client& client, const std::uint8_t* data, std::size_t size, Clock::time_point now);
+    void noteQueueFull(Client& client, Clock::time_point now);
+    void flush(Client& client);
+    void updateInterest(Client& client);
+    void closeClient(Client& client);
+
+    StreamServerSettings m_settings;
+    std::array<const common::IMeterSource*, kMaxSources> m_sources{};
+    std::uint32_t m_sourceMask = 0;
+
+    SocketHandle m_listenSocket = kInvalidSocket;
+    std::vector<std::unique_ptr<Client>> m_clients;
+
+#ifndef _WIN32
+    int m_epoll = -1;
+#endif
+
+    std::thread m_thread;
+    std::atomic<bool> m_running{false};
+    std::atomic<std::size_t> m_clientCount{0};
+    std::atomic<std::uint64_t> m_droppedClients{0};
+};
+
+} // namespace openmeters::core::net
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <chrono>
+
+namespace openmeters::core::net {
+
+/**
+ * Fixed-cadence tick clock shared by the sender threads.
+ *
+ * Ticks are due every 1/rateHz seconds from the start. A tick that runs
+ * late moves the schedule on instead of leaving a backlog, so a stalled
+ * thread resumes at the normal rate rather than bursting to catch up.
+ *
+ *   TickSchedule schedule(rateHz);
+ *   while (running) {
+ *       tick();
+ *       schedule.advance(TickSchedule::Clock::now());
+ *       wait_until(schedule.next());
+ *   }
+ *
+ * Thread safety: None; owned by one thread.
+ */
+class TickSchedule {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit TickSchedule(double rateHz, Clock::time_point start = Clock::now()) noexcept
+        : m_period(std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / rateHz)))
+        , m_next(start) {}
+
+    /**
+     * Time the next tick is due.
+     */
+    [[nodiscard]] Clock::time_point next() const noexcept { return m_next; }
+
+    [[nodiscard]] bool due(Clock::time_point now) const noexcept { return now >= m_next; }
+
+    /**
+     * Schedule the tick after the one just run; @p now is the current time.
+     */
+    void advance(Clock::time_point now) noexcept {
+        m_next += m_period;
+        if (m_next < now) {
+            m_next = now + m_period; // Skip missed ticks
+        }
+    }
+
+private:
+    Clock::duration m_period;
+    Clock::time_point m_next;
+};
+
+} // namespace openmeters::core::net
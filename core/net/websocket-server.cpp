@@ -0,0 +1,487 @@
+#include "websocket-server.h"
+#include "tick-schedule.h"
+#include "../../common/logger.h"
+#include <algorithm>
+#include <cctype>
+
+#ifndef _WIN32
+#include <poll.h>
+#endif
+
+namespace openmeters::core::net {
+
+namespace {
+
+// Upper bound on one wait so stop() is noticed promptly
+constexpr int kMaxWaitMs = 50;
+
+// Handshake requests and client frames are small; anything larger is hostile
+constexpr std::size_t kMaxInboxSize = 8 * 1024;
+constexpr std::size_t kMaxClientPayload = 125;
+
+#ifdef _WIN32
+using PollEntry = WSAPOLLFD;
+constexpr SHORT kReadable = POLLRDNORM;
+constexpr SHORT kWritable = POLLWRNORM;
+int pollSockets(PollEntry* entries, std::size_t count, int timeoutMs) {
+    return WSAPoll(entries, static_cast<ULONG>(count), timeoutMs);
+}
+#else
+using PollEntry = pollfd;
+constexpr short kReadable = POLLIN;
+constexpr short kWritable = POLLOUT;
+int pollSockets(PollEntry* entries, std::size_t count, int timeoutMs) {
+    return poll(entries, static_cast<nfds_t>(count), timeoutMs);
+}
+#endif
+
+/**
+ * Value of an HTTP header (case-insensitive name), or empty.
+ */
+std::string_view headerValue(std::string_view request, std::string_view name) {
+    std::size_t lineStart = request.find("\r\n");
+    while (lineStart != std::string_view::npos) {
+        lineStart += 2;
+        const std::size_t lineEnd = request.find("\r\n", lineStart);
+        const std::string_view line = request.substr(lineStart, lineEnd - lineStart);
+        const std::size_t colon = line.find(':');
+        if (colon == name.size() &&
+            std::equal(name.begin(), name.end(), line.begin(), [](char a, char b) {
+                return std::tolower(static_cast<unsigned char>(a)) == std::tolower(static_cast<unsigned char>(b));
+            })) {
+            std::string_view value = line.substr(colon + 1);
+            while (!value.empty() && value.front() == ' ') {
+                value.remove_prefix(1);
+            }
+            while (!value.empty() && value.back() == ' ') {
+                value.remove_suffix(1);
+            }
+            return value;
+        }
+        lineStart = lineEnd;
+    }
+    return std::string_view();
+}
+
+} // namespace
+
+WebSocketServer::~WebSocketServer() {
+    stop();
+}
+
+bool WebSocketServer::addSource(const std::string& name, const common::IMeterSource* source) {
+    if (m_running.load() || !source || m_sources.size() >= 0xFFFF) {
+        return false;
+    }
+    m_names.push_back(name.substr(0, 255));
+    m_sources.push_back(source);
+    return true;
+}
+
+bool WebSocketServer::start(const WebSocketServerSettings& settings) {
+    if (m_running.load()) {
+        return true;
+    }
+
+    m_settings = settings;
+    m_settings.tickRateHz = std::clamp(m_settings.tickRateHz, 1.0f, 240.0f);
+    m_settings.historyTicks = std::max<std::size_t>(m_settings.historyTicks, 2);
+
+    if (!initializeSockets()) {
+        LOG_ERROR("Failed to initialize sockets");
+        return false;
+    }
+
+    m_listenSocket = listenTcpLoopback(m_settings.port, m_port);
+    if (m_listenSocket == kInvalidSocket || !setNonBlocking(m_listenSocket)) {
+        LOG_ERROR("Failed to listen on WebSocket port {}: {}", m_settings.port, lastSocketError());
+        closeSocket(m_listenSocket);
+        m_listenSocket = kInvalidSocket;
+        shutdownSockets();
+        return false;
+    }
+
+    // Hello is identical for every client, so build it once
+    m_hello.clear();
+    m_hello.resize(8);
+    m_hello[0] = static_cast<std::uint8_t>(dashboard::MessageType::Hello);
+    m_hello[1] = dashboard::kVersion;
+    stream::put16(m_hello.data() + 2, static_cast<std::uint16_t>(dashboard::kFieldsPerSource));
+    stream::put16(m_hello.data() + 4, static_cast<std::uint16_t>(m_sources.size()));
+    stream::put16(m_hello.data() + 6, static_cast<std::uint16_t>(m_settings.tickRateHz));
+    for (const std::string& name : m_names) {
+        m_hello.push_back(static_cast<std::uint8_t>(name.size()));
+        m_hello.insert(m_hello.end(), name.begin(), name.end());
+    }
+
+    m_history.assign(m_settings.historyTicks * m_sources.size() * dashboard::kFieldsPerSource, dashboard::kFloor);
+    m_tick = 0;
+    m_hasTick = false;
+    m_clients.reserve(m_settings.maxClients);
+
+    m_running.store(true);
+    m_thread = std::thread(&WebSocketServer::run, this);
+
+    LOG_INFO("Dashboard WebSocket server listening on ws://127.0.0.1:{}", m_port);
+    return true;
+}
+
+void WebSocketServer::stop() {
+    if (!m_running.exchange(false)) {
+        return;
+    }
+
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+
+    for (auto& client : m_clients) {
+        closeSocket(client->socket);
+    }
+    m_clients.clear();
+    m_clientCount.store(0);
+
+    closeSocket(m_listenSocket);
+    m_listenSocket = kInvalidSocket;
+    shutdownSockets();
+
+    LOG_INFO("Dashboard WebSocket server stopped");
+}
+
+void WebSocketServer::run() {
+    TickSchedule schedule(m_settings.tickRateHz);
+
+    std::vector<PollEntry> pollSet;
+    pollSet.reserve(m_settings.maxClients + 1);
+
+    while (m_running.load()) {
+        Clock::time_point now = Clock::now();
+        if (schedule.due(now)) {
+            tick(now);
+            schedule.advance(now);
+        }
+
+        const auto untilTick = std::chrono::duration_cast<std::chrono::milliseconds>(schedule.next() - now).count();
+        const int timeoutMs = static_cast<int>(std::clamp<long long>(untilTick, 0, kMaxWaitMs));
+
+        pollSet.clear();
+        pollSet.push_back(PollEntry{m_listenSocket, kReadable, 0});
+        for (const auto& client : m_clients) {
+            const bool pending = client->outboxHead < client->outbox.size();
+            pollSet.push_back(PollEntry{client->socket, static_cast<decltype(PollEntry::events)>(kReadable | (pending ? kWritable : 0)), 0});
+        }
+
+        if (pollSockets(pollSet.data(), pollSet.size(), timeoutMs) > 0) {
+            for (std::size_t i = 1; i < pollSet.size(); ++i) {
+                Client& client = *m_clients[i - 1];
+                const auto revents = pollSet[i].revents;
+                if (revents & kReadable) {
+                    readClient(client);
+                } else if (revents & (POLLERR | POLLHUP | POLLNVAL)) {
+                    client.closing = true;
+                }
+                if ((revents & kWritable) && !client.closing) {
+                    flush(client);
+                }
+            }
+            if (pollSet[0].revents & kReadable) {
+                acceptClients();
+            }
+        }
+
+        // Reap closed clients
+        const auto closed = std::remove_if(m_clients.begin(), m_clients.end(), [](const std::unique_ptr<Client>& client) {
+            if (client->closing) {
+                closeSocket(client->socket);
+                return true;
+            }
+            return false;
+        });
+        m_clients.erase(closed, m_clients.end());
+        m_clientCount.store(m_clients.size());
+    }
+}
+
+void WebSocketServer::acceptClients() {
+    for (;;) {
+        const SocketHandle socket = accept(m_listenSocket, nullptr, nullptr);
+        if (socket == kInvalidSocket) {
+            return;
+        }
+        if (m_clients.size() >= m_settings.maxClients || !setNonBlocking(socket)) {
+            LOG_WARNING("Dashboard client rejected (limit {})", m_settings.maxClients);
+            closeSocket(socket);
+            continue;
+        }
+
+        auto client = std::make_unique<Client>();
+        client->socket = socket;
+        client->inbox.reserve(1024);
+        client->outbox.reserve(4096);
+        m_clients.push_back(std::move(client));
+    }
+}
+
+void WebSocketServer::readClient(Client& client) {
+    std::uint8_t chunk[2048];
+    for (;;) {
+        const auto n = recv(client.socket, reinterpret_cast<char*>(chunk), static_cast<int>(sizeof(chunk)), 0);
+        if (n == 0 || (n < 0 && !lastErrorWouldBlock())) {
+            client.closing = true;
+            return;
+        }
+        if (n < 0) {
+            break;
+        }
+        if (client.inbox.size() + static_cast<std::size_t>(n) > kMaxInboxSize) {
+            client.closing = true;
+            return;
+        }
+        client.inbox.insert(client.inbox.end(), chunk, chunk + n);
+    }
+
+    if (!client.upgraded && !handleHandshake(client)) {
+        return;
+    }
+    handleFrames(client);
+}
+
+bool WebSocketServer::handleHandshake(Client& client) {
+    const std::string_view request(reinterpret_cast<const char*>(client.inbox.data()), client.inbox.size());
+    const std::size_t end = request.find("\r\n\r\n");
+    if (end == std::string_view::npos) {
+        return false;
+    }
+
+    const std::string_view head = request.substr(0, end + 2);
+    const std::string_view key = headerValue(head, "Sec-WebSocket-Key");
+    if (head.substr(0, 4) != "GET " || key.empty() || headerValue(head, "Sec-WebSocket-Version") != "13") {
+        static constexpr std::string_view kBadRequest =
+            "HTTP/1.1 400 Bad Request\r\nSec-WebSocket-Version: 13\r\nContent-Length: 0\r\nConnection: close\r\n\r\n";
+        send(client.socket, kBadRequest.data(), static_cast<int>(kBadRequest.size()), 0);
+        client.closing = true;
+        return false;
+    }
+
+    const std::string response =
+        "HTTP/1.1 101 Switching Protocols\r\n"
+        "Upgrade: websocket\r\n"
+        "Connection: Upgrade\r\n"
+        "Sec-WebSocket-Accept: " + websocket::acceptKey(key) + "\r\n\r\n";
+    client.outbox.insert(client.outbox.end(), response.begin(), response.end());
+
+    client.inbox.erase(client.inbox.begin(), client.inbox.begin() + static_cast<std::ptrdiff_t>(end + 4));
+    client.upgraded = true;
+    client.budgetBytes = static_cast<double>(m_settings.sendBudgetBytesPerSecond);
+    client.budgetRefilled = Clock::now();
+
+    queueMessage(client, websocket::Opcode::Binary, m_hello.data(), m_hello.size());
+    flush(client);
+    return true;
+}
+
+void WebSocketServer::handleFrames(Client& client) {
+    std::size_t offset = 0;
+    while (!client.closing) {
+        websocket::Frame frame;
+        const auto consumed = websocket::parseFrame(
+            client.inbox.data() + offset, client.inbox.size() - offset, kMaxClientPayload, frame
+        );
+        if (consumed < 0) {
+            client.closing = true;
+            return;
+        }
+        if (consumed == 0) {
+            break;
+        }
+        offset += static_cast<std::size_t>(consumed);
+
+        switch (frame.opcode) {
+            case websocket::Opcode::Binary:
+                if (frame.payloadLength >= dashboard::kAckSize &&
+                    frame.payload[0] == static_cast<std::uint8_t>(dashboard::ClientMessageType::Ack)) {
+                    const std::uint32_t acked = stream::get32(frame.payload + 1);
+                    // Only move forward, and only to ticks we can still diff against
+                    if (isBaseAvailable(acked) &&
+                        (client.ackedTick == dashboard::kNoBase || acked > client.ackedTick)) {
+                        client.ackedTick = acked;
+                    }
+                }
+                break;
+            case websocket::Opcode::Ping:
+                queueMessage(client, websocket::Opcode::Pong, frame.payload, frame.payloadLength);
+                flush(client);
+                break;
+            case websocket::Opcode::Close:
+                queueMessage(client, websocket::Opcode::Close, frame.payload, std::min<std::size_t>(frame.payloadLength, 2));
+                flush(client);
+                client.closing = true;
+                break;
+            default:
+                break; // Text and pongs are ignored
+        }
+    }
+    client.inbox.erase(client.inbox.begin(), client.inbox.begin() + static_cast<std::ptrdiff_t>(offset));
+}
+
+void WebSocketServer::tick(Clock::time_point now) {
+    // Quantize every source once per tick, whatever the number of clients
+    m_tick = m_hasTick ? m_tick + 1 : 0;
+    m_hasTick = true;
+    const std::size_t stride = m_sources.size() * dashboard::kFieldsPerSource;
+    std::int16_t* slot = m_history.data() + (m_tick % m_settings.historyTicks) * stride;
+    for (std::size_t i = 0; i < m_sources.size(); ++i) {
+        dashboard::quantizeSnapshot(m_sources[i]->latestSnapshot(), slot + i * dashboard::kFieldsPerSource);
+    }
+
+    m_cacheUsed = 0;
+    const double budgetRate = static_cast<double>(m_settings.sendBudgetBytesPerSecond);
+
+    for (auto& clientPtr : m_clients) {
+        Client& client = *clientPtr;
+        if (!client.upgraded || client.closing) {
+            continue;
+        }
+
+        // Token bucket with a one-second burst
+        const double elapsed = std::chrono::duration<double>(now - client.budgetRefilled).count();
+        client.budgetRefilled = now;
+        client.budgetBytes = std::min(client.budgetBytes + elapsed * budgetRate, budgetRate);
+
+        if (client.outboxHead < client.outbox.size()) {
+            // Previous update still draining; drop the client if it stays stuck
+            if (!client.stalled) {
+                client.stalled = true;
+                client.stalledSince = now;
+            } else if (now - client.stalledSince > std::chrono::milliseconds(m_settings.slowClientTimeoutMs)) {
+                dropClient(client, "slow");
+            }
+            continue;
+        }
+
+        // Without a usable ack the client needs a keyframe; repeat it only
+        // at the keyframe interval until an ack arrives
+        const std::uint32_t base = isBaseAvailable(client.ackedTick) ? client.ackedTick : dashboard::kNoBase;
+        if (base == dashboard::kNoBase && client.keyframeSent &&
+            now - client.lastKeyframe < std::chrono::milliseconds(m_settings.keyframeIntervalMs)) {
+            continue;
+        }
+        const CachedUpdate& update = updateFor(base);
+
+        // Nothing changed: stay silent, but refresh the baseline well before
+        // it falls out of the history
+        const bool unchanged = update.frame.size() == 2 + dashboard::kUpdateHeaderSize;
+        if (unchanged && base != dashboard::kNoBase && m_tick - base < m_settings.historyTicks / 2) {
+            continue;
+        }
+
+        // An update bigger than the whole bucket still goes out once the bucket is full
+        const double cost = static_cast<double>(update.frame.size());
+        if (cost > client.budgetBytes && client.budgetBytes < budgetRate) {
+            continue;
+        }
+        client.budgetBytes -= cost;
+        if (base == dashboard::kNoBase) {
+            client.keyframeSent = true;
+            client.lastKeyframe = now;
+        }
+
+        client.outbox.clear();
+        client.outboxHead = 0;
+        client.outbox.insert(client.outbox.end(), update.frame.begin(), update.frame.end());
+        flush(client);
+    }
+}
+
+const WebSocketServer::CachedUpdate& WebSocketServer::updateFor(std::uint32_t baseTick) {
+    for (std::size_t i = 0; i < m_cacheUsed; ++i) {
+        if (m_cache[i].baseTick == baseTick) {
+            return m_cache[i];
+        }
+    }
+
+    if (m_cacheUsed == m_cache.size()) {
+        m_cache.emplace_back();
+    }
+    CachedUpdate& entry = m_cache[m_cacheUsed++];
+    entry.baseTick = baseTick;
+
+    // Encode the payload after the largest possible header, then slide the
+    // actual header in front of it; the frame vector keeps its capacity
+    const std::size_t maxPayload = dashboard::kUpdateHeaderSize + m_sources.size() * dashboard::kMaxRecordSize;
+    entry.frame.resize(websocket::kMaxHeaderSize + maxPayload);
+    const std::size_t payloadLength = dashboard::encodeUpdate(
+        entry.frame.data() + websocket::kMaxHeaderSize,
+        m_tick,
+        baseTick,
+        historySlot(m_tick),
+        baseTick == dashboard::kNoBase ? nullptr : historySlot(baseTick),
+        m_sources.size()
+    );
+
+    std::uint8_t header[websocket::kMaxHeaderSize];
+    const std::size_t headerSize = websocket::writeFrameHeader(header, websocket::Opcode::Binary, payloadLength);
+    const std::size_t start = websocket::kMaxHeaderSize - headerSize;
+    std::copy(header, header + headerSize, entry.frame.begin() + static_cast<std::ptrdiff_t>(start));
+    entry.frame.erase(entry.frame.begin(), entry.frame.begin() + static_cast<std::ptrdiff_t>(start));
+    entry.frame.resize(headerSize + payloadLength);
+    return entry;
+}
+
+void WebSocketServer::queueMessage(Client& client, websocket::Opcode opcode, const std::uint8_t* payload, std::size_t length) {
+    if (client.outboxHead == client.outbox.size()) {
+        client.outbox.clear();
+        client.outboxHead = 0;
+    }
+    if (client.outbox.size() - client.outboxHead + websocket::kMaxHeaderSize + length > m_settings.maxOutboxBytes) {
+        dropClient(client, "backlogged");
+        return;
+    }
+    std::uint8_t header[websocket::kMaxHeaderSize];
+    const std::size_t headerSize = websocket::writeFrameHeader(header, opcode, length);
+    client.outbox.insert(client.outbox.end(), header, header + headerSize);
+    client.outbox.insert(client.outbox.end(), payload, payload + length);
+}
+
+void WebSocketServer::flush(Client& client) {
+    while (client.outboxHead < client.outbox.size()) {
+        const auto n = send(
+            client.socket,
+            reinterpret_cast<const char*>(client.outbox.data() + client.outboxHead),
+            static_cast<int>(client.outbox.size() - client.outboxHead),
+            0
+        );
+        if (n < 0) {
+            if (!lastErrorWouldBlock()) {
+                client.closing = true;
+            }
+            return;
+        }
+        client.outboxHead += static_cast<std::size_t>(n);
+        m_bytesSent.fetch_add(static_cast<std::uint64_t>(n));
+    }
+    client.outbox.clear();
+    client.outboxHead = 0;
+    client.stalled = false;
+}
+
+void WebSocketServer::dropClient(Client& client, const char* reason) {
+    if (client.closing) {
+        return;
+    }
+    LOG_WARNING("Dropping {} dashboard client", reason);
+    m_droppedClients.fetch_add(1);
+    client.closing = true;
+}
+
+bool WebSocketServer::isBaseAvailable(std::uint32_t baseTick) const noexcept {
+    return m_hasTick && baseTick != dashboard::kNoBase && baseTick <= m_tick &&
+           m_tick - baseTick < m_settings.historyTicks;
+}
+
+const std::int16_t* WebSocketServer::historySlot(std::uint32_t tick) const noexcept {
+    const std::size_t stride = m_sources.size() * dashboard::kFieldsPerSource;
+    return m_history.data() + (tick % m_settings.historyTicks) * stride;
+}
+
+} // namespace openmeters::core::net
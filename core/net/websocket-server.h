@@ -0,0 +1,155 @@
+#pragma once
+
+#include "socket.h"
+#include "dashboard-protocol.h"
+#include "websocket.h"
+#include "../../common/meter-source.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace openmeters::core::net {
+
+/**
+ * WebSocket server settings.
+ */
+struct WebSocketServerSettings {
+    std::uint16_t port = 8765;                      // On 127.0.0.1; 0 picks an ephemeral port
+    float tickRateHz = 30.0f;
+    std::size_t maxClients = 64;
+    std::size_t sendBudgetBytesPerSecond = 64 * 1024; // Per client
+    std::size_t historyTicks = 64;                  // Oldest baseline an update can refer to
+    std::uint32_t keyframeIntervalMs = 1000;        // Full updates to a client that has not acked go out this often
+    std::size_t maxOutboxBytes = 64 * 1024;         // Drop a client with more unsent bytes than this
+    std::uint32_t slowClientTimeoutMs = 2000;       // Drop a client whose pending bytes do not drain this long
+};
+
+/**
+ * Pushes live meters to browser dashboards over WebSocket.
+ *
+ * Every tick the server quantizes all sources once into a history ring,
+ * then sends each client an Update holding only the fields that changed
+ * since the last tick that client acknowledged (see dashboard-protocol.h).
+ * Clients that acknowledged the same tick share one encoded message, so
+ * encoding cost grows with the number of distinct baselines rather than
+ * with the number of clients, and an idle meter costs nothing on the wire.
+ *
+ * Each client has a token-bucket send budget. A client that is over budget,
+ * or whose previous message has not drained yet, simply skips the tick; its
+ * next update is taken against its last acknowledged state and catches up
+ * in one message. A client with no usable acknowledgement gets a full
+ * update at most every keyframeIntervalMs. A client that leaves bytes
+ * unsent for slowClientTimeoutMs, or piles up more than maxOutboxBytes
+ * (e.g. by pinging faster than it reads), is disconnected.
+ *
+ * One thread serves all clients with poll (WSAPoll on Windows).
+ *
+ * Thread safety: addSource/start/stop from one control thread.
+ */
+class WebSocketServer {
+public:
+    WebSocketServer() = default;
+    ~WebSocketServer();
+
+    // Non-copyable, non-movable
+    WebSocketServer(const WebSocketServer&) = delete;
+    WebSocketServer& operator=(const WebSocketServer&) = delete;
+    WebSocketServer(WebSocketServer&&) = delete;
+    WebSocketServer& operator=(WebSocketServer&&) = delete;
+
+    /**
+     * Register a meter source. Must be called before start().
+     *
+     * @param name Display name sent in the Hello message (truncated to 255 bytes)
+     * @param source Source (must outlive the server)
+     */
+    bool addSource(const std::string& name, const common::IMeterSource* source);
+
+    /**
+     * Bind the port and start the server thread.
+     */
+    bool start(const WebSocketServerSettings& settings = WebSocketServerSettings());
+
+    /**
+     * Close all connections and stop the server thread.
+     */
+    void stop();
+
+    [[nodiscard]] bool isRunning() const noexcept { return m_running.load(); }
+    [[nodiscard]] std::uint16_t port() const noexcept { return m_port; }
+    [[nodiscard]] std::size_t clientCount() const noexcept { return m_clientCount.load(); }
+    [[nodiscard]] std::uint64_t bytesSent() const noexcept { return m_bytesSent.load(); }
+    [[nodiscard]] std::uint64_t droppedClients() const noexcept { return m_droppedClients.load(); }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Client {
+        SocketHandle socket = kInvalidSocket;
+        bool upgraded = false;
+        bool closing = false;
+
+        std::vector<std::uint8_t> inbox;   // Handshake text, then frames
+        std::vector<std::uint8_t> outbox;  // Pending bytes
+        std::size_t outboxHead = 0;
+
+        std::uint32_t ackedTick = dashboard::kNoBase;
+        double budgetBytes = 0.0;
+        Clock::time_point budgetRefilled{};
+
+        Clock::time_point lastKeyframe{};
+        bool keyframeSent = false;
+        Clock::time_point stalledSince{};  // First tick that found bytes still pending
+        bool stalled = false;
+    };
+
+    // One encoded update (WebSocket frame included), shared by all clients
+    // with the same baseline during a tick
+    struct CachedUpdate {
+        std::uint32_t baseTick = dashboard::kNoBase;
+        std::vector<std::uint8_t> frame;
+    };
+
+    void run();
+    void acceptClients();
+    void readClient(Client& client);
+    bool handleHandshake(Client& client);
+    void handleFrames(Client& client);
+    void tick(Clock::time_point now);
+    const CachedUpdate& updateFor(std::uint32_t baseTick);
+    void queueMessage(Client& client, websocket::Opcode opcode, const std::uint8_t* payload, std::size_t length);
+    void flush(Client& client);
+    void dropClient(Client& client, const char* reason);
+
+    [[nodiscard]] bool isBaseAvailable(std::uint32_t baseTick) const noexcept;
+    [[nodiscard]] const std::int16_t* historySlot(std::uint32_t tick) const noexcept;
+
+    WebSocketServerSettings m_settings;
+    std::vector<std::string> m_names;
+    std::vector<const common::IMeterSource*> m_sources;
+
+    SocketHandle m_listenSocket = kInvalidSocket;
+    std::uint16_t m_port = 0;
+    std::vector<std::unique_ptr<Client>> m_clients;
+
+    // Quantized state per tick (historyTicks x sources x fields)
+    std::vector<std::int16_t> m_history;
+    std::uint32_t m_tick = 0;
+    bool m_hasTick = false;
+
+    std::vector<CachedUpdate> m_cache;
+    std::size_t m_cacheUsed = 0;
+    std::vector<std::uint8_t> m_hello;
+
+    std::thread m_thread;
+    std::atomic<bool> m_running{false};
+    std::atomic<std::size_t> m_clientCount{0};
+    std::atomic<std::uint64_t> m_bytesSent{0};
+    std::atomic<std::uint64_t> m_droppedClients{0};
+};
+
+} // namespace openmeters::core::net
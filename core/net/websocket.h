@@ -0,0 +1,217 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+namespace openmeters::core::net {
+
+/**
+ * Minimal RFC 6455 building blocks for the dashboard server: the opening
+ * handshake key, frame headers, and inbound frame parsing. Only what a
+ * server that sends unfragmented binary messages needs.
+ */
+namespace websocket {
+
+enum class Opcode : std::uint8_t {
+    Continuation = 0x0,
+    Text = 0x1,
+    Binary = 0x2,
+    Close = 0x8,
+    Ping = 0x9,
+    Pong = 0xA
+};
+
+/**
+ * SHA-1 digest (used only for Sec-WebSocket-Accept).
+ */
+inline std::array<std::uint8_t, 20> sha1(const void* data, std::size_t size) noexcept {
+    std::uint32_t h[5] = {0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0};
+    const auto rotl = [](std::uint32_t v, int s) { return (v << s) | (v >> (32 - s)); };
+
+    const auto* bytes = static_cast<const std::uint8_t*>(data);
+    const std::uint64_t bitLength = static_cast<std::uint64_t>(size) * 8;
+    const std::size_t blocks = (size + 8) / 64 + 1;
+
+    for (std::size_t block = 0; block < blocks; ++block) {
+        std::uint8_t chunk[64];
+        for (std::size_t i = 0; i < 64; ++i) {
+            const std::size_t index = block * 64 + i;
+            if (index < size) {
+                chunk[i] = bytes[index];
+            } else if (index == size) {
+                chunk[i] = 0x80;
+            } else if (block == blocks - 1 && i >= 56) {
+                chunk[i] = static_cast<std::uint8_t>(bitLength >> (8 * (63 - i)));
+            } else {
+                chunk[i] = 0;
+            }
+        }
+
+        std::uint32_t w[80];
+        for (int i = 0; i < 16; ++i) {
+            w[i] = (std::uint32_t(chunk[i * 4]) << 24) | (std::uint32_t(chunk[i * 4 + 1]) << 16) |
+                   (std::uint32_t(chunk[i * 4 + 2]) << 8) | chunk[i * 4 + 3];
+        }
+        for (int i = 16; i < 80; ++i) {
+            w[i] = rotl(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+        }
+
+        std::uint32_t a = h[0], b = h[1], c = h[2], d = h[3], e = h[4];
+        for (int i = 0; i < 80; ++i) {
+            std::uint32_t f, k;
+            if (i < 20) {
+                f = (b & c) | (~b & d);
+                k = 0x5A827999;
+            } else if (i < 40) {
+                f = b ^ c ^ d;
+                k = 0x6ED9EBA1;
+            } else if (i < 60) {
+                f = (b & c) | (b & d) | (c & d);
+                k = 0x8F1BBCDC;
+            } else {
+                f = b ^ c ^ d;
+                k = 0xCA62C1D6;
+            }
+            const std::uint32_t temp = rotl(a, 5) + f + e + k + w[i];
+            e = d;
+            d = c;
+            c = rotl(b, 30);
+            b = a;
+            a = temp;
+        }
+        h[0] += a; h[1] += b; h[2] += c; h[3] += d; h[4] += e;
+    }
+
+    std::array<std::uint8_t, 20> digest{};
+    for (int i = 0; i < 20; ++i) {
+        digest[i] = static_cast<std::uint8_t>(h[i / 4] >> (24 - 8 * (i % 4)));
+    }
+    return digest;
+}
+
+/**
+ * Standard base64 with padding.
+ */
+inline std::string base64Encode(const std::uint8_t* data, std::size_t size) {
+    static constexpr char kAlphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    std::string out;
+    out.reserve((size + 2) / 3 * 4);
+    for (std::size_t i = 0; i < size; i += 3) {
+        const std::uint32_t chunk = (std::uint32_t(data[i]) << 16) |
+                                    (i + 1 < size ? std::uint32_t(data[i + 1]) << 8 : 0) |
+                                    (i + 2 < size ? std::uint32_t(data[i + 2]) : 0);
+        out += kAlphabet[(chunk >> 18) & 63];
+        out += kAlphabet[(chunk >> 12) & 63];
+        out += i + 1 < size ? kAlphabet[(chunk >> 6) & 63] : '=';
+        out += i + 2 < size ? kAlphabet[chunk & 63] : '=';
+    }
+    return out;
+}
+
+/**
+ * Sec-WebSocket-Accept value for a client's Sec-WebSocket-Key.
+ */
+inline std::string acceptKey(std::string_view clientKey) {
+    std::string input(clientKey);
+    input += "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
+    const auto digest = sha1(input.data(), input.size());
+    return base64Encode(digest.data(), digest.size());
+}
+
+inline constexpr std::size_t kMaxHeaderSize = 10;
+
+/**
+ * Write an unmasked, final frame header (server to client).
+ *
+ * @return Header bytes written (2, 4 or 10)
+ */
+inline std::size_t writeFrameHeader(std::uint8_t* out, Opcode opcode, std::uint64_t payloadLength) noexcept {
+    out[0] = static_cast<std::uint8_t>(0x80 | static_cast<std::uint8_t>(opcode));
+    if (payloadLength < 126) {
+        out[1] = static_cast<std::uint8_t>(payloadLength);
+        return 2;
+    }
+    if (payloadLength <= 0xFFFF) {
+        out[1] = 126;
+        out[2] = static_cast<std::uint8_t>(payloadLength >> 8);
+        out[3] = static_cast<std::uint8_t>(payloadLength);
+        return 4;
+    }
+    out[1] = 127;
+    for (int i = 0; i < 8; ++i) {
+        out[2 + i] = static_cast<std::uint8_t>(payloadLength >> (56 - 8 * i));
+    }
+    return 10;
+}
+
+/**
+ * A parsed inbound frame; payload points into the caller's buffer and has
+ * already been unmasked in place.
+ */
+struct Frame {
+    Opcode opcode = Opcode::Binary;
+    bool final = true;
+    std::uint8_t* payload = nullptr;
+    std::size_t payloadLength = 0;
+};
+
+/**
+ * Parse (and unmask) one client frame at the start of a buffer.
+ *
+ * @param maxPayload Frames larger than this are a protocol error
+ * @return Bytes consumed; 0 if more data is needed; -1 on protocol error
+ */
+inline std::ptrdiff_t parseFrame(std::uint8_t* data, std::size_t size, std::size_t maxPayload, Frame& frame) noexcept {
+    if (size < 2) {
+        return 0;
+    }
+    const bool masked = (data[1] & 0x80) != 0;
+    if (!masked || (data[0] & 0x70) != 0) {
+        return -1; // Clients must mask; no extensions were negotiated
+    }
+
+    std::size_t headerSize = 2;
+    std::uint64_t length = data[1] & 0x7F;
+    if (length == 126) {
+        if (size < 4) {
+            return 0;
+        }
+        length = (std::uint64_t(data[2]) << 8) | data[3];
+        headerSize = 4;
+    } else if (length == 127) {
+        if (size < 10) {
+            return 0;
+        }
+        length = 0;
+        for (int i = 0; i < 8; ++i) {
+            length = (length << 8) | data[2 + i];
+        }
+        headerSize = 10;
+    }
+    if (length > maxPayload) {
+        return -1;
+    }
+    if (size < headerSize + 4 + length) {
+        return 0;
+    }
+
+    const std::uint8_t* mask = data + headerSize;
+    std::uint8_t* payload = data + headerSize + 4;
+    for (std::size_t i = 0; i < length; ++i) {
+        payload[i] ^= mask[i & 3];
+    }
+
+    frame.opcode = static_cast<Opcode>(data[0] & 0x0F);
+    frame.final = (data[0] & 0x80) != 0;
+    frame.payload = payload;
+    frame.payloadLength = static_cast<std::size_t>(length);
+    return static_cast<std::ptrdiff_t>(headerSize + 4 + length);
+}
+
+} // namespace websocket
+
+} // namespace openmeters::core::net
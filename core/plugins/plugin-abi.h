@@ -0,0 +1,117 @@
+/*
+ * OpenMeters meter plugin ABI.
+ *
+ * Plain C so plugins can be built with any compiler and runtime. A plugin
+ * library exports one function, om_get_meter_plugins, returning an array of
+ * descriptors. All memory a plugin uses while running (its state and per-block
+ * scratch) is provided by the host, so process() never needs to allocate.
+ *
+ * Compatibility rules:
+ *  - OM_PLUGIN_ABI_VERSION changes only for incompatible changes.
+ *  - Descriptors and blocks begin with struct_size; new members are only ever
+ *    appended, and each side reads only the members both sides know.
+ */
+#ifndef OPENMETERS_PLUGIN_ABI_H
+#define OPENMETERS_PLUGIN_ABI_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define OM_PLUGIN_ABI_VERSION 1u
+#define OM_PLUGIN_ENTRY_NAME "om_get_meter_plugins"
+
+#if defined(_WIN32)
+#define OM_PLUGIN_EXPORT __declspec(dllexport)
+#else
+#define OM_PLUGIN_EXPORT __attribute__((visibility("default")))
+#endif
+
+/* Sample layout a plugin wants to receive. */
+typedef enum om_sample_layout {
+    OM_LAYOUT_INTERLEAVED = 0, /* The host's buffer, passed through untouched */
+    OM_LAYOUT_PLANAR = 1       /* One contiguous array per channel */
+} om_sample_layout;
+
+/*
+ * One block of 32-bit float audio. Pointers are only valid during process().
+ */
+typedef struct om_audio_block {
+    uint32_t struct_size;
+    uint32_t layout;               /* om_sample_layout */
+    uint32_t sample_rate;
+    uint32_t channel_count;
+    uint32_t frame_count;
+    uint32_t reserved;
+    uint64_t stream_frame;         /* Absolute position of the first frame */
+    const float* interleaved;      /* OM_LAYOUT_INTERLEAVED: frame_count * channel_count samples */
+    const float* const* planar;    /* OM_LAYOUT_PLANAR: channel_count arrays of frame_count samples */
+} om_audio_block;
+
+/*
+ * One named output of a plugin. Outputs are written as a flat float array:
+ * every field contributes value_count consecutive values, in declaration order.
+ */
+typedef struct om_output_field {
+    const char* name;              /* e.g. "short_term_lufs" */
+    const char* unit;              /* e.g. "LUFS", "dBFS", "" */
+    uint32_t value_count;          /* e.g. 1, or one per channel */
+} om_output_field;
+
+typedef struct om_meter_plugin {
+    uint32_t struct_size;          /* sizeof(om_meter_plugin) as compiled by the plugin */
+    uint32_t abi_version;          /* OM_PLUGIN_ABI_VERSION */
+
+    const char* id;                /* Stable, unique reverse-DNS id */
+    const char* name;              /* Display name */
+    const char* version;           /* Plugin version string */
+
+    /* Inputs */
+    uint32_t input_layout;         /* om_sample_layout */
+    uint32_t required_sample_rate; /* 0: any rate */
+    uint32_t max_channels;         /* 0: any channel count */
+
+    /* Host-provided memory */
+    size_t state_size;             /* Persistent state, zeroed before init() */
+    size_t state_alignment;        /* Power of two, <= 64 (0: 16) */
+    size_t scratch_fixed_bytes;    /* Per-block scratch: fixed part ... */
+    size_t scratch_bytes_per_frame;/* ... plus this much per frame (64-byte aligned) */
+
+    /* Output schema */
+    uint32_t output_field_count;
+    const om_output_field* output_fields;
+
+    /* Prepare state for a stream. Return 0 on success. Required. */
+    int (*init)(void* state, uint32_t sample_rate, uint32_t channel_count);
+
+    /*
+     * Analyse one block and write every output value. Runs on a real-time
+     * thread: no allocation, locks or I/O. Required.
+     */
+    void (*process)(void* state, const om_audio_block* block,
+                    void* scratch, size_t scratch_size, float* outputs);
+
+    /* Clear history (new stream, discontinuity). Optional. */
+    void (*reset)(void* state);
+
+    /* Release anything init() acquired besides the state memory. Optional. */
+    void (*shutdown)(void* state);
+} om_meter_plugin;
+
+/*
+ * Library entry point.
+ *
+ * @param host_abi_version OM_PLUGIN_ABI_VERSION of the host
+ * @param count Receives the number of descriptors
+ * @return Array of descriptors with static lifetime, or NULL if incompatible
+ */
+typedef const om_meter_plugin* (*om_get_meter_plugins_fn)(uint32_t host_abi_version, uint32_t* count);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* OPENMETERS_PLUGIN_ABI_H */
@@ -0,0 +1,343 @@
+#include "plugin-host.h"
+#include "../../common/logger.h"
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <dlfcn.h>
+#endif
+
+namespace openmeters::core::plugins {
+
+namespace {
+
+constexpr std::size_t kScratchAlignment = 64;
+
+std::size_t alignUp(std::size_t value, std::size_t alignment) noexcept {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+// Smallest descriptor the host can use (everything up to and including shutdown)
+constexpr std::size_t kMinDescriptorSize = offsetof(om_meter_plugin, shutdown) + sizeof(void (*)(void*));
+
+} // namespace
+
+/**
+ * A loaded shared library; unloaded on destruction.
+ */
+struct PluginHost::Library {
+#ifdef _WIN32
+    HMODULE handle = nullptr;
+    ~Library() {
+        if (handle) {
+            FreeLibrary(handle);
+        }
+    }
+#else
+    void* handle = nullptr;
+    ~Library() {
+        if (handle) {
+            dlclose(handle);
+        }
+    }
+#endif
+};
+
+PluginHost::PluginHost() = default;
+
+PluginHost::~PluginHost() {
+    unloadAll();
+}
+
+std::size_t PluginHost::loadLibrary(const std::string& path) {
+    auto library = std::make_unique<Library>();
+    om_get_meter_plugins_fn entry = nullptr;
+
+#ifdef _WIN32
+    library->handle = LoadLibraryW(std::filesystem::path(path).wstring().c_str());
+    if (library->handle) {
+        entry = reinterpret_cast<om_get_meter_plugins_fn>(GetProcAddress(library->handle, OM_PLUGIN_ENTRY_NAME));
+    }
+#else
+    library->handle = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+    if (library->handle) {
+        entry = reinterpret_cast<om_get_meter_plugins_fn>(dlsym(library->handle, OM_PLUGIN_ENTRY_NAME));
+    }
+#endif
+
+    if (!library->handle) {
+        LOG_WARNING("Failed to load plugin library: {}", path);
+        return 0;
+    }
+    if (!entry) {
+        LOG_WARNING("Plugin library has no {}: {}", OM_PLUGIN_ENTRY_NAME, path);
+        return 0;
+    }
+
+    std::uint32_t count = 0;
+    const om_meter_plugin* descriptors = entry(OM_PLUGIN_ABI_VERSION, &count);
+    if (!descriptors || count == 0) {
+        LOG_WARNING("Plugin library offers no compatible plugins: {}", path);
+        return 0;
+    }
+
+    std::size_t accepted = 0;
+    for (std::uint32_t i = 0; i < count; ++i) {
+        if (addPlugin(&descriptors[i])) {
+            ++accepted;
+        }
+    }
+
+    // Keep the library mapped while any of its descriptors are in use
+    if (accepted > 0) {
+        m_libraries.push_back(std::move(library));
+    }
+    return accepted;
+}
+
+std::size_t PluginHost::loadDirectory(const std::string& directory) {
+#ifdef _WIN32
+    constexpr const char* kExtension = ".dll";
+#else
+    constexpr const char* kExtension = ".so";
+#endif
+
+    std::error_code error;
+    std::size_t accepted = 0;
+    for (const auto& entry : std::filesystem::directory_iterator(directory, error)) {
+        if (entry.is_regular_file() && entry.path().extension() == kExtension) {
+            accepted += loadLibrary(entry.path().string());
+        }
+    }
+    if (error) {
+        LOG_WARNING("Cannot read plugin directory {}: {}", directory, error.message());
+    }
+    return accepted;
+}
+
+bool PluginHost::addPlugin(const om_meter_plugin* descriptor) {
+    std::string reason;
+    if (!validate(descriptor, reason)) {
+        LOG_WARNING("Rejected meter plugin {}: {}", descriptor && descriptor->id ? descriptor->id : "?", reason);
+        return false;
+    }
+
+    auto plugin = std::make_unique<Plugin>();
+    plugin->descriptor = descriptor;
+    for (std::uint32_t i = 0; i < descriptor->output_field_count; ++i) {
+        plugin->outputCount += descriptor->output_fields[i].value_count;
+    }
+    m_plugins.push_back(std::move(plugin));
+
+    LOG_INFO("Loaded meter plugin {} {} ({})", descriptor->name, descriptor->version, descriptor->id);
+    return true;
+}
+
+bool PluginHost::validate(const om_meter_plugin* descriptor, std::string& reason) const {
+    if (!descriptor) {
+        reason = "null descriptor";
+        return false;
+    }
+    if (descriptor->abi_version != OM_PLUGIN_ABI_VERSION) {
+        reason = "ABI version " + std::to_string(descriptor->abi_version) +
+                 " (host " + std::to_string(OM_PLUGIN_ABI_VERSION) + ")";
+        return false;
+    }
+    if (descriptor->struct_size < kMinDescriptorSize) {
+        reason = "descriptor too small";
+        return false;
+    }
+    if (!descriptor->id || !descriptor->name || !descriptor->version || !descriptor->init || !descriptor->process) {
+        reason = "missing id, name, version, init or process";
+        return false;
+    }
+    if (descriptor->input_layout != OM_LAYOUT_INTERLEAVED && descriptor->input_layout != OM_LAYOUT_PLANAR) {
+        reason = "unknown input layout";
+        return false;
+    }
+    const std::size_t alignment = descriptor->state_alignment ? descriptor->state_alignment : 16;
+    if ((alignment & (alignment - 1)) != 0 || alignment > common::ScratchArena::kMaxAlignment) {
+        reason = "bad state alignment";
+        return false;
+    }
+
+    std::size_t outputCount = 0;
+    for (std::uint32_t i = 0; i < descriptor->output_field_count; ++i) {
+        if (!descriptor->output_fields || !descriptor->output_fields[i].name) {
+            reason = "unnamed output field";
+            return false;
+        }
+        outputCount += descriptor->output_fields[i].value_count;
+    }
+    if (outputCount > PluginOutputs::kMaxValues) {
+        reason = "more than " + std::to_string(PluginOutputs::kMaxValues) + " output values";
+        return false;
+    }
+
+    for (const auto& plugin : m_plugins) {
+        if (std::strcmp(plugin->descriptor->id, descriptor->id) == 0) {
+            reason = "duplicate id";
+            return false;
+        }
+    }
+    return true;
+}
+
+bool PluginHost::prepare(const common::AudioFormat& format, std::size_t maxFramesPerBlock) {
+    shutdownPlugins();
+
+    m_maxFrames = std::max<std::size_t>(maxFramesPerBlock, 1);
+    m_needsPlanar = false;
+    const std::size_t channels = format.samplesPerFrame();
+    std::size_t largestScratch = 0;
+
+    for (auto& plugin : m_plugins) {
+        const om_meter_plugin& descriptor = *plugin->descriptor;
+        plugin->enabled = false;
+
+        if (descriptor.required_sample_rate != 0 && descriptor.required_sample_rate != format.sampleRate) {
+            LOG_WARNING("Meter plugin {} needs {} Hz; disabled", descriptor.id, descriptor.required_sample_rate);
+            continue;
+        }
+        if (descriptor.max_channels != 0 && channels > descriptor.max_channels) {
+            LOG_WARNING("Meter plugin {} supports at most {} channels; disabled", descriptor.id, descriptor.max_channels);
+            continue;
+        }
+
+        // Zeroed, aligned state owned by the host
+        const std::size_t alignment = descriptor.state_alignment ? descriptor.state_alignment : 16;
+        const std::size_t stateSize = std::max<std::size_t>(descriptor.state_size, 1);
+        plugin->stateStorage = std::make_unique<std::byte[]>(stateSize + alignment);
+        const auto address = reinterpret_cast<std::uintptr_t>(plugin->stateStorage.get());
+        plugin->state = plugin->stateStorage.get() + ((alignment - address % alignment) % alignment);
+        std::memset(plugin->state, 0, stateSize);
+
+        if (descriptor.init(plugin->state, format.sampleRate, static_cast<std::uint32_t>(channels)) != 0) {
+            LOG_WARNING("Meter plugin {} failed to initialise; disabled", descriptor.id);
+            plugin->stateStorage.reset();
+            plugin->state = nullptr;
+            continue;
+        }
+
+        plugin->initialized = true;
+        plugin->enabled = true;
+        plugin->scratchOutputs = PluginOutputs();
+        plugin->scratchOutputs.valueCount = static_cast<std::uint32_t>(plugin->outputCount);
+        m_needsPlanar = m_needsPlanar || descriptor.input_layout == OM_LAYOUT_PLANAR;
+
+        const std::size_t scratch = descriptor.scratch_fixed_bytes + descriptor.scratch_bytes_per_frame * m_maxFrames;
+        largestScratch = std::max(largestScratch, alignUp(scratch, kScratchAlignment));
+    }
+
+    // Planar channel copies plus the largest single plugin scratch
+    const std::size_t planarBytes = m_needsPlanar
+        ? alignUp(channels * sizeof(const float*), kScratchAlignment) +
+          channels * alignUp(m_maxFrames * sizeof(float), kScratchAlignment)
+        : 0;
+    m_arena.reserve(planarBytes + largestScratch + kScratchAlignment);
+    return true;
+}
+
+void PluginHost::process(
+    const float* buffer,
+    std::size_t frameCount,
+    const common::AudioFormat& format,
+    std::uint64_t streamFrame
+) noexcept {
+    if (!buffer || m_plugins.empty() || m_maxFrames == 0) {
+        return;
+    }
+
+    const std::size_t channels = format.samplesPerFrame();
+    for (std::size_t offset = 0; offset < frameCount; offset += m_maxFrames) {
+        const std::size_t chunk = std::min(m_maxFrames, frameCount - offset);
+        processChunk(buffer + offset * channels, chunk, format, streamFrame + offset);
+    }
+}
+
+void PluginHost::processChunk(
+    const float* buffer,
+    std::size_t frameCount,
+    const common::AudioFormat& format,
+    std::uint64_t streamFrame
+) noexcept {
+    const std::size_t channels = format.samplesPerFrame();
+    m_arena.reset();
+
+    // Split channels once per block, shared by every planar plugin
+    const float** planar = nullptr;
+    if (m_needsPlanar) {
+        planar = static_cast<const float**>(m_arena.allocate(channels * sizeof(const float*), kScratchAlignment));
+        for (std::size_t ch = 0; ch < channels && planar; ++ch) {
+            float* channel = static_cast<float*>(m_arena.allocate(frameCount * sizeof(float), kScratchAlignment));
+            for (std::size_t frame = 0; frame < frameCount; ++frame) {
+                channel[frame] = buffer[frame * channels + ch];
+            }
+            planar[ch] = channel;
+        }
+    }
+    const std::size_t blockMark = m_arena.mark();
+
+    om_audio_block block{};
+    block.struct_size = sizeof(om_audio_block);
+    block.sample_rate = format.sampleRate;
+    block.channel_count = static_cast<std::uint32_t>(channels);
+    block.frame_count = static_cast<std::uint32_t>(frameCount);
+    block.stream_frame = streamFrame;
+
+    for (auto& pluginPtr : m_plugins) {
+        Plugin& plugin = *pluginPtr;
+        if (!plugin.enabled) {
+            continue;
+        }
+        const om_meter_plugin& descriptor = *plugin.descriptor;
+
+        block.layout = descriptor.input_layout;
+        block.interleaved = descriptor.input_layout == OM_LAYOUT_INTERLEAVED ? buffer : nullptr;
+        block.planar = descriptor.input_layout == OM_LAYOUT_PLANAR ? planar : nullptr;
+
+        const std::size_t scratchSize = descriptor.scratch_fixed_bytes + descriptor.scratch_bytes_per_frame * frameCount;
+        void* scratch = scratchSize > 0 ? m_arena.allocate(scratchSize, kScratchAlignment) : nullptr;
+
+        descriptor.process(plugin.state, &block, scratch, scratch ? scratchSize : 0, plugin.scratchOutputs.values.data());
+        m_arena.rewind(blockMark);
+
+        plugin.scratchOutputs.streamFrame = streamFrame + frameCount;
+        plugin.outputs.store(plugin.scratchOutputs);
+    }
+}
+
+void PluginHost::reset() noexcept {
+    for (auto& plugin : m_plugins) {
+        if (plugin->enabled && plugin->descriptor->reset) {
+            plugin->descriptor->reset(plugin->state);
+        }
+    }
+}
+
+void PluginHost::shutdownPlugins() noexcept {
+    for (auto& plugin : m_plugins) {
+        if (plugin->initialized && plugin->descriptor->shutdown) {
+            plugin->descriptor->shutdown(plugin->state);
+        }
+        plugin->initialized = false;
+        plugin->enabled = false;
+        plugin->state = nullptr;
+        plugin->stateStorage.reset();
+    }
+}
+
+void PluginHost::unloadAll() {
+    shutdownPlugins();
+    m_plugins.clear();
+    m_libraries.clear();
+    m_maxFrames = 0;
+}
+
+} // namespace openmeters::core::plugins
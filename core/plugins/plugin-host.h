@@ -0,0 +1,139 @@
+#pragma once
+
+#include "plugin-abi.h"
+#include "../../common/audio-format.h"
+#include "../../common/scratch-arena.h"
+#include "../../common/seqlock.h"
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace openmeters::core::plugins {
+
+/**
+ * Latest output values of one plugin instance.
+ */
+struct PluginOutputs {
+    static constexpr std::size_t kMaxValues = 64;
+
+    std::uint64_t streamFrame = 0;   // End of the block that produced the values
+    std::uint32_t valueCount = 0;
+    std::array<float, kMaxValues> values{};
+};
+
+/**
+ * Loads meter plugins (see plugin-abi.h) and runs them on the audio thread.
+ *
+ * Usage:
+ *   1. loadLibrary()/loadDirectory()/addPlugin() while not processing
+ *   2. prepare() with the stream format (allocates all state and scratch)
+ *   3. process() once per captured block, on the audio thread
+ *   4. outputs() from any thread
+ *
+ * process() allocates nothing. Interleaved plugins get the host's buffer
+ * untouched. For planar plugins the block is split into channels once, in
+ * the shared scratch arena. Each plugin's scratch is carved from the same
+ * arena and released after its call. Blocks larger than the prepared
+ * maximum are processed in chunks.
+ *
+ * Plugins run in-process; a crashing plugin takes the engine with it.
+ *
+ * Thread safety: Everything except outputs() from one thread at a time;
+ * process() must not overlap load/prepare calls.
+ */
+class PluginHost {
+public:
+    PluginHost();
+    ~PluginHost();
+
+    // Non-copyable, non-movable
+    PluginHost(const PluginHost&) = delete;
+    PluginHost& operator=(const PluginHost&) = delete;
+    PluginHost(PluginHost&&) = delete;
+    PluginHost& operator=(PluginHost&&) = delete;
+
+    /**
+     * Load every plugin a shared library exports.
+     *
+     * @return Number of plugins accepted from the library
+     */
+    std::size_t loadLibrary(const std::string& path);
+
+    /**
+     * Load every shared library (.dll / .so) in a directory.
+     *
+     * @return Number of plugins accepted
+     */
+    std::size_t loadDirectory(const std::string& directory);
+
+    /**
+     * Register a plugin descriptor linked into the executable.
+     * The descriptor must have static lifetime.
+     *
+     * @return false if the descriptor is invalid or its id is already loaded
+     */
+    bool addPlugin(const om_meter_plugin* descriptor);
+
+    /**
+     * Allocate state and scratch for a stream and initialise every plugin.
+     * Plugins that cannot handle the format are disabled with a warning.
+     *
+     * @param maxFramesPerBlock Largest block process() handles in one call
+     */
+    bool prepare(const common::AudioFormat& format, std::size_t maxFramesPerBlock);
+
+    /**
+     * Run all enabled plugins on one block. Real-time safe.
+     */
+    void process(const float* buffer, std::size_t frameCount, const common::AudioFormat& format,
+                 std::uint64_t streamFrame) noexcept;
+
+    /**
+     * Clear plugin history (new stream or discontinuity).
+     */
+    void reset() noexcept;
+
+    /**
+     * Shut every plugin down and unload all libraries.
+     */
+    void unloadAll();
+
+    [[nodiscard]] std::size_t pluginCount() const noexcept { return m_plugins.size(); }
+    [[nodiscard]] const om_meter_plugin& descriptor(std::size_t index) const { return *m_plugins[index]->descriptor; }
+    [[nodiscard]] bool isEnabled(std::size_t index) const { return m_plugins[index]->enabled; }
+
+    /**
+     * Latest outputs of a plugin. Lock-free; any thread.
+     */
+    [[nodiscard]] PluginOutputs outputs(std::size_t index) const noexcept { return m_plugins[index]->outputs.load(); }
+
+private:
+    struct Library;
+
+    struct Plugin {
+        const om_meter_plugin* descriptor = nullptr;
+        std::size_t outputCount = 0;
+        std::unique_ptr<std::byte[]> stateStorage;
+        void* state = nullptr;
+        bool initialized = false;
+        bool enabled = false;
+        PluginOutputs scratchOutputs;
+        common::SeqlockCell<PluginOutputs> outputs;
+    };
+
+    bool validate(const om_meter_plugin* descriptor, std::string& reason) const;
+    void shutdownPlugins() noexcept;
+    void processChunk(const float* buffer, std::size_t frameCount, const common::AudioFormat& format,
+                      std::uint64_t streamFrame) noexcept;
+
+    std::vector<std::unique_ptr<Library>> m_libraries;
+    std::vector<std::unique_ptr<Plugin>> m_plugins;
+
+    common::ScratchArena m_arena;
+    std::size_t m_maxFrames = 0;
+    bool m_needsPlanar = false;
+};
+
+} // namespace openmeters::core::plugins
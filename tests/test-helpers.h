@@ -0,0 +1,49 @@
+#pragma once
+
+#include "../../common/meter-source.h"
+#include "../../common/seqlock.h"
+#include "../../core/net/socket.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace openmeters::test {
+
+/**
+ * Minimal in-memory meter source.
+ */
+class FakeMeterSource : public common::IMeterSource {
+public:
+    void publish(const common::MeterSnapshot& snapshot) { m_snapshot.store(snapshot); }
+    void journal(const common::MeterEvent& event) { m_events.push(event); }
+    void setHealth(const common::EngineHealth& health) { m_health = health; }
+
+    common::MeterSnapshot latestSnapshot() const noexcept override { return m_snapshot.load(); }
+    std::uint64_t snapshotVersion() const noexcept override { return m_snapshot.version(); }
+    const common::MeterEventRing& events() const noexcept override { return m_events; }
+    common::AudioFormat getFormat() const override { return common::AudioFormat(); }
+    common::EngineHealth health() const noexcept override { return m_health; }
+
+private:
+    common::SeqlockCell<common::MeterSnapshot> m_snapshot;
+    common::MeterEventRing m_events;
+    common::EngineHealth m_health;
+};
+
+/**
+ * Blocking receive of exactly @p size bytes.
+ *
+ * @return false if the peer closed or the receive failed first
+ */
+inline bool receiveExactly(core::net::SocketHandle socket, std::uint8_t* out, std::size_t size) {
+    std::size_t received = 0;
+    while (received < size) {
+        const auto n = recv(socket, reinterpret_cast<char*>(out + received), static_cast<int>(size - received), 0);
+        if (n <= 0) {
+            return false;
+        }
+        received += static_cast<std::size_t>(n);
+    }
+    return true;
+}
+
+} // namespace openmeters::test
@@ -0,0 +1,160 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../../common/binary-log.h"
+#include "../../common/logger.h"
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace openmeters::common;
+
+namespace {
+
+template <typename... Args>
+LogRecord makeRecord(LogLevel level, int line, std::int64_t ticks, LogFormat<Args...> format, const Args&... args) {
+    LogRecord record;
+    LogArgWriter writer(record.text, LogRecord::kMaxMessage);
+    (writer.add(args), ...);
+    record.format = format.c_str();
+    record.file = "src/dir/binary-test.cpp";
+    record.line = line;
+    record.timestampTicks = ticks;
+    record.threadId = 3;
+    record.level = static_cast<std::uint8_t>(level);
+    record.length = static_cast<std::uint16_t>(writer.size());
+    record.truncated = writer.truncated();
+    return record;
+}
+
+std::vector<std::string> readLines(const std::filesystem::path& path) {
+    std::vector<std::string> lines;
+    std::ifstream file(path);
+    std::string line;
+    while (std::getline(file, line)) {
+        lines.push_back(line);
+    }
+    return lines;
+}
+
+} // namespace
+
+TEST_CASE("Binary log - decoded lines match the text formatter", "[logger]") {
+    const auto path = std::filesystem::temp_directory_path() / "openmeters-test-binary.omlog";
+    const LogClock clock = LogClock::calibrate();
+
+    std::vector<LogRecord> records;
+    for (int i = 0; i < 50; ++i) {
+        records.push_back(makeRecord(LogLevel::Debug, 10, clock.baseTicks + i * 1000,
+                                     "block {} peak {:.2f} dB from {}", i, -6.5 * i, "capture"));
+    }
+    records.push_back(makeRecord(LogLevel::Error, 20, clock.baseTicks + 60000, "GetBuffer failed: 0x{:x}", 0x88890004u));
+    LogRecord plain;
+    plain.timestampTicks = clock.baseTicks + 70000;
+    plain.level = static_cast<std::uint8_t>(LogLevel::Info);
+    plain.length = 5;
+    std::memcpy(plain.text, "plain", 5);
+    records.push_back(plain);
+
+    std::string expected;
+    LogLineFormatter textFormatter(clock);
+    {
+        BinaryLogWriter writer;
+        REQUIRE(writer.open(path.string(), clock));
+        for (const LogRecord& record : records) {
+            writer.append(record);
+            textFormatter.append(expected, record);
+        }
+        writer.appendDropped(7, "capture");
+        LogLineFormatter::appendDropped(expected, 7, "capture");
+        writer.close();
+    }
+
+    // Each format and file name is stored once, not per record
+    const auto size = std::filesystem::file_size(path);
+    REQUIRE(size < expected.size());
+    {
+        std::ifstream file(path, std::ios::binary);
+        const std::string bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        const std::string format = "block {} peak {:.2f} dB from {}";
+        const auto first = bytes.find(format);
+        REQUIRE(first != std::string::npos);
+        REQUIRE(bytes.find(format, first + 1) == std::string::npos);
+        REQUIRE(bytes.find("block 7") == std::string::npos);
+    }
+
+    BinaryLogReader reader;
+    REQUIRE(reader.open(path.string()));
+    REQUIRE(reader.clock().baseTicks == clock.baseTicks);
+    REQUIRE(reader.clock().baseSystemUs == clock.baseSystemUs);
+
+    LogLineFormatter decoder(reader.clock());
+    std::string decoded;
+    BinaryLogEntry entry;
+    std::size_t entries = 0;
+    while (reader.next(entry)) {
+        if (entry.dropped) {
+            LogLineFormatter::appendDropped(decoded, entry.droppedCount, entry.droppedWhere);
+        } else {
+            REQUIRE(entry.record.threadId == records[entries].threadId);
+            decoder.append(decoded, entry.record);
+        }
+        ++entries;
+    }
+    REQUIRE_FALSE(reader.damaged());
+    REQUIRE(entries == records.size() + 1);
+    REQUIRE(decoded == expected);
+
+    // A file cut off mid-entry decodes up to the damage
+    std::filesystem::resize_file(path, size - 3);
+    REQUIRE(reader.open(path.string()));
+    entries = 0;
+    while (reader.next(entry)) {
+        ++entries;
+    }
+    REQUIRE(reader.damaged());
+    REQUIRE(entries == records.size());
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Binary log - logger sends verbose levels only to the binary sink", "[logger]") {
+    const auto textPath = std::filesystem::temp_directory_path() / "openmeters-test-binary-sink.log";
+    const auto binaryPath = std::filesystem::temp_directory_path() / "openmeters-test-binary-sink.omlog";
+    std::filesystem::remove(textPath);
+
+    REQUIRE(Logger::initialize(textPath.string(), LogLevel::Debug, false, binaryPath.string()));
+    LOG_DEBUG("trace value {}", 42);
+    LOG_WARNING("device {} lost", "speakers");
+    Logger::shutdown();
+
+    std::size_t textTrace = 0;
+    std::size_t textWarnings = 0;
+    for (const std::string& line : readLines(textPath)) {
+        textTrace += line.find("trace value") != std::string::npos ? 1 : 0;
+        textWarnings += line.find("[WARN ] [test_binary_log.cpp:") != std::string::npos &&
+                        line.find("device speakers lost") != std::string::npos ? 1 : 0;
+    }
+    REQUIRE(textTrace == 0);
+    REQUIRE(textWarnings == 1);
+
+    BinaryLogReader reader;
+    REQUIRE(reader.open(binaryPath.string()));
+    LogLineFormatter formatter(reader.clock());
+    std::string decoded;
+    BinaryLogEntry entry;
+    while (reader.next(entry)) {
+        if (!entry.dropped) {
+            formatter.append(decoded, entry.record);
+        }
+    }
+    REQUIRE_FALSE(reader.damaged());
+    REQUIRE(decoded.find("[DEBUG] [test_binary_log.cpp:") != std::string::npos);
+    REQUIRE(decoded.find("trace value 42\n") != std::string::npos);
+    REQUIRE(decoded.find("device speakers lost\n") != std::string::npos);
+    REQUIRE(decoded.find("Logger shutting down\n") != std::string::npos);
+
+    std::filesystem::remove(textPath);
+    std::filesystem::remove(binaryPath);
+}
@@ -0,0 +1,132 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../../common/config.h"
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+
+using namespace openmeters::common;
+
+TEST_CASE("Config - published snapshots are immutable and versioned", "[config]") {
+    ConfigManager::reset();
+    ConfigView view;
+    const ConfigSnapshot before = ConfigManager::snapshot();
+    const std::uint64_t version = ConfigManager::version();
+
+    std::atomic<int> notified{0};
+    float notifiedScale = 0.0f;
+    const std::uint64_t listener = ConfigManager::subscribe([&](const ConfigSnapshot& next) {
+        notifiedScale = next->uiScale;
+        notified.fetch_add(1);
+    });
+
+    AppConfig changed = *before;
+    changed.uiScale = 1.5f;
+    REQUIRE(ConfigManager::publish(changed));
+    REQUIRE_FALSE(ConfigManager::publish(changed)); // Unchanged: no new version, no notification
+
+    REQUIRE(ConfigManager::version() == version + 1);
+    REQUIRE(notified.load() == 1);
+    REQUIRE(notifiedScale == 1.5f);
+
+    // Old holders keep the configuration they took
+    REQUIRE(before->uiScale == 1.0f);
+    REQUIRE(view->uiScale == 1.0f);
+    REQUIRE(view.refresh());
+    REQUIRE(view->uiScale == 1.5f);
+    REQUIRE_FALSE(view.refresh());
+
+    ConfigManager::unsubscribe(listener);
+    ConfigManager::reset();
+    REQUIRE(notified.load() == 1);
+}
+
+TEST_CASE("Config - edits on disk are reloaded and published", "[config]") {
+    const auto directory = std::filesystem::temp_directory_path() / "openmeters-test-config";
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+    const std::string path = (directory / "config.json").string();
+
+    {
+        std::ofstream file(path);
+        file << R"({"oscPort": 9100})";
+    }
+    REQUIRE(ConfigManager::load(path));
+    REQUIRE(ConfigManager::snapshot()->oscPort == 9100);
+
+    std::atomic<int> reloads{0};
+    const std::uint64_t listener = ConfigManager::subscribe([&](const ConfigSnapshot&) { reloads.fetch_add(1); });
+    REQUIRE(ConfigManager::startWatching());
+
+    const auto waitFor = [](auto&& condition) {
+        for (int i = 0; i < 300 && !condition(); ++i) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        return condition();
+    };
+
+    // Replaced by rename, as editors (and atomic writers) do
+    {
+        std::ofstream file(path + ".tmp");
+        file << R"({"oscPort": 9200, "darkMode": false})";
+    }
+    std::filesystem::rename(path + ".tmp", path);
+    REQUIRE(waitFor([] { return ConfigManager::snapshot()->oscPort == 9200; }));
+    REQUIRE_FALSE(ConfigManager::snapshot()->darkMode);
+
+    // A broken file keeps the last good configuration
+    {
+        std::ofstream file(path);
+        file << "{ not json";
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    REQUIRE(ConfigManager::snapshot()->oscPort == 9200);
+    REQUIRE(reloads.load() == 1);
+
+    ConfigManager::stopWatching();
+    ConfigManager::unsubscribe(listener);
+    ConfigManager::reset();
+    std::filesystem::remove_all(directory);
+}
+
+TEST_CASE("Config - background saves coalesce and replace the file atomically", "[config]") {
+    const auto directory = std::filesystem::temp_directory_path() / "openmeters-test-config-save";
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+    const std::string path = (directory / "config.json").string();
+    {
+        std::ofstream file(path);
+        file << R"({"oscPort": 9000})";
+    }
+    REQUIRE(ConfigManager::load(path));
+    const auto originalWrite = std::filesystem::last_write_time(path);
+
+    // A burst of requests; nothing is written while they keep coming
+    AppConfig config = *ConfigManager::snapshot();
+    for (int port = 9001; port <= 9010; ++port) {
+        config.oscPort = port;
+        ConfigManager::publish(config);
+        ConfigManager::saveAsync();
+    }
+    REQUIRE(std::filesystem::last_write_time(path) == originalWrite);
+
+    // The write after the burst has the latest values
+    REQUIRE(ConfigManager::flushSaves());
+    AppConfig saved;
+    REQUIRE(saved.loadFromFile(path));
+    REQUIRE(saved.oscPort == 9010);
+    REQUIRE_FALSE(std::filesystem::exists(path + ".tmp"));
+
+    // The saver restarts on demand after a flush
+    config.oscPort = 9011;
+    ConfigManager::publish(config);
+    ConfigManager::saveAsync();
+    REQUIRE(ConfigManager::flushSaves());
+    REQUIRE(saved.loadFromFile(path));
+    REQUIRE(saved.oscPort == 9011);
+
+    ConfigManager::reset();
+    std::filesystem::remove_all(directory);
+}
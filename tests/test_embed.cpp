@@ -0,0 +1,113 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../../core/embed/openmeters-embed.h"
+#include <cmath>
+#include <vector>
+
+namespace {
+
+struct CallbackLog {
+    int calls = 0;
+    om_levels last{};
+};
+
+void recordLevels(void* userData, const om_levels* levels) {
+    auto* log = static_cast<CallbackLog*>(userData);
+    ++log->calls;
+    log->last = *levels;
+}
+
+} // namespace
+
+TEST_CASE("Embed API - create rejects unsupported formats", "[embed]") {
+    REQUIRE(om_embed_api_version() == OM_EMBED_API_VERSION);
+    REQUIRE(om_engine_create(0, 2, 512) == nullptr);
+    REQUIRE(om_engine_create(48000, 0, 512) == nullptr);
+    REQUIRE(om_engine_create(48000, 3, 512) == nullptr);
+}
+
+TEST_CASE("Embed API - host-pushed blocks are metered", "[embed]") {
+    om_engine* engine = om_engine_create(48000, 2, 512);
+    REQUIRE(engine != nullptr);
+    
+    CallbackLog log;
+    REQUIRE(om_engine_set_levels_callback(engine, recordLevels, &log) == OM_OK);
+    
+    // Left at 0.5, right at -0.25
+    std::vector<float> block(256 * 2);
+    for (std::size_t i = 0; i < 256; ++i) {
+        block[i * 2] = 0.5f;
+        block[i * 2 + 1] = -0.25f;
+    }
+    
+    const std::uint64_t versionBefore = om_engine_snapshot_version(engine);
+    REQUIRE(om_engine_process(engine, block.data(), 256) == OM_OK);
+    REQUIRE(om_engine_process(engine, block.data(), 256) == OM_OK);
+    REQUIRE(om_engine_snapshot_version(engine) != versionBefore);
+    
+    om_levels levels{};
+    levels.struct_size = sizeof(om_levels);
+    REQUIRE(om_engine_get_levels(engine, &levels) == OM_OK);
+    REQUIRE(levels.channel_count == 2);
+    REQUIRE(levels.stream_frame == 512);
+    REQUIRE(levels.version == om_engine_snapshot_version(engine));
+    REQUIRE(std::fabs(levels.peak[0] - 0.5f) < 1e-6f);
+    REQUIRE(std::fabs(levels.peak[1] - 0.25f) < 1e-6f);
+    REQUIRE(std::fabs(levels.rms[0] - 0.5f) < 1e-4f);
+    
+    REQUIRE(log.calls == 2);
+    REQUIRE(log.last.stream_frame == 512);
+    
+    SECTION("Reset publishes zeroed levels under a new version") {
+        const std::uint64_t versionBeforeReset = om_engine_snapshot_version(engine);
+        om_engine_reset(engine);
+        REQUIRE(om_engine_snapshot_version(engine) != versionBeforeReset);
+        REQUIRE(om_engine_get_levels(engine, &levels) == OM_OK);
+        REQUIRE(levels.version == om_engine_snapshot_version(engine));
+        REQUIRE(levels.stream_frame == 0);
+        REQUIRE(levels.timestamp_ms == 0);
+        REQUIRE(levels.peak[0] == 0.0f);
+        REQUIRE(levels.rms[1] == 0.0f);
+        REQUIRE(levels.channel_count == 2);
+        
+        REQUIRE(om_engine_process(engine, block.data(), 256) == OM_OK);
+        REQUIRE(om_engine_get_levels(engine, &levels) == OM_OK);
+        REQUIRE(levels.stream_frame == 256);
+        REQUIRE(std::fabs(levels.peak[0] - 0.5f) < 1e-6f);
+    }
+    
+    // Size check protects older callers
+    om_levels tooSmall{};
+    tooSmall.struct_size = 4;
+    REQUIRE(om_engine_get_levels(engine, &tooSmall) == OM_ERROR_INVALID_ARGUMENT);
+    
+    REQUIRE(om_engine_process(engine, nullptr, 16) == OM_ERROR_INVALID_ARGUMENT);
+    REQUIRE(om_engine_plugin_count(engine) == 0);
+    
+    om_engine_destroy(engine);
+}
+
+TEST_CASE("Embed API - events are read with a cursor", "[embed]") {
+    om_engine* engine = om_engine_create(48000, 1, 1024);
+    REQUIRE(engine != nullptr);
+    
+    om_event_cursor cursor = om_engine_event_cursor(engine);
+    
+    // A run of full-scale samples is a clip
+    std::vector<float> block(1024, 0.1f);
+    for (std::size_t i = 100; i < 110; ++i) {
+        block[i] = 1.0f;
+    }
+    REQUIRE(om_engine_process(engine, block.data(), 1024) == OM_OK);
+    
+    om_event events[8];
+    const uint32_t count = om_engine_read_events(engine, &cursor, events, 8);
+    REQUIRE(count >= 1);
+    REQUIRE(events[0].type == OM_EVENT_CLIP);
+    REQUIRE(events[0].start_frame == 100);
+    REQUIRE(cursor.dropped == 0);
+    
+    // Nothing new since the last read
+    REQUIRE(om_engine_read_events(engine, &cursor, events, 8) == 0);
+    
+    om_engine_destroy(engine);
+}
@@ -0,0 +1,155 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../../core/meters/event-detector.h"
+#include "../../common/audio-format.h"
+#include <vector>
+
+using namespace openmeters;
+
+namespace {
+
+std::vector<common::MeterEvent> runDetector(
+    core::meters::EventDetector& detector,
+    const std::vector<float>& buffer,
+    const common::AudioFormat& format,
+    std::uint64_t streamFrame = 0
+) {
+    std::vector<common::MeterEvent> events(64);
+    const std::size_t frames = buffer.size() / format.samplesPerFrame();
+    const std::size_t count = detector.process(buffer.data(), frames, format, streamFrame,
+                                               events.data(), events.size());
+    events.resize(count);
+    return events;
+}
+
+} // namespace
+
+TEST_CASE("Event detector - clips", "[meters][events]") {
+    core::meters::EventDetector detector;
+    common::AudioFormat format;
+    format.channelCount = 1;
+
+    SECTION("Quiet signal produces no events") {
+        std::vector<float> buffer(256, 0.25f);
+        REQUIRE(runDetector(detector, buffer, format).empty());
+    }
+
+    SECTION("Run of full-scale samples is reported with exact position") {
+        std::vector<float> buffer(256, 0.25f);
+        for (std::size_t i = 100; i < 104; ++i) {
+            buffer[i] = 1.0f;
+        }
+
+        auto events = runDetector(detector, buffer, format, 1000);
+        REQUIRE(events.size() == 1);
+        REQUIRE(events[0].type == common::MeterEventType::Clip);
+        REQUIRE(events[0].startFrame == 1100);
+        REQUIRE(events[0].lengthFrames == 4);
+    }
+
+    SECTION("Runs shorter than the minimum are ignored") {
+        std::vector<float> buffer(256, 0.25f);
+        buffer[50] = 1.0f;
+        buffer[51] = -1.0f;
+
+        auto events = runDetector(detector, buffer, format);
+        REQUIRE(events.empty());
+    }
+
+    SECTION("Clip spanning two buffers is reported once") {
+        std::vector<float> first(64, 0.25f);
+        std::vector<float> second(64, 0.25f);
+        first[62] = first[63] = 1.0f;
+        second[0] = second[1] = 1.0f;
+
+        REQUIRE(runDetector(detector, first, format, 0).empty());
+        auto events = runDetector(detector, second, format, 64);
+        REQUIRE(events.size() == 1);
+        REQUIRE(events[0].startFrame == 62);
+        REQUIRE(events[0].lengthFrames == 4);
+    }
+}
+
+TEST_CASE("Event detector - inter-sample overs", "[meters][events]") {
+    core::meters::EventDetector detector;
+    common::AudioFormat format;
+    format.channelCount = 1;
+
+    // Two equal samples just below full scale between quieter neighbours
+    // reconstruct to a peak above full scale.
+    std::vector<float> buffer(128, 0.1f);
+    buffer[60] = 0.8f;
+    buffer[61] = 0.98f;
+    buffer[62] = 0.98f;
+    buffer[63] = 0.8f;
+
+    auto events = runDetector(detector, buffer, format);
+    REQUIRE(events.size() == 1);
+    REQUIRE(events[0].type == common::MeterEventType::InterSampleOver);
+    REQUIRE(events[0].startFrame == 61);
+    REQUIRE(events[0].magnitude > 1.0f);
+}
+
+TEST_CASE("Event detector - dropouts", "[meters][events]") {
+    core::meters::EventDetector detector;
+    common::AudioFormat format;
+    format.channelCount = 2;
+
+    SECTION("Short zero run inside signal is a dropout on the affected channel") {
+        std::vector<float> buffer(2 * 256, 0.3f);
+        for (std::size_t frame = 100; frame < 132; ++frame) {
+            buffer[frame * 2 + 1] = 0.0f;
+        }
+
+        auto events = runDetector(detector, buffer, format);
+        REQUIRE(events.size() == 1);
+        REQUIRE(events[0].type == common::MeterEventType::Dropout);
+        REQUIRE(events[0].channel == 1);
+        REQUIRE(events[0].startFrame == 100);
+        REQUIRE(events[0].lengthFrames == 32);
+    }
+
+    SECTION("Leading silence is not a dropout") {
+        std::vector<float> buffer(2 * 256, 0.3f);
+        std::fill(buffer.begin(), buffer.begin() + 2 * 64, 0.0f);
+
+        REQUIRE(runDetector(detector, buffer, format).empty());
+    }
+}
+
+TEST_CASE("Event detector - output capacity", "[meters][events]") {
+    core::meters::EventDetector detector;
+    common::AudioFormat format;
+    format.channelCount = 1;
+
+    std::vector<float> buffer(256, 0.25f);
+    for (std::size_t start = 10; start < 250; start += 20) {
+        buffer[start] = buffer[start + 1] = buffer[start + 2] = 1.0f;
+    }
+
+    common::MeterEvent events[2];
+    const std::size_t count = detector.process(buffer.data(), buffer.size(), format, 0, events, 2);
+    REQUIRE(count == 2);
+    REQUIRE(detector.droppedEvents() == 10);
+}
+
+TEST_CASE("Broadcast ring - readers", "[common][events]") {
+    common::MeterEventRing ring;
+    auto first = ring.tail();
+
+    common::MeterEvent event;
+    event.startFrame = 7;
+    ring.push(event);
+
+    auto second = ring.tail();
+    event.startFrame = 8;
+    ring.push(event);
+
+    common::MeterEvent out[4];
+    REQUIRE(ring.read(first, out, 4) == 2);
+    REQUIRE(out[0].startFrame == 7);
+    REQUIRE(out[1].startFrame == 8);
+
+    REQUIRE(ring.read(second, out, 4) == 1);
+    REQUIRE(out[0].startFrame == 8);
+    REQUIRE(ring.read(second, out, 4) == 0);
+}
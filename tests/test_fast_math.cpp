@@ -0,0 +1,86 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../../common/fast-math.h"
+#include "../../common/db-scale.h"
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using namespace openmeters::common;
+
+TEST_CASE("Fast math - log2 and dB stay within the error bound", "[fastmath]") {
+    // Near 1 the series error dominates; far from it, rounding of the float result
+    double worstLog2 = 0.0;
+    double worstNearOne = 0.0;
+    for (float x = 1e-37f; x < 1e37f; x *= 1.0137f) {
+        const double error = std::fabs(double(fastLog2(x)) - std::log2(double(x)));
+        worstLog2 = std::max(worstLog2, error);
+        if (x > 1e-3f && x < 1e3f) {
+            worstNearOne = std::max(worstNearOne, error);
+        }
+    }
+    REQUIRE(worstLog2 < 5e-6);
+    REQUIRE(worstNearOne < 1e-6);
+
+    double worstExp2 = 0.0;
+    for (float x = -100.0f; x < 100.0f; x += 0.0371f) {
+        const double exact = std::exp2(double(x));
+        worstExp2 = std::max(worstExp2, std::fabs(double(fastExp2(x)) - exact) / exact);
+    }
+    REQUIRE(worstExp2 < 1e-6);
+
+    REQUIRE(std::fabs(fastLinearToDb(0.5f, -120.0f) - (-6.0206f)) < 1e-4f);
+    REQUIRE(std::fabs(fastDbToLinear(-20.0f, -120.0f) - 0.1f) < 1e-6f);
+    REQUIRE(fastLinearToDb(0.0f, -60.0f) == -60.0f);
+    REQUIRE(fastLinearToDb(-1.0f, -60.0f) == -60.0f);
+    REQUIRE(fastLinearToDb(std::numeric_limits<float>::quiet_NaN(), -60.0f) == -60.0f);
+    REQUIRE(fastLinearToDb(1e-5f, -60.0f) == -60.0f);
+    REQUIRE(fastDbToLinear(-60.0f, -60.0f) == 0.0f);
+}
+
+TEST_CASE("Fast math - bulk conversion matches the scalar path", "[fastmath]") {
+    std::vector<float> in;
+    for (float x = 1e-9f; x < 4.0f; x *= 1.37f) {
+        in.push_back(x);
+    }
+    in.push_back(0.0f);
+    in.push_back(-0.5f);
+    in.push_back(std::numeric_limits<float>::quiet_NaN());
+    in.push_back(1.0f);
+
+    std::vector<float> out(in.size());
+    linearToDb(in.data(), out.data(), in.size(), -90.0f);
+    for (std::size_t i = 0; i < in.size(); ++i) {
+        REQUIRE(std::fabs(out[i] - fastLinearToDb(in[i], -90.0f)) < 1e-4f);
+    }
+    REQUIRE(out.back() == 0.0f);
+
+    // In place
+    linearToDb(in.data(), in.data(), in.size(), -90.0f);
+    REQUIRE(in == out);
+}
+
+TEST_CASE("dB scale - thresholds and zones follow the scale", "[fastmath]") {
+    const DbScale scale; // -60..0 dBFS in 20 segments, yellow from -18, red from -6
+    REQUIRE(scale.segments() == 20);
+    REQUIRE(scale.segmentDb(0) == -60.0f);
+    REQUIRE(scale.segmentDb(18) == -6.0f);
+    REQUIRE(std::fabs(scale.threshold(18) - 0.501187f) < 1e-5f);
+    REQUIRE(scale.zone(13) == DbZone::Normal);
+    REQUIRE(scale.zone(14) == DbZone::Warning);
+    REQUIRE(scale.zone(18) == DbZone::Over);
+
+    REQUIRE(scale.litSegments(0.0f) == 0);
+    REQUIRE(scale.litSegments(0.001f) == 0);   // Exactly -60 dB: not above the first threshold
+    REQUIRE(scale.litSegments(0.0011f) == 1);
+    REQUIRE(scale.litSegments(0.5f) == 18);
+    REQUIRE(scale.litSegments(1.0f) == 20);
+    REQUIRE(scale.litSegments(std::numeric_limits<float>::quiet_NaN()) == 0);
+
+    // K-14: 0 K at -14 dBFS, 54 dB of range
+    const DbScale k14 = DbScale::kSystem(14, 27);
+    REQUIRE(k14.minDb() == -54.0f);
+    REQUIRE(k14.zone(k14.segments() - 1) == DbZone::Over);
+    REQUIRE(k14.zone(19) == DbZone::Normal);  // -16 dBFS, below 0 K
+    REQUIRE(k14.zone(20) == DbZone::Warning); // -14 dBFS = 0 K
+    REQUIRE(k14.zone(22) == DbZone::Over);    // -10 dBFS = +4 K
+}
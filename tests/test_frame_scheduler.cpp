@@ -0,0 +1,99 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../../ui/frame-scheduler.h"
+
+using namespace openmeters::ui;
+using namespace std::chrono_literals;
+
+TEST_CASE("Frame scheduler - idle until something asks for a frame", "[frames]") {
+    FrameScheduler frames;
+    const auto start = FrameScheduler::Clock::time_point{} + 1s;
+
+    // The first frame is always drawn
+    REQUIRE(frames.due(start) == FrameReasonForced);
+    frames.frameRendered(start, FrameReasonForced);
+
+    // Nothing requested: block indefinitely
+    REQUIRE(frames.due(start + 1s) == FrameReasonNone);
+    REQUIRE(frames.waitTime(start + 1s) == FrameScheduler::Clock::duration::max());
+
+    // A meter change is drawn at once when the last frame is old enough
+    frames.request(FrameReasonMeters);
+    REQUIRE(frames.waitTime(start + 1s) == FrameScheduler::Clock::duration::zero());
+    REQUIRE(frames.due(start + 1s) == FrameReasonMeters);
+    frames.frameRendered(start + 1s, FrameReasonMeters);
+    REQUIRE(frames.due(start + 2s) == FrameReasonNone);
+    REQUIRE(frames.framesRendered() == 2);
+}
+
+TEST_CASE("Frame scheduler - frames are paced by the minimum interval", "[frames]") {
+    FrameSchedulerSettings settings;
+    settings.minFrameInterval = 10ms;
+    FrameScheduler frames(settings);
+    const auto start = FrameScheduler::Clock::time_point{} + 1s;
+    frames.frameRendered(start, frames.due(start));
+
+    frames.request(FrameReasonMeters);
+    REQUIRE(frames.due(start + 4ms) == FrameReasonNone);
+    REQUIRE(frames.waitTime(start + 4ms) == 6ms);
+    REQUIRE(frames.due(start + 10ms) == FrameReasonMeters);
+
+    // Requests made in between are folded into one frame
+    frames.request(FrameReasonForced);
+    REQUIRE(frames.due(start + 10ms) == (FrameReasonMeters | FrameReasonForced));
+}
+
+TEST_CASE("Frame scheduler - input settles and deadlines fire", "[frames]") {
+    FrameSchedulerSettings settings;
+    settings.minFrameInterval = 10ms;
+    settings.inputSettleFrames = 2;
+    FrameScheduler frames(settings);
+    auto now = FrameScheduler::Clock::time_point{} + 1s;
+    frames.frameRendered(now, frames.due(now));
+
+    // One input event draws the frame plus two settle frames
+    frames.request(FrameReasonInput);
+    int inputFrames = 0;
+    for (int i = 0; i < 10; ++i) {
+        now += 10ms;
+        const std::uint32_t reasons = frames.due(now);
+        if (reasons != FrameReasonNone) {
+            REQUIRE(reasons == FrameReasonInput);
+            frames.frameRendered(now, reasons);
+            ++inputFrames;
+        }
+    }
+    REQUIRE(inputFrames == 3);
+
+    // A deadline wakes the loop on time; the earliest one wins
+    frames.requestAt(now + 500ms);
+    frames.requestAt(now + 200ms);
+    REQUIRE(frames.waitTime(now) == 200ms);
+    REQUIRE(frames.due(now + 199ms) == FrameReasonNone);
+    REQUIRE(frames.due(now + 200ms) == FrameReasonAnimation);
+    frames.frameRendered(now + 200ms, FrameReasonAnimation);
+    REQUIRE(frames.waitTime(now + 200ms) == FrameScheduler::Clock::duration::max());
+}
+
+TEST_CASE("Frame scheduler - meter changes below the threshold are ignored", "[frames]") {
+    openmeters::common::MeterSnapshot drawn;
+    drawn.peak = {0.5f, 0.5f};
+    drawn.rms = {0.25f, 0.25f};
+
+    openmeters::common::MeterSnapshot next = drawn;
+    REQUIRE_FALSE(FrameScheduler::meterChanged(drawn, next, 0.5f, -60.0f));
+
+    next.peak.left = 0.51f; // ~0.17 dB
+    REQUIRE_FALSE(FrameScheduler::meterChanged(drawn, next, 0.5f, -60.0f));
+
+    next.rms.right = 0.3f; // ~1.6 dB
+    REQUIRE(FrameScheduler::meterChanged(drawn, next, 0.5f, -60.0f));
+
+    // Movement under the floor is silence either way
+    drawn = {};
+    next = {};
+    drawn.peak.left = 0.0001f;  // -80 dB
+    next.peak.left = 0.0005f;   // -66 dB
+    REQUIRE_FALSE(FrameScheduler::meterChanged(drawn, next, 0.5f, -60.0f));
+    next.peak.left = 0.01f;     // -40 dB
+    REQUIRE(FrameScheduler::meterChanged(drawn, next, 0.5f, -60.0f));
+}
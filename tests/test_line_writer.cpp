@@ -0,0 +1,134 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../../core/net/line-writer.h"
+#include "test-helpers.h"
+#include <chrono>
+#include <string>
+#include <thread>
+
+using namespace openmeters;
+using test::FakeMeterSource;
+using core::net::LineFormat;
+
+namespace {
+
+common::MeterSnapshot makeSnapshot() {
+    common::MeterSnapshot snapshot;
+    snapshot.timestampMs = 1500;
+    snapshot.peak.left = 0.5f;
+    snapshot.peak.right = 0.25f;
+    snapshot.rms.left = 0.125f;
+    snapshot.rms.right = 0.0f;
+    return snapshot;
+}
+
+std::string readAll(std::FILE* file) {
+    std::rewind(file);
+    std::string text;
+    char chunk[512];
+    std::size_t n = 0;
+    while ((n = std::fread(chunk, 1, sizeof(chunk), file)) > 0) {
+        text.append(chunk, n);
+    }
+    return text;
+}
+
+} // namespace
+
+TEST_CASE("Line writer - formats NDJSON and CSV lines", "[linewriter]") {
+    std::string out;
+    core::net::appendNdjsonSnapshot(out, core::net::quoteJson("main"), 7, makeSnapshot());
+    REQUIRE(out == "{\"t\":1500,\"source\":\"main\",\"seq\":7,\"peak\":[0.5,0.25],\"rms\":[0.125,0]}\n");
+
+    out.clear();
+    core::net::appendCsvSnapshot(out, "main", 7, makeSnapshot());
+    REQUIRE(out == "1500,main,7,0.5,0.25,0.125,0\n");
+
+    common::MeterEvent event;
+    event.type = common::MeterEventType::Clip;
+    event.channel = 1;
+    event.startFrame = 48000;
+    event.lengthFrames = 4;
+    event.magnitude = 1.0f;
+    out.clear();
+    core::net::appendNdjsonEvent(out, core::net::quoteJson("main"), event);
+    REQUIRE(out == "{\"source\":\"main\",\"event\":\"clip\",\"channel\":1,\"frame\":48000,\"length\":4,\"magnitude\":1}\n");
+
+    REQUIRE(core::net::quoteJson("a\"b\\c\n") == "\"a\\\"b\\\\c\\u000a\"");
+}
+
+TEST_CASE("Line writer - streams changed snapshots in batches", "[linewriter]") {
+    FakeMeterSource source;
+    source.publish(makeSnapshot());
+
+    std::FILE* file = std::tmpfile();
+    REQUIRE(file != nullptr);
+
+    core::net::LineWriter writer;
+    REQUIRE(writer.addSource("loop,back", &source));
+
+    core::net::LineWriterSettings settings;
+    settings.format = LineFormat::Csv;
+    settings.rateHz = 200.0f;
+    settings.flushIntervalMs = 10;
+    REQUIRE(writer.start(file, settings));
+    REQUIRE_FALSE(writer.addSource("late", &source));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    source.publish(makeSnapshot());
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    source.publish(makeSnapshot());
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    writer.stop();
+
+    // Header, then one row per snapshot version published after start (not per tick)
+    REQUIRE(writer.linesWritten() == 2);
+    const std::string text = readAll(file);
+    REQUIRE(text.rfind("timestamp_ms,source,seq,peak_l,peak_r,rms_l,rms_r\n", 0) == 0);
+    REQUIRE(text.find("1500,\"loop,back\",1,") == std::string::npos);
+    REQUIRE(text.find("1500,\"loop,back\",2,0.5,0.25,0.125,0\n") != std::string::npos);
+    REQUIRE(text.find("1500,\"loop,back\",3,") != std::string::npos);
+    std::fclose(file);
+}
+
+TEST_CASE("Line writer - waits for the first snapshot", "[linewriter]") {
+    FakeMeterSource source;
+    std::FILE* file = std::tmpfile();
+    REQUIRE(file != nullptr);
+
+    core::net::LineWriter writer;
+    REQUIRE(writer.addSource("main", &source));
+
+    core::net::LineWriterSettings settings;
+    settings.rateHz = 200.0f;
+    settings.flushIntervalMs = 10;
+    REQUIRE(writer.start(file, settings));
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    writer.stop();
+
+    // Nothing published yet: no all-zero line
+    REQUIRE(writer.linesWritten() == 0);
+    REQUIRE(readAll(file).empty());
+    std::fclose(file);
+}
+
+TEST_CASE("Line writer - NDJSON includes journal events", "[linewriter]") {
+    FakeMeterSource source;
+    std::FILE* file = std::tmpfile();
+    REQUIRE(file != nullptr);
+
+    core::net::LineWriter writer;
+    REQUIRE(writer.addSource("main", &source));
+    REQUIRE(writer.start(file));
+
+    common::MeterEvent event;
+    event.type = common::MeterEventType::Dropout;
+    event.startFrame = 100;
+    source.journal(event);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    writer.stop();
+
+    const std::string text = readAll(file);
+    REQUIRE(text.find("\"event\":\"dropout\"") != std::string::npos);
+    REQUIRE(text.find("\"frame\":100") != std::string::npos);
+    std::fclose(file);
+}
@@ -0,0 +1,268 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../../common/logger.h"
+#include "../../common/log-file.h"
+#include "../../common/mpsc-queue.h"
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace openmeters::common;
+
+TEST_CASE("MPSC queue - every push from every producer is popped once", "[logger]") {
+    struct Entry {
+        std::uint32_t producer;
+        std::uint32_t sequence;
+    };
+    static MpscQueue<Entry, 256> queue;
+    constexpr std::uint32_t kProducers = 4;
+    constexpr std::uint32_t kPerProducer = 20000;
+
+    std::vector<std::thread> producers;
+    for (std::uint32_t p = 0; p < kProducers; ++p) {
+        producers.emplace_back([p] {
+            for (std::uint32_t i = 0; i < kPerProducer; ++i) {
+                while (!queue.tryPush(Entry{p, i})) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    // Per-producer order is preserved and nothing is lost or duplicated
+    std::vector<std::uint32_t> next(kProducers, 0);
+    std::uint64_t popped = 0;
+    bool ordered = true;
+    Entry entry{};
+    while (popped < kProducers * kPerProducer) {
+        if (queue.tryPop(entry)) {
+            ordered = ordered && entry.sequence == next[entry.producer];
+            next[entry.producer] = entry.sequence + 1;
+            ++popped;
+        }
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+
+    REQUIRE(ordered);
+    REQUIRE_FALSE(queue.tryPop(entry));
+    REQUIRE(queue.pushedCount() == popped);
+    REQUIRE(queue.sizeApprox() == 0);
+}
+
+TEST_CASE("MPSC queue - full queue rejects pushes", "[logger]") {
+    MpscQueue<int, 4> queue;
+    for (int i = 0; i < 4; ++i) {
+        REQUIRE(queue.tryPush(i));
+    }
+    REQUIRE_FALSE(queue.tryPush(99));
+
+    int value = -1;
+    REQUIRE(queue.tryPop(value));
+    REQUIRE(value == 0);
+    REQUIRE(queue.tryPush(4));
+}
+
+TEST_CASE("Logger - async backend writes every line from every thread", "[logger]") {
+    const auto path = std::filesystem::temp_directory_path() / "openmeters-test-logger.log";
+    std::filesystem::remove(path);
+
+    REQUIRE(Logger::initialize(path.string(), LogLevel::Info, false));
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([t] {
+            for (int i = 0; i < 200; ++i) {
+                LOG_INFO("thread {} line {}", t, i);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    LOG_DEBUG("below the minimum level");
+    Logger::info(std::string(LogRecord::kMaxMessage + 50, 'x'));
+    Logger::flush();
+
+    // Visible on disk after flush(), before shutdown
+    std::size_t lines = 0;
+    std::size_t truncated = 0;
+    bool sawDebug = false;
+    {
+        std::ifstream file(path);
+        std::string line;
+        while (std::getline(file, line)) {
+            lines += line.find("] thread ") != std::string::npos ? 1 : 0;
+            truncated += line.find(std::string(LogRecord::kMaxMessage, 'x') + "...") != std::string::npos ? 1 : 0;
+            sawDebug = sawDebug || line.find("below the minimum") != std::string::npos;
+        }
+    }
+    REQUIRE(lines + Logger::droppedRecords() == 800);
+    REQUIRE(truncated == 1);
+    REQUIRE_FALSE(sawDebug);
+
+    Logger::shutdown();
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Log format - deferred arguments render like std::format", "[logger]") {
+    auto render = [](auto format, const auto&... args) {
+        char buffer[LogRecord::kMaxMessage];
+        LogArgWriter writer(buffer, sizeof(buffer));
+        (writer.add(args), ...);
+        std::string out;
+        formatLogMessage(out, format.c_str(), buffer, writer.size());
+        return out;
+    };
+
+    REQUIRE(render(LogFormat<>("plain {{braces}}")) == "plain {braces}");
+    REQUIRE(render(LogFormat<int, unsigned, bool, char>("{} {} {} {}"), -42, 7u, true, 'c') == "-42 7 true c");
+    REQUIRE(render(LogFormat<double, float>("{:.2f} {}"), 3.14159, 0.5f) == "3.14 0.5");
+    REQUIRE(render(LogFormat<std::uint32_t>("0x{:x}"), 0xBEEFu) == "0xbeef");
+
+    const std::string path = "logs/openmeters.log";
+    REQUIRE(render(LogFormat<std::string, const char*, std::string_view>("{}|{}|{}"),
+                   path, "literal", std::string_view("view")) == "logs/openmeters.log|literal|view");
+
+    // Arguments that do not fit are dropped, not overrun
+    char small[12];
+    LogArgWriter writer(small, sizeof(small));
+    writer.add(std::string(40, 'y'));
+    writer.add(1);
+    REQUIRE(writer.truncated());
+    REQUIRE(writer.size() <= sizeof(small));
+    std::string out;
+    formatLogMessage(out, "{}{}", small, writer.size());
+    REQUIRE(out == std::string(10, 'y'));
+}
+
+TEST_CASE("Log macros - arguments are not evaluated below the level", "[logger]") {
+    const LogLevel previous = Logger::getMinLevel();
+    Logger::setMinLevel(LogLevel::Warning);
+
+    int evaluations = 0;
+    auto expensive = [&evaluations] { ++evaluations; return 1; };
+    LOG_INFO("value {}", expensive());
+    LOG_DEBUG("value {}", expensive());
+    REQUIRE(evaluations == 0);
+
+    Logger::setMinLevel(previous);
+}
+
+TEST_CASE("Logger - real-time threads log through their own ring", "[logger]") {
+    const auto path = std::filesystem::temp_directory_path() / "openmeters-test-rt-logger.log";
+    std::filesystem::remove(path);
+
+    const std::uint64_t droppedBefore = Logger::droppedRecords();
+
+    // Not registered: dropped and counted, never blocks
+    LOG_RT_WARNING("unregistered {}", 1);
+    REQUIRE(Logger::droppedRecords() == droppedBefore + 1);
+
+    // Fill the ring while no writer drains it: excess entries are dropped
+    std::thread audio([] {
+        RealtimeLogScope scope("test-audio");
+        for (int i = 0; i < 300; ++i) {
+            LOG_RT_WARNING("block {} late by {:.1f} ms", i, 2.5);
+        }
+    });
+    audio.join();
+    const std::uint64_t ringDrops = Logger::droppedRecords() - droppedBefore - 1;
+    REQUIRE(ringDrops == 300 - 256);
+
+    // The writer drains the retired ring once it starts
+    REQUIRE(Logger::initialize(path.string(), LogLevel::Info, false));
+    Logger::flush();
+
+    std::size_t lines = 0;
+    bool sawNotice = false;
+    {
+        std::ifstream file(path);
+        std::string line;
+        while (std::getline(file, line)) {
+            lines += line.find("late by 2.5 ms") != std::string::npos ? 1 : 0;
+            sawNotice = sawNotice || line.find("dropped (test-audio)") != std::string::npos;
+        }
+    }
+    REQUIRE(lines == 256);
+    REQUIRE(sawNotice);
+
+    Logger::shutdown();
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Log file - rotates by size and keeps a fixed number of files", "[logger]") {
+    const auto directory = std::filesystem::temp_directory_path() / "openmeters-test-rotation";
+    std::filesystem::remove_all(directory);
+    const std::string path = (directory / "app.log").string();
+
+    LogFileSettings settings;
+    settings.maxFileBytes = 1000;
+    settings.maxRetainedFiles = 2;
+    settings.preallocateBytes = 4096;
+
+    RotatingLogFile file;
+    REQUIRE(file.open(path, settings, true));
+    const std::string chunk(99, 'x');
+    for (int i = 0; i < 50; ++i) {
+        if (file.shouldRotate(chunk.size() + 1)) {
+            REQUIRE(file.rotate());
+        }
+        REQUIRE(file.write((chunk + "\n").data(), chunk.size() + 1));
+    }
+    file.close();
+
+    REQUIRE(RotatingLogFile::rotatedPath(path, 2) == (directory / "app.2.log").string());
+    REQUIRE(std::filesystem::exists(path));
+    REQUIRE(std::filesystem::exists(RotatingLogFile::rotatedPath(path, 1)));
+    REQUIRE(std::filesystem::exists(RotatingLogFile::rotatedPath(path, 2)));
+    REQUIRE_FALSE(std::filesystem::exists(RotatingLogFile::rotatedPath(path, 3)));
+
+    // Reserved space is not visible in the file size
+    REQUIRE(std::filesystem::file_size(path) == 1000);
+    REQUIRE(std::filesystem::file_size(RotatingLogFile::rotatedPath(path, 1)) == 1000);
+
+    // Reopening a full file starts a new one
+    REQUIRE(file.open(path, settings, true));
+    REQUIRE(file.size() == 0);
+    file.close();
+
+    std::filesystem::remove_all(directory);
+}
+
+TEST_CASE("Logger - file lines wait for the flush interval unless an error arrives", "[logger]") {
+    const auto path = std::filesystem::temp_directory_path() / "openmeters-test-flush-policy.log";
+    std::filesystem::remove(path);
+
+    LogFileSettings settings;
+    settings.flushInterval = std::chrono::minutes(10);
+    REQUIRE(Logger::initialize(path.string(), LogLevel::Info, false, {}, settings));
+
+    LOG_INFO("buffered line");
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    REQUIRE(std::filesystem::file_size(path) == 0);
+
+    // An error writes everything before it without waiting for flush()
+    LOG_ERROR("urgent line");
+    bool written = false;
+    for (int i = 0; i < 200 && !written; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        written = std::filesystem::file_size(path) > 0;
+    }
+    REQUIRE(written);
+
+    std::string contents;
+    {
+        std::ifstream file(path);
+        contents.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    REQUIRE(contents.find("buffered line") < contents.find("urgent line"));
+
+    Logger::shutdown();
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,199 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../../ui/meter-render.h"
+#include <algorithm>
+
+using namespace openmeters::ui;
+
+namespace {
+
+std::size_t countColor(const DisplayList& list, Rgba color) {
+    return static_cast<std::size_t>(std::count_if(list.commands().begin(), list.commands().end(),
+                                                  [color](const DrawCommand& c) { return c.color == color; }));
+}
+
+} // namespace
+
+TEST_CASE("Meter render - segmented bar lights segments up to the value", "[render]") {
+    MeterRenderStyle style;
+    DisplayList list;
+    const RectF bounds{10.0f, 20.0f, 210.0f, 40.0f};
+
+    SECTION("Silence is just the frame") {
+        appendSegmentedBar(list, bounds, 0.0f, style);
+        REQUIRE(list.size() == 1);
+        REQUIRE(list.commands()[0].bounds == bounds);
+        REQUIRE(list.commands()[0].color == style.frameColor);
+    }
+
+    SECTION("A visible unlit color draws every segment") {
+        style.unlitColor = packRgba(40, 40, 40);
+        appendSegmentedBar(list, bounds, 0.5f, style);
+        REQUIRE(list.size() == 1 + 20);
+        REQUIRE(countColor(list, style.unlitColor) == 2);
+    }
+
+    SECTION("-6 dBFS lights everything below the red zone") {
+        // 0.5 is -6.02 dB: segments start every 3 dB from -60, so the one at -6 stays dark
+        appendSegmentedBar(list, bounds, 0.5f, style);
+        REQUIRE(list.size() == 1 + 18);
+        REQUIRE(countColor(list, style.greenColor) == 14);   // -60 .. -21
+        REQUIRE(countColor(list, style.yellowColor) == 4);   // -18 .. -9
+
+        // Segments sit inside the padded frame, left to right
+        const DrawCommand& first = list.commands()[1];
+        REQUIRE(first.bounds.x0 == bounds.x0 + style.framePaddingX);
+        REQUIRE(first.bounds.y0 == bounds.y0 + style.framePaddingY);
+        REQUIRE(first.bounds.y1 == bounds.y1 - style.framePaddingY);
+        REQUIRE(list.commands()[2].bounds.x0 == first.bounds.x1 + style.segmentSpacing);
+    }
+
+    SECTION("Full scale (and beyond) reaches the red zone") {
+        appendSegmentedBar(list, bounds, 1.5f, style);
+        REQUIRE(list.size() == 1 + 20);
+        REQUIRE(countColor(list, style.greenColor) == 14);
+        REQUIRE(countColor(list, style.yellowColor) == 4);
+        REQUIRE(countColor(list, style.redColor) == 2);
+        REQUIRE(list.commands().back().bounds.x1 == bounds.x1 - style.framePaddingX);
+    }
+}
+
+TEST_CASE("Meter render - panel layout follows the view", "[render]") {
+    MeterRenderStyle style;
+    MeterView view;
+    view.snapshot.peak = {0.5f, 0.25f};
+    view.snapshot.rms = {0.3f, 0.1f};
+    DisplayList list;
+
+    const float height = buildMeterDisplayList(view, style, 200.0f, list);
+    REQUIRE(height == 2 * (style.fontHeight + style.itemSpacing) + 4 * (style.barHeight + style.itemSpacing) +
+                      style.itemSpacing);
+
+    std::size_t textRuns = 0;
+    for (const DrawCommand& command : list.commands()) {
+        if (command.kind == DrawCommandKind::Text) {
+            ++textRuns;
+            REQUIRE((list.text(command) == "Peak" || list.text(command) == "RMS"));
+        }
+    }
+    REQUIRE(textRuns == 2);
+    REQUIRE(countColor(list, style.greenColor) == 4 * 14);
+    REQUIRE(countColor(list, style.yellowColor) == 4 + 2 + 3); // -6.0, -12.0 and -10.5 dB
+
+    view.showRms = false;
+    view.clipLit = true;
+    buildMeterDisplayList(view, style, 200.0f, list);
+    REQUIRE(list.text(list.commands().back()) == "CLIP");
+    REQUIRE(list.commands().back().color == style.clipColor);
+    REQUIRE(countColor(list, style.greenColor) == 2 * 14);
+}
+
+TEST_CASE("Meter render - frames diff against the previous one", "[render]") {
+    MeterRenderStyle style;
+    MeterView view;
+    view.snapshot.peak = {0.5f, 0.5f};
+    view.snapshot.rms = {0.2f, 0.2f};
+    DisplayList previous;
+    DisplayList current;
+
+    buildMeterDisplayList(view, style, 200.0f, previous);
+    buildMeterDisplayList(view, style, 200.0f, current);
+    REQUIRE(current == previous);
+    REQUIRE(current.hash() == previous.hash());
+    REQUIRE(current.diff(previous).identical);
+
+    // Only the right peak bar grows: commands before it are untouched, so
+    // the damage starts at that bar's row
+    view.snapshot.peak.right = 0.6f;
+    buildMeterDisplayList(view, style, 200.0f, current);
+    const DisplayListDiff diff = current.diff(previous);
+    REQUIRE_FALSE(diff.identical);
+    REQUIRE(current.hash() != previous.hash());
+    REQUIRE(current.size() == previous.size() + 1); // The -6 dB segment lights
+    const float rowTop = style.fontHeight + style.itemSpacing + style.barHeight + style.itemSpacing;
+    REQUIRE(diff.damage.y0 >= rowTop);
+
+    // Text is compared by content, not by where it sits in the arena
+    DisplayList a;
+    DisplayList b;
+    a.addText(0.0f, 0.0f, "Peak", style.textColor, 13.0f);
+    b.addText(0.0f, 0.0f, "Peek", style.textColor, 13.0f);
+    REQUIRE_FALSE(a == b);
+    REQUIRE(a.diff(b).changedCommands == 1);
+    b.clear();
+    b.addText(0.0f, 0.0f, "Peak", style.textColor, 13.0f);
+    REQUIRE(a == b);
+    REQUIRE(a.hash() == b.hash());
+}
+
+TEST_CASE("Meter render - cached panels match the uncached layout", "[render]") {
+    MeterRenderStyle style;
+    MeterView view;
+    MeterPanelCache cache;
+    DisplayList cached;
+    DisplayList reference;
+
+    const float levels[] = {0.0f, 0.001f, 0.2f, 0.5f, 1.0f, 2.0f};
+    for (const float level : levels) {
+        view.snapshot.peak = {level, level * 0.5f};
+        view.snapshot.rms = {level * 0.25f, level};
+        view.clipLit = level >= 1.0f;
+
+        cached.clear();
+        const float cachedHeight = cache.append(cached, view, style, 5.0f, 7.0f, 200.0f);
+        reference.clear();
+        const float referenceHeight = appendMeterPanel(reference, view, style, 5.0f, 7.0f, 200.0f);
+
+        REQUIRE(cachedHeight == referenceHeight);
+        REQUIRE(cached == reference);
+    }
+    REQUIRE(cache.rebuilds() == 1);
+
+    SECTION("Unchanged frames keep the hash fast path") {
+        DisplayList again;
+        cache.append(again, view, style, 5.0f, 7.0f, 200.0f);
+        REQUIRE(again.hash() == cached.hash());
+        REQUIRE(again.diff(cached).identical);
+    }
+
+    SECTION("Layout and style changes rebuild the bars") {
+        cached.clear();
+        cache.append(cached, view, style, 5.0f, 7.0f, 260.0f);
+        REQUIRE(cache.rebuilds() == 2);
+
+        style.scale = openmeters::common::DbScale::kSystem(14, 30);
+        cached.clear();
+        cache.append(cached, view, style, 5.0f, 7.0f, 260.0f);
+        REQUIRE(cache.rebuilds() == 3);
+        reference.clear();
+        appendMeterPanel(reference, view, style, 5.0f, 7.0f, 260.0f);
+        REQUIRE(cached == reference);
+
+        view.showRms = false;
+        cached.clear();
+        cache.append(cached, view, style, 5.0f, 7.0f, 260.0f);
+        REQUIRE(cache.rebuilds() == 4);
+    }
+
+    SECTION("A visible unlit color matches too") {
+        style.unlitColor = packRgba(40, 40, 40);
+        for (const float level : levels) {
+            view.snapshot.peak = {level, level * 0.5f};
+            cached.clear();
+            cache.append(cached, view, style, 5.0f, 7.0f, 200.0f);
+            reference.clear();
+            appendMeterPanel(reference, view, style, 5.0f, 7.0f, 200.0f);
+            REQUIRE(cached == reference);
+        }
+    }
+
+    SECTION("A bar too narrow for its segments is just the frame") {
+        SegmentedBarCache bar;
+        bar.build(RectF{0.0f, 0.0f, 10.0f, 20.0f}, style);
+        cached.clear();
+        bar.append(cached, 1.0f);
+        reference.clear();
+        appendSegmentedBar(reference, RectF{0.0f, 0.0f, 10.0f, 20.0f}, 1.0f, style);
+        REQUIRE(cached.size() == 1);
+        REQUIRE(cached == reference);
+    }
+}
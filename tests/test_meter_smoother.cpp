@@ -0,0 +1,146 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../../ui/meter-smoother.h"
+#include <cmath>
+
+using namespace openmeters::ui;
+using namespace std::chrono_literals;
+using openmeters::common::MeterSnapshot;
+
+namespace {
+
+MeterSnapshot levelSnapshot(float level, std::uint64_t timestampMs) {
+    MeterSnapshot snapshot;
+    snapshot.peak = {level, level};
+    snapshot.rms = {level, level};
+    snapshot.timestampMs = timestampMs;
+    return snapshot;
+}
+
+float db(float linear) {
+    return 20.0f * std::log10(linear);
+}
+
+} // namespace
+
+TEST_CASE("Meter smoother - rising values interpolate between packets", "[smoother]") {
+    MeterSmoother smoother;
+    const auto start = MeterSmoother::Clock::time_point{} + 10s;
+
+    // Packets every 20 ms, delivered with some jitter
+    smoother.push(levelSnapshot(0.2f, 1000), start);
+    smoother.push(levelSnapshot(0.4f, 1020), start + 23ms);
+    smoother.push(levelSnapshot(0.6f, 1040), start + 40ms);
+
+    // Frames are shown one packet behind: at 50 ms the display sits halfway
+    // between the 20 ms and 40 ms packets (by capture time, not arrival)
+    const MeterSnapshot shown = smoother.advance(start + 50ms);
+    REQUIRE(shown.peak.left == Approx(0.5f).margin(0.01f));
+    REQUIRE(shown.rms.right == Approx(0.5f).margin(0.01f));
+    REQUIRE(smoother.animating());
+
+    // Once past the newest packet, the display holds it and stops animating
+    const MeterSnapshot settled = smoother.advance(start + 70ms);
+    REQUIRE(settled.peak.left == Approx(0.6f).margin(0.001f));
+    REQUIRE_FALSE(smoother.animating());
+}
+
+TEST_CASE("Meter smoother - falls are rate limited independent of frame rate", "[smoother]") {
+    MeterBallistics ballistics;
+    ballistics.peakReleaseDbPerSecond = 20.0f;
+    ballistics.rmsReleaseDbPerSecond = 40.0f;
+
+    const auto run = [&](std::chrono::microseconds framePeriod) {
+        MeterSmoother smoother(ballistics);
+        const auto start = MeterSmoother::Clock::time_point{} + 10s;
+        smoother.push(levelSnapshot(1.0f, 0), start);
+        smoother.advance(start);
+        smoother.push(levelSnapshot(0.001f, 0), start + 1ms); // Sudden silence (no capture times)
+
+        MeterSnapshot shown;
+        for (auto t = start; t < start + 500ms; t += framePeriod) {
+            shown = smoother.advance(t + framePeriod);
+        }
+        REQUIRE(smoother.animating());
+        return shown;
+    };
+
+    const MeterSnapshot at60 = run(16667us);
+    const MeterSnapshot at240 = run(4167us);
+    REQUIRE(db(at240.peak.left) == Approx(-10.0f).margin(0.5f));
+    REQUIRE(db(at240.rms.left) == Approx(-20.0f).margin(1.0f));
+    REQUIRE(db(at60.peak.left) == Approx(db(at240.peak.left)).margin(0.5f));
+}
+
+TEST_CASE("Meter smoother - rises are immediate and silence settles", "[smoother]") {
+    MeterSmoother smoother;
+    const auto start = MeterSmoother::Clock::time_point{} + 10s;
+    REQUIRE(smoother.advance(start).peak.left == 0.0f);
+
+    smoother.push(levelSnapshot(0.0f, 0), start);
+    smoother.advance(start);
+    smoother.push(levelSnapshot(0.5f, 0), start + 1ms);
+    REQUIRE(smoother.advance(start + 1s).peak.left == Approx(0.5f));
+
+    // After the fall reaches the floor, nothing is left to animate
+    smoother.push(levelSnapshot(0.0f, 0), start + 1s);
+    smoother.advance(start + 1s);
+    const MeterSnapshot shown = smoother.advance(start + 10s);
+    REQUIRE(shown.peak.left == 0.0f);
+    REQUIRE_FALSE(smoother.animating());
+
+    smoother.reset();
+    REQUIRE(smoother.advance(start + 11s).rms.left == 0.0f);
+}
+
+TEST_CASE("Meter smoother - steady input settles while packets keep arriving", "[smoother]") {
+    MeterSmoother smoother;
+    const auto start = MeterSmoother::Clock::time_point{} + 10s;
+    MeterSnapshot steady;
+    steady.peak = {0.5f, 0.5f};
+    steady.rms = {0.3f, 0.3f};
+
+    // 10 ms packets, 60 Hz frames, constant level for ten seconds
+    int animatingFrames = 0;
+    auto nextPacket = start;
+    std::uint64_t timestampMs = 1000;
+    for (int frame = 0; frame < 600; ++frame) {
+        const auto frameTime = start + std::chrono::microseconds(16667) * frame;
+        while (nextPacket <= frameTime) {
+            steady.timestampMs = timestampMs;
+            smoother.push(steady, nextPacket);
+            nextPacket += 10ms;
+            timestampMs += 10;
+        }
+        smoother.advance(frameTime);
+        animatingFrames += smoother.animating() ? 1 : 0;
+    }
+    REQUIRE(animatingFrames <= 1);
+    REQUIRE_FALSE(smoother.animating());
+}
+
+TEST_CASE("Meter smoother - jitter below the settle threshold is not motion", "[smoother]") {
+    MeterSmoother smoother;
+    const auto start = MeterSmoother::Clock::time_point{} + 10s;
+
+    // Real audio never repeats exactly: alternate levels 0.3 dB apart
+    const float quiet = 0.5f;
+    const float loud = quiet * std::pow(10.0f, 0.3f / 20.0f);
+    REQUIRE(db(loud) - db(quiet) < MeterBallistics{}.settledDb);
+
+    int animatingFrames = 0;
+    auto nextPacket = start;
+    std::uint64_t timestampMs = 1000;
+    int packet = 0;
+    for (int frame = 0; frame < 600; ++frame) {
+        const auto frameTime = start + std::chrono::microseconds(16667) * frame;
+        while (nextPacket <= frameTime) {
+            smoother.push(levelSnapshot(packet++ % 2 == 0 ? quiet : loud, timestampMs), nextPacket);
+            nextPacket += 10ms;
+            timestampMs += 10;
+        }
+        smoother.advance(frameTime);
+        animatingFrames += frame >= 10 && smoother.animating() ? 1 : 0;
+    }
+    REQUIRE(animatingFrames == 0);
+    REQUIRE_FALSE(smoother.animating());
+}
@@ -0,0 +1,121 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../../core/net/metrics-exporter.h"
+#include "test-helpers.h"
+#include <string>
+
+#ifndef _WIN32
+#include <netinet/in.h>
+#endif
+
+using namespace openmeters;
+using test::FakeMeterSource;
+
+namespace {
+
+common::EngineHealth fixedHealth() {
+    common::EngineHealth health;
+    health.packets = 42;
+    health.discontinuities = 3;
+    health.latencyCount = 2;
+    health.latencySumUs = 5000;
+    return health;
+}
+
+/**
+ * Send one request and return the whole response (the server closes after it).
+ */
+std::string httpRequest(std::uint16_t port, const std::string& request) {
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = htons(port);
+
+    const core::net::SocketHandle socket = ::socket(AF_INET, SOCK_STREAM, 0);
+    if (connect(socket, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0) {
+        core::net::closeSocket(socket);
+        return std::string();
+    }
+    send(socket, request.data(), static_cast<int>(request.size()), 0);
+
+    std::string response;
+    char chunk[1024];
+    for (;;) {
+        const auto n = recv(socket, chunk, static_cast<int>(sizeof(chunk)), 0);
+        if (n <= 0) {
+            break;
+        }
+        response.append(chunk, static_cast<std::size_t>(n));
+    }
+    core::net::closeSocket(socket);
+    return response;
+}
+
+bool contains(const std::string& text, const std::string& part) {
+    return text.find(part) != std::string::npos;
+}
+
+} // namespace
+
+TEST_CASE("Metrics exporter - serves text exposition", "[net]") {
+    FakeMeterSource source;
+    source.setHealth(fixedHealth());
+    common::MeterSnapshot snapshot;
+    snapshot.peak.left = 0.5f;
+    snapshot.rms.right = 0.25f;
+    source.publish(snapshot);
+
+    core::net::MetricsExporter exporter;
+    REQUIRE(exporter.addSource("main", &source));
+
+    common::MeterEvent clip;
+    clip.type = common::MeterEventType::Clip;
+    source.journal(clip);
+
+    core::net::MetricsExporterSettings settings;
+    settings.port = 0;
+    REQUIRE(exporter.start(settings));
+    REQUIRE(exporter.port() != 0);
+    REQUIRE(core::net::initializeSockets());
+
+    const std::string response = httpRequest(exporter.port(), "GET /metrics HTTP/1.1\r\nHost: localhost\r\n\r\n");
+    REQUIRE(contains(response, "HTTP/1.1 200 OK"));
+    REQUIRE(contains(response, "text/plain; version=0.0.4"));
+    REQUIRE(contains(response, "openmeters_peak_ratio{source=\"main\",channel=\"left\"} 0.5\n"));
+    REQUIRE(contains(response, "openmeters_rms_ratio{source=\"main\",channel=\"right\"} 0.25\n"));
+    REQUIRE(contains(response, "# TYPE openmeters_capture_packets_total counter\n"));
+    REQUIRE(contains(response, "openmeters_capture_packets_total{source=\"main\"} 42\n"));
+    REQUIRE(contains(response, "openmeters_capture_discontinuities_total{source=\"main\"} 3\n"));
+    REQUIRE(contains(response, "openmeters_callback_latency_seconds_sum{source=\"main\"} 0.005\n"));
+    REQUIRE(contains(response, "openmeters_events_total{source=\"main\",type=\"clip\"} 1\n"));
+    REQUIRE_FALSE(contains(response, "# EOF"));
+
+    core::net::shutdownSockets();
+    exporter.stop();
+    REQUIRE(exporter.scrapeCount() == 1);
+}
+
+TEST_CASE("Metrics exporter - OpenMetrics negotiation and errors", "[net]") {
+    FakeMeterSource source;
+    source.setHealth(fixedHealth());
+    core::net::MetricsExporter exporter;
+    REQUIRE(exporter.addSource("main", &source));
+
+    core::net::MetricsExporterSettings settings;
+    settings.port = 0;
+    REQUIRE(exporter.start(settings));
+    REQUIRE(core::net::initializeSockets());
+
+    const std::string openMetrics = httpRequest(
+        exporter.port(),
+        "GET /metrics HTTP/1.1\r\nAccept: application/openmetrics-text; version=1.0.0\r\n\r\n"
+    );
+    REQUIRE(contains(openMetrics, "application/openmetrics-text"));
+    REQUIRE(contains(openMetrics, "# TYPE openmeters_capture_packets counter\n"));
+    REQUIRE(contains(openMetrics, "# EOF\n"));
+
+    REQUIRE(contains(httpRequest(exporter.port(), "GET / HTTP/1.1\r\n\r\n"), "404 Not Found"));
+    REQUIRE(contains(httpRequest(exporter.port(), "POST /metrics HTTP/1.1\r\n\r\n"), "405 Method Not Allowed"));
+
+    core::net::shutdownSockets();
+    exporter.stop();
+}
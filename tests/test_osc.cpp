@@ -0,0 +1,137 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../../core/net/osc-sender.h"
+#include "test-helpers.h"
+#include <chrono>
+#include <string>
+#include <thread>
+
+#ifndef _WIN32
+#include <netinet/in.h>
+#endif
+
+using namespace openmeters;
+using test::FakeMeterSource;
+using core::net::OscEncoder;
+
+namespace {
+
+std::uint32_t readBe32(const std::uint8_t* in) {
+    return (std::uint32_t(in[0]) << 24) | (std::uint32_t(in[1]) << 16) | (std::uint32_t(in[2]) << 8) | in[3];
+}
+
+} // namespace
+
+TEST_CASE("OSC encoder - message layout", "[osc]") {
+    std::uint8_t buffer[64];
+    OscEncoder osc(buffer, sizeof(buffer));
+    osc.beginMessage("/a", ",if");
+    osc.addInt(7);
+    osc.addFloat(1.0f);
+    osc.endMessage();
+
+    REQUIRE_FALSE(osc.overflowed());
+    REQUIRE(osc.size() == 4 + 4 + 8);
+    REQUIRE(std::string(reinterpret_cast<const char*>(buffer)) == "/a");
+    REQUIRE(std::string(reinterpret_cast<const char*>(buffer + 4)) == ",if");
+    REQUIRE(readBe32(buffer + 8) == 7u);
+    REQUIRE(readBe32(buffer + 12) == 0x3F800000u);
+}
+
+TEST_CASE("OSC encoder - bundle element sizes and overflow", "[osc]") {
+    std::uint8_t buffer[48];
+    OscEncoder osc(buffer, sizeof(buffer));
+    osc.beginBundle();
+    osc.beginMessage("/level", ",f");
+    osc.addFloat(0.5f);
+    osc.endMessage();
+
+    REQUIRE(std::string(reinterpret_cast<const char*>(buffer)) == "#bundle");
+    REQUIRE(readBe32(buffer + 12) == 1u); // Immediate time tag
+    REQUIRE(readBe32(buffer + 16) == 16u);
+    REQUIRE(osc.size() == OscEncoder::kBundleHeaderSize + OscEncoder::messageSize(6, 2, 4));
+
+    osc.beginMessage("/level", ",f");
+    osc.addFloat(0.5f);
+    osc.endMessage();
+    REQUIRE(osc.overflowed());
+
+    osc.reset();
+    REQUIRE(osc.size() == 0);
+    REQUIRE_FALSE(osc.overflowed());
+}
+
+TEST_CASE("OSC sender - bundles levels over UDP", "[osc]") {
+    REQUIRE(core::net::initializeSockets());
+
+    // Receiver on an ephemeral loopback port
+    const auto receiver = ::socket(AF_INET, SOCK_DGRAM, 0);
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    REQUIRE(bind(receiver, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0);
+    socklen_t length = sizeof(address);
+    REQUIRE(getsockname(receiver, reinterpret_cast<sockaddr*>(&address), &length) == 0);
+    REQUIRE(core::net::setSocketTimeouts(receiver, 2000));
+
+    FakeMeterSource source;
+    common::MeterSnapshot snapshot;
+    snapshot.peak.left = 0.5f;
+    source.publish(snapshot);
+
+    core::net::OscSender sender;
+    REQUIRE(sender.addSource("main", &source));
+    core::net::OscSenderSettings settings;
+    settings.port = ntohs(address.sin_port);
+    settings.rateHz = 100.0f;
+    REQUIRE(sender.start(settings));
+
+    std::uint8_t datagram[1500];
+    const auto received = recv(receiver, reinterpret_cast<char*>(datagram), sizeof(datagram), 0);
+    REQUIRE(received > 0);
+    REQUIRE(std::string(reinterpret_cast<const char*>(datagram)) == "#bundle");
+    REQUIRE(std::string(reinterpret_cast<const char*>(datagram + 20)) == "/openmeters/main/levels");
+
+    sender.stop();
+    REQUIRE(sender.datagramsSent() >= 1);
+    core::net::closeSocket(receiver);
+    core::net::shutdownSockets();
+}
+
+TEST_CASE("OSC sender - waits for the first snapshot", "[osc]") {
+    REQUIRE(core::net::initializeSockets());
+
+    const auto receiver = ::socket(AF_INET, SOCK_DGRAM, 0);
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    REQUIRE(bind(receiver, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0);
+    socklen_t length = sizeof(address);
+    REQUIRE(getsockname(receiver, reinterpret_cast<sockaddr*>(&address), &length) == 0);
+    REQUIRE(core::net::setSocketTimeouts(receiver, 2000));
+
+    FakeMeterSource source;
+    core::net::OscSender sender;
+    REQUIRE(sender.addSource("main", &source));
+    core::net::OscSenderSettings settings;
+    settings.port = ntohs(address.sin_port);
+    settings.rateHz = 200.0f;
+    REQUIRE(sender.start(settings));
+
+    // Nothing published yet: no all-zero levels message
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    REQUIRE(sender.datagramsSent() == 0);
+
+    common::MeterSnapshot snapshot;
+    snapshot.peak.left = 0.5f;
+    source.publish(snapshot);
+
+    std::uint8_t datagram[1500];
+    const auto received = recv(receiver, reinterpret_cast<char*>(datagram), sizeof(datagram), 0);
+    REQUIRE(received > 0);
+    REQUIRE(std::string(reinterpret_cast<const char*>(datagram + 20)) == "/openmeters/main/levels");
+
+    sender.stop();
+    REQUIRE(sender.datagramsSent() == 1);
+    core::net::closeSocket(receiver);
+    core::net::shutdownSockets();
+}
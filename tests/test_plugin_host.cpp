@@ -0,0 +1,150 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../../core/plugins/plugin-host.h"
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+using namespace openmeters;
+using core::plugins::PluginHost;
+
+namespace {
+
+// Planar plugin: per-channel sum of squares over all blocks, using scratch
+struct EnergyState {
+    std::uint32_t channels;
+    double energy[8];
+};
+
+const om_output_field kEnergyOutputs[] = {
+    {"energy", "", 2},
+    {"scratch_ok", "", 1}
+};
+
+int energyInit(void* state, std::uint32_t, std::uint32_t channels) {
+    static_cast<EnergyState*>(state)->channels = channels;
+    return 0;
+}
+
+void energyProcess(void* state, const om_audio_block* block, void* scratch, std::size_t scratchSize, float* outputs) {
+    auto* s = static_cast<EnergyState*>(state);
+    auto* squares = static_cast<float*>(scratch);
+    const bool scratchOk = squares && scratchSize >= block->frame_count * sizeof(float) &&
+                           reinterpret_cast<std::uintptr_t>(scratch) % 64 == 0;
+    for (std::uint32_t ch = 0; ch < block->channel_count; ++ch) {
+        const float* samples = block->planar[ch];
+        for (std::uint32_t i = 0; i < block->frame_count; ++i) {
+            squares[i] = samples[i] * samples[i];
+            s->energy[ch] += squares[i];
+        }
+        outputs[ch] = static_cast<float>(s->energy[ch]);
+    }
+    outputs[2] = scratchOk ? 1.0f : 0.0f;
+}
+
+void energyReset(void* state) {
+    auto* s = static_cast<EnergyState*>(state);
+    s->energy[0] = s->energy[1] = 0.0;
+}
+
+om_meter_plugin makeEnergyPlugin() {
+    om_meter_plugin plugin{};
+    plugin.struct_size = sizeof(om_meter_plugin);
+    plugin.abi_version = OM_PLUGIN_ABI_VERSION;
+    plugin.id = "test.energy";
+    plugin.name = "Energy";
+    plugin.version = "1.0";
+    plugin.input_layout = OM_LAYOUT_PLANAR;
+    plugin.max_channels = 2;
+    plugin.state_size = sizeof(EnergyState);
+    plugin.state_alignment = alignof(EnergyState);
+    plugin.scratch_bytes_per_frame = sizeof(float);
+    plugin.output_field_count = 2;
+    plugin.output_fields = kEnergyOutputs;
+    plugin.init = energyInit;
+    plugin.process = energyProcess;
+    plugin.reset = energyReset;
+    return plugin;
+}
+
+// Interleaved plugin: reports the block pointer it saw (zero-copy check)
+const float* s_seenBuffer = nullptr;
+const om_output_field kFrameOutputs[] = {{"frames", "", 1}};
+
+int framesInit(void*, std::uint32_t, std::uint32_t) { return 0; }
+
+void framesProcess(void*, const om_audio_block* block, void*, std::size_t, float* outputs) {
+    s_seenBuffer = block->interleaved;
+    outputs[0] = static_cast<float>(block->frame_count);
+}
+
+om_meter_plugin makeFramesPlugin() {
+    om_meter_plugin plugin{};
+    plugin.struct_size = sizeof(om_meter_plugin);
+    plugin.abi_version = OM_PLUGIN_ABI_VERSION;
+    plugin.id = "test.frames";
+    plugin.name = "Frames";
+    plugin.version = "1.0";
+    plugin.input_layout = OM_LAYOUT_INTERLEAVED;
+    plugin.output_field_count = 1;
+    plugin.output_fields = kFrameOutputs;
+    plugin.init = framesInit;
+    plugin.process = framesProcess;
+    return plugin;
+}
+
+} // namespace
+
+TEST_CASE("Plugin host - planar and interleaved plugins", "[plugins]") {
+    static const om_meter_plugin energy = makeEnergyPlugin();
+    static const om_meter_plugin frames = makeFramesPlugin();
+
+    PluginHost host;
+    REQUIRE(host.addPlugin(&energy));
+    REQUIRE(host.addPlugin(&frames));
+    REQUIRE_FALSE(host.addPlugin(&energy)); // Duplicate id
+
+    common::AudioFormat format;
+    REQUIRE(host.prepare(format, 64));
+
+    // 100 frames: left 0.5, right 1.0 -> processed as 64 + 36
+    std::vector<float> buffer(200);
+    for (std::size_t i = 0; i < 100; ++i) {
+        buffer[i * 2] = 0.5f;
+        buffer[i * 2 + 1] = 1.0f;
+    }
+    host.process(buffer.data(), 100, format, 1000);
+
+    const auto energyOut = host.outputs(0);
+    REQUIRE(energyOut.valueCount == 3);
+    REQUIRE(std::fabs(energyOut.values[0] - 25.0f) < 1e-4f);
+    REQUIRE(std::fabs(energyOut.values[1] - 100.0f) < 1e-4f);
+    REQUIRE(energyOut.values[2] == 1.0f);
+    REQUIRE(energyOut.streamFrame == 1100);
+
+    // Interleaved plugins see the host buffer itself (last chunk starts at frame 64)
+    REQUIRE(s_seenBuffer == buffer.data() + 64 * 2);
+    REQUIRE(host.outputs(1).values[0] == 36.0f);
+
+    host.reset();
+    host.process(buffer.data(), 1, format, 1100);
+    REQUIRE(std::fabs(host.outputs(0).values[0] - 0.25f) < 1e-6f);
+}
+
+TEST_CASE("Plugin host - rejects incompatible plugins", "[plugins]") {
+    PluginHost host;
+
+    static om_meter_plugin wrongAbi = makeEnergyPlugin();
+    wrongAbi.abi_version = OM_PLUGIN_ABI_VERSION + 1;
+    REQUIRE_FALSE(host.addPlugin(&wrongAbi));
+
+    static om_meter_plugin noProcess = makeEnergyPlugin();
+    noProcess.process = nullptr;
+    REQUIRE_FALSE(host.addPlugin(&noProcess));
+
+    // Accepted, but disabled for a format it cannot handle
+    static om_meter_plugin fixedRate = makeEnergyPlugin();
+    fixedRate.required_sample_rate = 96000;
+    REQUIRE(host.addPlugin(&fixedRate));
+    REQUIRE(host.prepare(common::AudioFormat(), 256));
+    REQUIRE_FALSE(host.isEnabled(0));
+}
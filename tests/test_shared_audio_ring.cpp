@@ -0,0 +1,131 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../../core/ipc/audio-ring-writer.h"
+#include "../../core/ipc/audio-ring-reader.h"
+#include <vector>
+
+using namespace openmeters;
+
+namespace {
+
+common::AudioFormat stereoFormat() {
+    common::AudioFormat format;
+    format.sampleRate = 48000;
+    format.channelCount = 2;
+    return format;
+}
+
+} // namespace
+
+TEST_CASE("Shared audio ring - blocks reach readers in place", "[ipc]") {
+    const std::string name = "openmeters.test.audio";
+    core::ipc::AudioRingSettings settings;
+    settings.blockCount = 8;
+    settings.maxFramesPerBlock = 4;
+
+    core::ipc::AudioRingWriter writer;
+    REQUIRE(writer.open(name, settings));
+
+    core::ipc::AudioRingReader first;
+    core::ipc::AudioRingReader second;
+    REQUIRE(first.open(name));
+    REQUIRE(second.open(name));
+
+    auto firstCursor = first.tail();
+    auto secondCursor = second.tail();
+
+    const float samples[] = {0.1f, 0.2f, 0.3f, 0.4f, 0.5f, 0.6f};
+    writer.write(samples, 3, stereoFormat(), 100);
+
+    for (auto* reader : {&first, &second}) {
+        auto& cursor = reader == &first ? firstCursor : secondCursor;
+        core::ipc::AudioRingReader::AudioBlockView view;
+        REQUIRE(reader->next(cursor, view));
+        REQUIRE(view.streamFrame == 100);
+        REQUIRE(view.frameCount == 3);
+        REQUIRE(view.channelCount == 2);
+        REQUIRE(view.samples[5] == 0.6f);
+        REQUIRE(reader->isValid(view));
+        REQUIRE_FALSE(reader->next(cursor, view));
+    }
+}
+
+TEST_CASE("Shared audio ring - large buffers are split", "[ipc]") {
+    const std::string name = "openmeters.test.audio.split";
+    core::ipc::AudioRingSettings settings;
+    settings.blockCount = 8;
+    settings.maxFramesPerBlock = 4;
+
+    core::ipc::AudioRingWriter writer;
+    REQUIRE(writer.open(name, settings));
+    core::ipc::AudioRingReader reader;
+    REQUIRE(reader.open(name));
+    auto cursor = reader.tail();
+
+    std::vector<float> samples(2 * 10, 0.25f);
+    writer.write(samples.data(), 10, stereoFormat(), 0);
+
+    std::vector<float> out(8);
+    core::ipc::AudioRingReader::AudioBlockView info;
+    std::uint32_t frames = 0;
+    std::uint64_t expectedStart = 0;
+    while (reader.copyNext(cursor, out.data(), out.size(), info)) {
+        REQUIRE(info.streamFrame == expectedStart);
+        expectedStart += info.frameCount;
+        frames += info.frameCount;
+    }
+    REQUIRE(frames == 10);
+    REQUIRE(cursor.droppedBlocks == 0);
+}
+
+TEST_CASE("Shared audio ring - overruns are detected", "[ipc]") {
+    const std::string name = "openmeters.test.audio.overrun";
+    core::ipc::AudioRingSettings settings;
+    settings.blockCount = 4;
+    settings.maxFramesPerBlock = 2;
+
+    core::ipc::AudioRingWriter writer;
+    REQUIRE(writer.open(name, settings));
+    core::ipc::AudioRingReader reader;
+    REQUIRE(reader.open(name));
+    auto cursor = reader.tail();
+
+    const float samples[] = {0.1f, 0.1f, 0.2f, 0.2f};
+    for (std::uint64_t i = 0; i < 10; ++i) {
+        writer.write(samples, 2, stereoFormat(), i * 2);
+    }
+
+    core::ipc::AudioRingReader::AudioBlockView view;
+    REQUIRE(reader.next(cursor, view));
+    REQUIRE(cursor.droppedBlocks == 6);
+    REQUIRE(view.streamFrame == 12);
+}
+
+TEST_CASE("Shared audio ring - silence and gap flags reach readers", "[ipc]") {
+    const std::string name = "openmeters.test.audio.flags";
+    core::ipc::AudioRingSettings settings;
+    settings.blockCount = 8;
+    settings.maxFramesPerBlock = 2;
+
+    core::ipc::AudioRingWriter writer;
+    REQUIRE(writer.open(name, settings));
+    core::ipc::AudioRingReader reader;
+    REQUIRE(reader.open(name));
+    auto cursor = reader.tail();
+
+    const float samples[8] = {};
+    writer.write(samples, 2, stereoFormat(), 0);
+    writer.write(samples, 4, stereoFormat(), 2,
+                 core::ipc::kAudioBlockSilent | core::ipc::kAudioBlockDiscontinuity);
+
+    core::ipc::AudioRingReader::AudioBlockView view;
+    REQUIRE(reader.next(cursor, view));
+    REQUIRE(view.flags == 0);
+
+    // The gap precedes only the first block of a split buffer; silence covers all of it
+    REQUIRE(reader.next(cursor, view));
+    REQUIRE(view.flags == (core::ipc::kAudioBlockSilent | core::ipc::kAudioBlockDiscontinuity));
+    REQUIRE(reader.next(cursor, view));
+    REQUIRE(view.streamFrame == 4);
+    REQUIRE(view.flags == core::ipc::kAudioBlockSilent);
+    REQUIRE_FALSE(reader.next(cursor, view));
+}
@@ -0,0 +1,112 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../../common/seqlock.h"
+#include "../../core/ipc/snapshot-publisher.h"
+#include "../../core/ipc/snapshot-reader.h"
+
+using namespace openmeters;
+
+TEST_CASE("Seqlock cell - store and load", "[common][ipc]") {
+    common::SeqlockCell<common::MeterSnapshot> cell;
+    REQUIRE(cell.version() == 0);
+
+    common::MeterSnapshot snapshot;
+    snapshot.peak.left = 0.5f;
+    snapshot.rms.right = 0.25f;
+    snapshot.timestampMs = 1234;
+    cell.store(snapshot);
+
+    REQUIRE(cell.version() == 1);
+    const auto loaded = cell.load();
+    REQUIRE(loaded.peak.left == 0.5f);
+    REQUIRE(loaded.rms.right == 0.25f);
+    REQUIRE(loaded.timestampMs == 1234);
+}
+
+TEST_CASE("Shared snapshot region - publish and read", "[ipc]") {
+    const std::string name = "openmeters.test.snapshots";
+
+    core::ipc::SnapshotPublisher publisher;
+    REQUIRE(publisher.open(name));
+
+    core::ipc::SnapshotReader reader;
+    REQUIRE(reader.open(name));
+
+    core::ipc::SharedMeterSnapshot shared;
+    REQUIRE_FALSE(reader.read(shared)); // Nothing published yet
+
+    common::MeterSnapshot snapshot;
+    snapshot.peak.left = 0.75f;
+    snapshot.peak.right = 0.5f;
+    snapshot.rms.left = 0.3f;
+    snapshot.timestampMs = 42;
+
+    common::AudioFormat format;
+    format.sampleRate = 44100;
+    format.channelCount = 2;
+
+    publisher.publish(snapshot, format, 4800, 3);
+
+    REQUIRE(reader.publishCount() == 1);
+    REQUIRE(reader.read(shared));
+    REQUIRE(shared.peak[0] == 0.75f);
+    REQUIRE(shared.peak[1] == 0.5f);
+    REQUIRE(shared.rms[0] == 0.3f);
+    REQUIRE(shared.timestampMs == 42);
+    REQUIRE(shared.streamFrame == 4800);
+    REQUIRE(shared.eventCount == 3);
+    REQUIRE(shared.sampleRate == 44100);
+    REQUIRE(shared.channelCount == 2);
+}
+
+TEST_CASE("Shared snapshot region - reader stops once the writer closes", "[ipc]") {
+    const std::string name = "openmeters.test.snapshots.close";
+
+    core::ipc::SnapshotPublisher publisher;
+    REQUIRE(publisher.open(name));
+
+    core::ipc::SnapshotReader reader;
+    REQUIRE(reader.open(name));
+
+    common::MeterSnapshot snapshot;
+    snapshot.peak.left = 0.5f;
+    publisher.publish(snapshot, common::AudioFormat{}, 480, 1);
+
+    core::ipc::SharedMeterSnapshot shared;
+    REQUIRE(reader.read(shared));
+
+    // The reader keeps its mapping, but the cleared magic marks it dead
+    publisher.close();
+    REQUIRE_FALSE(reader.read(shared));
+}
+
+TEST_CASE("Shared memory region - one writer per name", "[ipc]") {
+    const std::string name = "openmeters.test.region.owner";
+
+    core::ipc::SharedMemoryRegion first;
+    REQUIRE(first.create(name, 4096));
+
+    core::ipc::SharedMemoryRegion second;
+    REQUIRE_FALSE(second.create(name, 4096));
+    REQUIRE_FALSE(second.isOpen());
+
+    // The failed attempt must not have removed the live writer's name
+    core::ipc::SharedMemoryRegion reader;
+    REQUIRE(reader.open(name, 4096));
+    reader.close();
+
+    first.close();
+    REQUIRE(second.create(name, 4096));
+
+#ifndef _WIN32
+    SECTION("A stale name without an owner is taken over") {
+        second.close();
+        const std::string platformName = "/" + name;
+        const int fd = shm_open(platformName.c_str(), O_CREAT | O_RDWR, 0600);
+        REQUIRE(fd >= 0);
+        ::close(fd);
+
+        core::ipc::SharedMemoryRegion writer;
+        REQUIRE(writer.create(name, 4096));
+    }
+#endif
+}
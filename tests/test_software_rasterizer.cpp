@@ -0,0 +1,210 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../../ui/frame-writer.h"
+#include "../../ui/meter-render.h"
+#include "../../ui/software-rasterizer.h"
+#include <chrono>
+#include <cstring>
+#include <vector>
+
+using namespace openmeters::ui;
+
+namespace {
+
+std::uint32_t readBigEndian(const std::uint8_t* p) {
+    return (static_cast<std::uint32_t>(p[0]) << 24) | (static_cast<std::uint32_t>(p[1]) << 16) |
+           (static_cast<std::uint32_t>(p[2]) << 8) | p[3];
+}
+
+std::uint32_t referenceCrc(const std::uint8_t* data, std::size_t size) {
+    std::uint32_t crc = 0xFFFFFFFFu;
+    for (std::size_t i = 0; i < size; ++i) {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+        }
+    }
+    return crc ^ 0xFFFFFFFFu;
+}
+
+std::size_t countPixels(const SoftwareRasterizer& frame, Rgba color) {
+    std::size_t count = 0;
+    for (int y = 0; y < frame.height(); ++y) {
+        for (int x = 0; x < frame.width(); ++x) {
+            count += frame.pixel(x, y) == color ? 1 : 0;
+        }
+    }
+    return count;
+}
+
+} // namespace
+
+TEST_CASE("Software rasterizer - rects cover pixel centers", "[raster]") {
+    SoftwareRasterizer frame(16, 8);
+    REQUIRE(frame.byteSize() == 16 * 8 * 4);
+    REQUIRE(frame.pixel(0, 0) == 0);
+
+    const Rgba red = packRgba(255, 0, 0);
+    frame.fillRect(RectF{2.0f, 1.0f, 6.0f, 4.0f}, red);
+    REQUIRE(countPixels(frame, red) == 4 * 3);
+    REQUIRE(frame.pixel(2, 1) == red);
+    REQUIRE(frame.pixel(5, 3) == red);
+    REQUIRE(frame.pixel(6, 3) == 0);
+    REQUIRE(frame.pixel(1, 1) == 0);
+
+    SECTION("Shapes are clipped to the buffer") {
+        frame.fillRect(RectF{-10.0f, -10.0f, 100.0f, 100.0f}, red);
+        REQUIRE(countPixels(frame, red) == 16 * 8);
+    }
+
+    SECTION("Rounded corners leave the corner pixels alone") {
+        frame.clear(0);
+        frame.fillRect(RectF{0.0f, 0.0f, 16.0f, 8.0f}, red, 4.0f);
+        REQUIRE(frame.pixel(0, 0) == 0);
+        REQUIRE(frame.pixel(15, 7) == 0);
+        REQUIRE(frame.pixel(0, 4) == red);
+        REQUIRE(frame.pixel(8, 0) == red);
+    }
+}
+
+TEST_CASE("Software rasterizer - translucent colors blend source-over", "[raster]") {
+    // Wide enough that both the four-pixel and the scalar path run
+    SoftwareRasterizer frame(7, 1);
+    frame.clear(packRgba(0, 0, 255));
+    frame.fillRect(RectF{0.0f, 0.0f, 7.0f, 1.0f}, packRgba(255, 0, 0, 128));
+
+    const Rgba expected = packRgba(128, 0, 127);
+    for (int x = 0; x < 7; ++x) {
+        REQUIRE(frame.pixel(x, 0) == expected);
+    }
+
+    SECTION("Coverage accumulates in alpha") {
+        frame.clear(0);
+        frame.fillRect(RectF{0.0f, 0.0f, 7.0f, 1.0f}, packRgba(255, 255, 255, 128));
+        REQUIRE((frame.pixel(0, 0) >> 24) == 128);
+        REQUIRE((frame.pixel(6, 0) >> 24) == 128);
+    }
+
+    SECTION("Transparent commands draw nothing") {
+        frame.fillRect(RectF{0.0f, 0.0f, 7.0f, 1.0f}, packRgba(255, 255, 255, 0));
+        REQUIRE(frame.pixel(3, 0) == expected);
+    }
+}
+
+TEST_CASE("Software rasterizer - lines and text", "[raster]") {
+    SoftwareRasterizer frame(32, 16);
+    const Rgba white = packRgba(255, 255, 255);
+
+    SECTION("Horizontal line is one pixel thick") {
+        frame.drawLine(0.0f, 4.0f, 32.0f, 4.0f, white);
+        REQUIRE(countPixels(frame, white) == 32);
+        REQUIRE(frame.pixel(10, 3) == white);
+    }
+
+    SECTION("Diagonal line touches every row") {
+        frame.drawLine(0.0f, 0.0f, 16.0f, 16.0f, white);
+        for (int y = 0; y < 16; ++y) {
+            REQUIRE(frame.pixel(y, y) == white);
+        }
+        REQUIRE(frame.pixel(15, 0) == 0);
+    }
+
+    SECTION("Text draws glyph pixels inside its advance") {
+        frame.drawText(1.0f, 0.0f, "L", white, 9.0f);
+        // 'L': left column full height, bottom row full width
+        REQUIRE(frame.pixel(1, 1) == white);
+        REQUIRE(frame.pixel(1, 7) == white);
+        REQUIRE(frame.pixel(5, 7) == white);
+        REQUIRE(frame.pixel(5, 1) == 0);
+        REQUIRE(countPixels(frame, white) == 7 + 4);
+        REQUIRE(SoftwareRasterizer::textWidth("LL", 9.0f) == 12.0f);
+        REQUIRE(SoftwareRasterizer::textWidth("LL", 18.0f) == 24.0f);
+    }
+}
+
+TEST_CASE("Software rasterizer - meter panel lights segments in zone colors", "[raster]") {
+    MeterRenderStyle style;
+    MeterView view;
+    view.snapshot.peak = {1.0f, 1.0f};
+    view.snapshot.rms = {0.0f, 0.0f};
+    view.clipLit = true;
+
+    DisplayList list;
+    const float height = buildMeterDisplayList(view, style, 300.0f, list);
+    SoftwareRasterizer frame(300, static_cast<int>(height) + 1);
+    frame.render(list);
+
+    REQUIRE(countPixels(frame, style.greenColor) > 0);
+    REQUIRE(countPixels(frame, style.yellowColor) > 0);
+    REQUIRE(countPixels(frame, style.redColor) + countPixels(frame, style.clipColor) > 0);
+
+    SECTION("Silence shows no lit segments") {
+        view.snapshot.peak = {0.0f, 0.0f};
+        view.clipLit = false;
+        buildMeterDisplayList(view, style, 300.0f, list);
+        frame.clear(0);
+        frame.render(list);
+        REQUIRE(countPixels(frame, style.greenColor) == 0);
+        REQUIRE(countPixels(frame, style.yellowColor) == 0);
+        REQUIRE(countPixels(frame, style.textColor) > 0);
+    }
+}
+
+TEST_CASE("Frame writer - PNG chunks are well formed", "[raster]") {
+    SoftwareRasterizer frame(20, 10);
+    frame.clear(packRgba(10, 20, 30, 40));
+
+    std::vector<std::uint8_t> png;
+    encodePng(frame.pixels(), frame.width(), frame.height(), png);
+
+    const std::uint8_t signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    REQUIRE(png.size() > sizeof(signature));
+    REQUIRE(std::memcmp(png.data(), signature, sizeof(signature)) == 0);
+
+    // Walk the chunks: every CRC matches, IHDR first, IEND last
+    std::size_t offset = sizeof(signature);
+    std::vector<std::string> types;
+    std::size_t idatBytes = 0;
+    while (offset + 12 <= png.size()) {
+        const std::uint32_t length = readBigEndian(&png[offset]);
+        REQUIRE(offset + 12 + length <= png.size());
+        const std::string type(reinterpret_cast<const char*>(&png[offset + 4]), 4);
+        REQUIRE(referenceCrc(&png[offset + 4], length + 4) == readBigEndian(&png[offset + 8 + length]));
+        if (type == "IHDR") {
+            REQUIRE(readBigEndian(&png[offset + 8]) == 20);
+            REQUIRE(readBigEndian(&png[offset + 12]) == 10);
+        } else if (type == "IDAT") {
+            idatBytes += length;
+        }
+        types.push_back(type);
+        offset += 12 + length;
+    }
+    REQUIRE(offset == png.size());
+    REQUIRE(types.front() == "IHDR");
+    REQUIRE(types.back() == "IEND");
+
+    // Stored blocks: at least the filtered scanlines plus zlib framing
+    REQUIRE(idatBytes >= static_cast<std::size_t>(10 * (20 * 4 + 1)) + 2 + 5 + 4);
+}
+
+TEST_CASE("Software rasterizer - meter bridge draws well within a frame budget", "[raster]") {
+    MeterRenderStyle style;
+    std::vector<MeterView> views(8);
+    DisplayList list;
+    SoftwareRasterizer frame(1280, 200);
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < 60; ++i) {
+        for (std::size_t p = 0; p < views.size(); ++p) {
+            const float level = static_cast<float>((i + static_cast<int>(p) * 7) % 60) / 60.0f;
+            views[p].snapshot.peak = {level, level};
+            views[p].snapshot.rms = {level * 0.5f, level * 0.5f};
+        }
+        buildMeterBridge(views, style, 150.0f, 8.0f, list);
+        frame.clear(packRgba(31, 31, 31, 217));
+        frame.render(list, 8.0f, 8.0f);
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    // One second of 60 fps output; loose enough for debug builds and slow CI
+    REQUIRE(elapsed < std::chrono::seconds(1));
+}
@@ -0,0 +1,88 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../../common/startup-orchestrator.h"
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+using namespace openmeters::common;
+
+namespace {
+
+bool sleepFor(int ms) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+    return true;
+}
+
+} // namespace
+
+TEST_CASE("Startup - independent phases overlap", "[startup]") {
+    StartupOrchestrator startup;
+    const auto config = startup.addPhase("config", [] { return sleepFor(10); });
+    const auto window = startup.addPhase("window", [] { return sleepFor(100); }, {config}, PhaseAffinity::Caller);
+    const auto audio = startup.addPhase("audio", [] { return sleepFor(100); }, {config});
+
+    REQUIRE(startup.run());
+    REQUIRE(startup.succeeded(window));
+    REQUIRE(startup.succeeded(audio));
+
+    // Both follow config, and run side by side rather than one after the other
+    REQUIRE(startup.result(window).startMs >= startup.result(config).durationMs);
+    REQUIRE(startup.result(audio).startMs >= startup.result(config).durationMs);
+
+    // Overlap from the recorded timings, so a loaded machine cannot fail it:
+    // each phase starts before the other one ends
+    const StartupPhaseResult& windowResult = startup.result(window);
+    const StartupPhaseResult& audioResult = startup.result(audio);
+    REQUIRE(audioResult.startMs < windowResult.startMs + windowResult.durationMs);
+    REQUIRE(windowResult.startMs < audioResult.startMs + audioResult.durationMs);
+}
+
+TEST_CASE("Startup - dependencies order phases and failures skip dependents", "[startup]") {
+    StartupOrchestrator startup;
+    std::atomic<int> order{0};
+    int configAt = -1;
+    int audioAt = -1;
+    bool captureRan = false;
+    std::thread::id windowThread;
+
+    const auto config = startup.addPhase("config", [&] { configAt = order++; return true; });
+    const auto window = startup.addPhase("window", [&] {
+        windowThread = std::this_thread::get_id();
+        return true;
+    }, {config}, PhaseAffinity::Caller);
+    const auto audio = startup.addPhase("audio", [&] { audioAt = order++; return false; }, {config});
+    const auto capture = startup.addPhase("capture", [&] { captureRan = true; return true; },
+                                          {window, audio}, PhaseAffinity::Caller);
+    const auto broken = startup.addPhase("broken", []() -> bool { throw std::runtime_error("no device"); });
+
+    REQUIRE_FALSE(startup.run());
+    REQUIRE(configAt == 0);
+    REQUIRE(audioAt == 1);
+    REQUIRE(windowThread == std::this_thread::get_id());
+    REQUIRE(startup.succeeded(window));
+
+    REQUIRE_FALSE(startup.succeeded(audio));
+    REQUIRE_FALSE(startup.result(audio).skipped);
+    REQUIRE_FALSE(captureRan);
+    REQUIRE(startup.result(capture).skipped);
+    REQUIRE_FALSE(startup.succeeded(broken));
+    REQUIRE(startup.results().size() == 5);
+}
+
+TEST_CASE("Startup - scheduling overhead stays small", "[startup]") {
+    // Regression guard for the startup path itself: many trivial phases in a
+    // chain and a fan-out. The bound only catches pathological scheduling
+    // (e.g. a sleep or timeout per phase) and leaves room for slow CI
+    StartupOrchestrator startup;
+    StartupOrchestrator::PhaseId previous = startup.addPhase("root", [] { return true; });
+    for (int i = 0; i < 50; ++i) {
+        previous = startup.addPhase("chain", [] { return true; }, {previous}, PhaseAffinity::Caller);
+    }
+    for (int i = 0; i < 50; ++i) {
+        startup.addPhase("fan-out", [] { return true; }, {previous});
+    }
+
+    REQUIRE(startup.run());
+    REQUIRE(startup.totalMs() < 2000.0);
+}
@@ -0,0 +1,195 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../../core/net/stream-server.h"
+#include "test-helpers.h"
+#include <chrono>
+#include <filesystem>
+#include <limits>
+#include <thread>
+
+#ifdef _WIN32
+#include <afunix.h>
+#else
+#include <sys/un.h>
+#endif
+
+using namespace openmeters;
+using test::FakeMeterSource;
+using test::receiveExactly;
+namespace stream = core::net::stream;
+
+namespace {
+
+core::net::SocketHandle connectTo(const std::string& path) {
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    std::copy(path.begin(), path.end(), address.sun_path);
+
+    const core::net::SocketHandle socket = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (connect(socket, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0) {
+        core::net::closeSocket(socket);
+        return core::net::kInvalidSocket;
+    }
+    return socket;
+}
+
+} // namespace
+
+TEST_CASE("Stream protocol - subscribe round trip", "[net]") {
+    stream::Subscribe subscribe;
+    subscribe.sourceMask = 3;
+    subscribe.meterMask = stream::kMeterPeak | stream::kMeterEvents;
+    subscribe.rateHz = 60.0f;
+
+    std::uint8_t frame[stream::kHeaderSize + stream::kSubscribeSize];
+    REQUIRE(stream::encodeSubscribe(frame, subscribe) == sizeof(frame));
+
+    stream::FrameType type;
+    std::uint32_t length = 0;
+    REQUIRE(stream::readHeader(frame, type, length));
+    REQUIRE(type == stream::FrameType::Subscribe);
+
+    stream::Subscribe decoded;
+    REQUIRE(stream::decodeSubscribe(frame + stream::kHeaderSize, length, decoded));
+    REQUIRE(decoded.sourceMask == 3);
+    REQUIRE(decoded.meterMask == subscribe.meterMask);
+    REQUIRE(decoded.rateHz == 60.0f);
+}
+
+TEST_CASE("Stream protocol - non-finite rates are rejected", "[net]") {
+    stream::Subscribe subscribe;
+    std::uint8_t frame[stream::kHeaderSize + stream::kSubscribeSize];
+    stream::Subscribe decoded;
+
+    subscribe.rateHz = std::numeric_limits<float>::quiet_NaN();
+    stream::encodeSubscribe(frame, subscribe);
+    REQUIRE_FALSE(stream::decodeSubscribe(frame + stream::kHeaderSize, stream::kSubscribeSize, decoded));
+
+    subscribe.rateHz = std::numeric_limits<float>::infinity();
+    stream::encodeSubscribe(frame, subscribe);
+    REQUIRE_FALSE(stream::decodeSubscribe(frame + stream::kHeaderSize, stream::kSubscribeSize, decoded));
+}
+
+TEST_CASE("Stream protocol - snapshot carries only selected meters", "[net]") {
+    common::MeterSnapshot snapshot;
+    snapshot.peak.left = 0.5f;
+    snapshot.rms.right = 0.25f;
+
+    std::uint8_t frame[stream::kHeaderSize + stream::kMaxSnapshotSize];
+    REQUIRE(stream::encodeSnapshot(frame, 0, stream::kMeterRms, snapshot) == stream::kHeaderSize + 24);
+    REQUIRE(stream::getF32(frame + stream::kHeaderSize + 20) == 0.25f);
+    REQUIRE(stream::encodeSnapshot(frame, 0, stream::kMeterPeak | stream::kMeterRms, snapshot) == sizeof(frame));
+}
+
+TEST_CASE("Stream server - subscriber receives snapshots", "[net]") {
+    FakeMeterSource source;
+    core::net::StreamServer server;
+    REQUIRE(server.addSource(0, &source));
+
+    core::net::StreamServerSettings settings;
+    settings.socketPath = core::net::defaultStreamSocketPath() + ".test";
+    REQUIRE(server.start(settings));
+
+    REQUIRE(core::net::initializeSockets());
+    const auto client = connectTo(settings.socketPath);
+    REQUIRE(client != core::net::kInvalidSocket);
+
+    std::uint8_t hello[stream::kHeaderSize + stream::kHelloSize];
+    REQUIRE(receiveExactly(client, hello, sizeof(hello)));
+    REQUIRE(hello[3] == static_cast<std::uint8_t>(stream::FrameType::Hello));
+    REQUIRE(stream::get32(hello + 12) == 1u);
+
+    common::MeterSnapshot snapshot;
+    snapshot.peak.left = 0.75f;
+    snapshot.timestampMs = 99;
+    source.publish(snapshot);
+
+    stream::Subscribe subscribe;
+    subscribe.meterMask = stream::kMeterPeak;
+    subscribe.rateHz = 100.0f;
+    std::uint8_t request[stream::kHeaderSize + stream::kSubscribeSize];
+    const std::size_t requestSize = stream::encodeSubscribe(request, subscribe);
+    REQUIRE(send(client, reinterpret_cast<const char*>(request), static_cast<int>(requestSize), 0) ==
+            static_cast<long>(requestSize));
+
+    std::uint8_t frame[stream::kHeaderSize + 24];
+    REQUIRE(receiveExactly(client, frame, sizeof(frame)));
+    REQUIRE(frame[3] == static_cast<std::uint8_t>(stream::FrameType::Snapshot));
+    REQUIRE(stream::get64(frame + stream::kHeaderSize + 8) == 99);
+    REQUIRE(stream::getF32(frame + stream::kHeaderSize + 16) == 0.75f);
+
+    core::net::closeSocket(client);
+    core::net::shutdownSockets();
+    server.stop();
+    REQUIRE(server.clientCount() == 0);
+}
+
+TEST_CASE("Stream server - a NaN rate disconnects the client", "[net]") {
+    FakeMeterSource source;
+    core::net::StreamServer server;
+    REQUIRE(server.addSource(0, &source));
+
+    core::net::StreamServerSettings settings;
+    settings.socketPath = core::net::defaultStreamSocketPath() + ".nan";
+    REQUIRE(server.start(settings));
+
+    REQUIRE(core::net::initializeSockets());
+    const auto client = connectTo(settings.socketPath);
+    REQUIRE(client != core::net::kInvalidSocket);
+    REQUIRE(core::net::setSocketTimeouts(client, 2000));
+
+    std::uint8_t hello[stream::kHeaderSize + stream::kHelloSize];
+    REQUIRE(receiveExactly(client, hello, sizeof(hello)));
+
+    stream::Subscribe subscribe;
+    subscribe.rateHz = std::numeric_limits<float>::quiet_NaN();
+    std::uint8_t request[stream::kHeaderSize + stream::kSubscribeSize];
+    const std::size_t requestSize = stream::encodeSubscribe(request, subscribe);
+    REQUIRE(send(client, reinterpret_cast<const char*>(request), static_cast<int>(requestSize), 0) ==
+            static_cast<long>(requestSize));
+
+    // The server closes the connection instead of scheduling frames
+    std::uint8_t byte = 0;
+    REQUIRE(recv(client, reinterpret_cast<char*>(&byte), 1, 0) == 0);
+
+    core::net::closeSocket(client);
+    core::net::shutdownSockets();
+    server.stop();
+}
+
+TEST_CASE("Stream server - a second server does not take a live socket path", "[net]") {
+    FakeMeterSource source;
+    core::net::StreamServerSettings settings;
+    settings.socketPath = core::net::defaultStreamSocketPath() + ".owner";
+
+    core::net::StreamServer first;
+    REQUIRE(first.addSource(0, &source));
+    REQUIRE(first.start(settings));
+
+    core::net::StreamServer second;
+    REQUIRE(second.addSource(0, &source));
+    REQUIRE_FALSE(second.start(settings));
+
+    // The first server still answers on its path
+    REQUIRE(core::net::initializeSockets());
+    const auto client = connectTo(settings.socketPath);
+    REQUIRE(client != core::net::kInvalidSocket);
+    std::uint8_t hello[stream::kHeaderSize + stream::kHelloSize];
+    REQUIRE(receiveExactly(client, hello, sizeof(hello)));
+    core::net::closeSocket(client);
+    first.stop();
+
+    SECTION("A stale socket file is replaced") {
+        // A socket bound and closed without unlinking, as after a crash
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        std::copy(settings.socketPath.begin(), settings.socketPath.end(), address.sun_path);
+        const core::net::SocketHandle stale = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        REQUIRE(bind(stale, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0);
+        core::net::closeSocket(stale);
+        REQUIRE(std::filesystem::exists(settings.socketPath));
+
+        REQUIRE(second.start(settings));
+        second.stop();
+    }
+    core::net::shutdownSockets();
+}
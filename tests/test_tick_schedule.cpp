@@ -0,0 +1,23 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../../core/net/tick-schedule.h"
+
+using namespace openmeters::core::net;
+using namespace std::chrono_literals;
+
+TEST_CASE("Tick schedule - fixed cadence without catch-up bursts", "[net]") {
+    const auto start = TickSchedule::Clock::time_point{} + 10s;
+    TickSchedule schedule(100.0, start);
+    REQUIRE(schedule.next() == start);
+    REQUIRE(schedule.due(start));
+
+    // On time: the next tick keeps the 10 ms grid even if this one ran a bit late
+    schedule.advance(start + 2ms);
+    REQUIRE(schedule.next() == start + 10ms);
+    REQUIRE_FALSE(schedule.due(start + 9ms));
+    REQUIRE(schedule.due(start + 10ms));
+
+    // A long stall skips the missed ticks and resumes one period later
+    schedule.advance(start + 55ms);
+    REQUIRE(schedule.next() == start + 65ms);
+    REQUIRE_FALSE(schedule.due(start + 60ms));
+}
@@ -0,0 +1,198 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../../core/net/websocket-server.h"
+#include "test-helpers.h"
+#include <chrono>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <netinet/in.h>
+#endif
+
+using namespace openmeters;
+using test::FakeMeterSource;
+using test::receiveExactly;
+namespace dashboard = core::net::dashboard;
+namespace websocket = core::net::websocket;
+
+namespace {
+
+/**
+ * Read one unmasked server frame and return its payload.
+ */
+std::vector<std::uint8_t> receiveMessage(core::net::SocketHandle socket) {
+    std::uint8_t header[2];
+    if (!receiveExactly(socket, header, 2)) {
+        return {};
+    }
+    std::size_t length = header[1] & 0x7F;
+    if (length == 126) {
+        std::uint8_t extended[2];
+        receiveExactly(socket, extended, 2);
+        length = (std::size_t(extended[0]) << 8) | extended[1];
+    }
+    std::vector<std::uint8_t> payload(length);
+    receiveExactly(socket, payload.data(), length);
+    return payload;
+}
+
+void sendAck(core::net::SocketHandle socket, std::uint32_t tick) {
+    const std::uint8_t mask[4] = {0x12, 0x34, 0x56, 0x78};
+    std::uint8_t frame[2 + 4 + dashboard::kAckSize] = {0x82, 0x80 | dashboard::kAckSize};
+    std::copy(mask, mask + 4, frame + 2);
+    std::uint8_t ack[dashboard::kAckSize] = {static_cast<std::uint8_t>(dashboard::ClientMessageType::Ack)};
+    core::net::stream::put32(ack + 1, tick);
+    for (std::size_t i = 0; i < dashboard::kAckSize; ++i) {
+        frame[6 + i] = ack[i] ^ mask[i & 3];
+    }
+    send(socket, reinterpret_cast<const char*>(frame), sizeof(frame), 0);
+}
+
+} // namespace
+
+TEST_CASE("WebSocket - accept key matches RFC 6455 example", "[websocket]") {
+    REQUIRE(websocket::acceptKey("dGhlIHNhbXBsZSBub25jZQ==") == "s3pPLMBiTxaQ9kYGzzhZRbK+xOo=");
+}
+
+TEST_CASE("Dashboard protocol - delta carries only changed fields", "[websocket]") {
+    std::int16_t base[8] = {-60, -60, -120, -120, -1200, -1200, -1200, -1200};
+    std::int16_t current[8] = {-60, -55, -120, -120, -1200, -1200, -1200, -10};
+
+    std::uint8_t message[dashboard::kUpdateHeaderSize + 2 * dashboard::kMaxRecordSize];
+    const std::size_t length = dashboard::encodeUpdate(message, 7, 6, current, base, 2);
+    REQUIRE(length == dashboard::kUpdateHeaderSize + 2 * (3 + 2));
+
+    std::int16_t decoded[8];
+    std::copy(base, base + 8, decoded);
+    std::uint32_t tick = 0;
+    REQUIRE(dashboard::applyUpdate(message, length, decoded, 2, tick));
+    REQUIRE(tick == 7);
+    REQUIRE(std::equal(decoded, decoded + 8, current));
+
+    // Keyframe against the floor state
+    const std::size_t keyLength = dashboard::encodeUpdate(message, 7, dashboard::kNoBase, current, nullptr, 2);
+    std::fill(decoded, decoded + 8, std::int16_t(0));
+    REQUIRE(dashboard::applyUpdate(message, keyLength, decoded, 2, tick));
+    REQUIRE(std::equal(decoded, decoded + 8, current));
+
+    REQUIRE(dashboard::quantize(1.0f) == 0);
+    REQUIRE(dashboard::quantize(0.5f) == -60);
+    REQUIRE(dashboard::quantize(0.0f) == dashboard::kFloor);
+}
+
+TEST_CASE("WebSocket server - handshake, keyframe and acked delta", "[websocket]") {
+    FakeMeterSource source;
+    common::MeterSnapshot snapshot;
+    snapshot.peak.left = 0.5f;
+    source.publish(snapshot);
+
+    core::net::WebSocketServer server;
+    REQUIRE(server.addSource("main", &source));
+    core::net::WebSocketServerSettings settings;
+    settings.port = 0;
+    settings.tickRateHz = 100.0f;
+    REQUIRE(server.start(settings));
+    REQUIRE(core::net::initializeSockets());
+
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = htons(server.port());
+    const auto client = ::socket(AF_INET, SOCK_STREAM, 0);
+    REQUIRE(connect(client, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0);
+    REQUIRE(core::net::setSocketTimeouts(client, 2000));
+
+    const std::string request =
+        "GET /meters HTTP/1.1\r\nHost: localhost\r\nUpgrade: websocket\r\nConnection: Upgrade\r\n"
+        "Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\nSec-WebSocket-Version: 13\r\n\r\n";
+    send(client, request.data(), static_cast<int>(request.size()), 0);
+
+    std::string response;
+    std::uint8_t byte = 0;
+    while (response.find("\r\n\r\n") == std::string::npos && receiveExactly(client, &byte, 1)) {
+        response += static_cast<char>(byte);
+    }
+    REQUIRE(response.find("101 Switching Protocols") != std::string::npos);
+    REQUIRE(response.find("s3pPLMBiTxaQ9kYGzzhZRbK+xOo=") != std::string::npos);
+
+    const auto hello = receiveMessage(client);
+    REQUIRE(hello.size() == 8 + 1 + 4);
+    REQUIRE(hello[0] == static_cast<std::uint8_t>(dashboard::MessageType::Hello));
+    REQUIRE(core::net::stream::get16(hello.data() + 4) == 1);
+
+    // First update is a keyframe
+    std::int16_t state[dashboard::kFieldsPerSource];
+    std::uint32_t tick = 0;
+    const auto key = receiveMessage(client);
+    REQUIRE(core::net::stream::get32(key.data() + 5) == dashboard::kNoBase);
+    REQUIRE(dashboard::applyUpdate(key.data(), key.size(), state, 1, tick));
+    REQUIRE(state[0] == -60);
+    sendAck(client, tick);
+
+    // After the ack, only the changed field arrives, relative to the acked tick
+    snapshot.rms.right = 0.5f;
+    source.publish(snapshot);
+    std::vector<std::uint8_t> delta;
+    do {
+        delta = receiveMessage(client);
+        REQUIRE(!delta.empty());
+    } while (core::net::stream::get32(delta.data() + 5) != tick);
+    REQUIRE(delta.size() == dashboard::kUpdateHeaderSize + 3 + 2);
+    REQUIRE(delta[dashboard::kUpdateHeaderSize + 2] == 0x8);
+
+    core::net::closeSocket(client);
+    core::net::shutdownSockets();
+    server.stop();
+}
+
+TEST_CASE("WebSocket server - keyframes to a client without acks are rate limited", "[websocket]") {
+    FakeMeterSource source;
+    common::MeterSnapshot snapshot;
+    snapshot.peak.left = 0.5f;
+    source.publish(snapshot);
+
+    core::net::WebSocketServer server;
+    REQUIRE(server.addSource("main", &source));
+    core::net::WebSocketServerSettings settings;
+    settings.port = 0;
+    settings.tickRateHz = 100.0f;
+    settings.keyframeIntervalMs = 200;
+    REQUIRE(server.start(settings));
+    REQUIRE(core::net::initializeSockets());
+
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = htons(server.port());
+    const auto client = ::socket(AF_INET, SOCK_STREAM, 0);
+    REQUIRE(connect(client, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0);
+    REQUIRE(core::net::setSocketTimeouts(client, 2000));
+
+    const std::string request =
+        "GET /meters HTTP/1.1\r\nHost: localhost\r\nUpgrade: websocket\r\nConnection: Upgrade\r\n"
+        "Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\nSec-WebSocket-Version: 13\r\n\r\n";
+    send(client, request.data(), static_cast<int>(request.size()), 0);
+    std::string response;
+    std::uint8_t byte = 0;
+    while (response.find("\r\n\r\n") == std::string::npos && receiveExactly(client, &byte, 1)) {
+        response += static_cast<char>(byte);
+    }
+    REQUIRE(!receiveMessage(client).empty()); // Hello
+
+    // Never acknowledging: about one keyframe per interval, not one per tick
+    const auto start = std::chrono::steady_clock::now();
+    int keyframes = 0;
+    while (std::chrono::steady_clock::now() - start < std::chrono::milliseconds(500)) {
+        const auto update = receiveMessage(client);
+        REQUIRE(!update.empty());
+        REQUIRE(core::net::stream::get32(update.data() + 5) == dashboard::kNoBase);
+        ++keyframes;
+    }
+    REQUIRE(keyframes >= 2);
+    REQUIRE(keyframes <= 5);
+
+    core::net::closeSocket(client);
+    core::net::shutdownSockets();
+    server.stop();
+    REQUIRE(server.droppedClients() == 0);
+}
@@ -0,0 +1,84 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../../common/wire-format.h"
+
+using namespace openmeters::common;
+
+TEST_CASE("Wire format - snapshot round trip in place", "[wire]") {
+    MeterSnapshot snapshot;
+    snapshot.peak.left = 0.5f;
+    snapshot.peak.right = 0.25f;
+    snapshot.rms.left = 0.125f;
+    snapshot.timestampMs = 1234;
+    AudioFormat format;
+    format.sampleRate = 44100;
+
+    alignas(8) std::uint8_t buffer[wire::maxSnapshotSize()];
+    const std::size_t size = wire::encodeSnapshot(buffer, sizeof(buffer), snapshot, format, 96000);
+    REQUIRE(size > 0);
+    REQUIRE(size <= sizeof(buffer));
+    REQUIRE(size % 8 == 0);
+
+    wire::Reader reader;
+    REQUIRE(reader.open(buffer, size));
+    REQUIRE(reader.u64(wire::Field::TimestampMs) == 1234);
+    REQUIRE(reader.u64(wire::Field::StreamFrame) == 96000);
+    REQUIRE(reader.u32(wire::Field::SampleRate) == 44100);
+
+    const auto peak = reader.array<float>(wire::Field::Peak);
+    REQUIRE(peak.count == 2);
+    REQUIRE(peak[0] == 0.5f);
+    REQUIRE(peak[1] == 0.25f);
+    REQUIRE(reader.array<float>(wire::Field::Rms)[0] == 0.125f);
+}
+
+TEST_CASE("Wire format - optional fields default when absent", "[wire]") {
+    alignas(8) std::uint8_t buffer[wire::maxSnapshotSize()];
+    const std::size_t size = wire::encodeSnapshot(buffer, sizeof(buffer), MeterSnapshot(), AudioFormat());
+
+    wire::Reader reader;
+    REQUIRE(reader.open(buffer, size));
+    REQUIRE_FALSE(reader.has(wire::Field::StreamFrame));
+    REQUIRE(reader.u64(wire::Field::StreamFrame, 7) == 7);
+    REQUIRE(reader.array<float>(wire::Field::Spectrum).empty());
+}
+
+TEST_CASE("Wire format - readers skip fields they do not know", "[wire]") {
+    // A newer writer with two extra slots
+    alignas(8) std::uint8_t buffer[256];
+    const auto newerLength = static_cast<std::uint16_t>(static_cast<std::uint16_t>(wire::Field::Count) + 2);
+    wire::Writer writer(buffer, sizeof(buffer), newerLength);
+    writer.putU64(static_cast<wire::Field>(newerLength - 1), 99);
+    writer.putU32(wire::Field::SampleRate, 48000);
+    const std::size_t size = writer.finish();
+
+    wire::Reader reader;
+    REQUIRE(reader.open(buffer, size));
+    REQUIRE(reader.u32(wire::Field::SampleRate) == 48000);
+    REQUIRE(reader.u64(static_cast<wire::Field>(newerLength - 1)) == 99);
+}
+
+TEST_CASE("Wire format - events and overflow", "[wire]") {
+    MeterEvent events[2];
+    events[0].type = MeterEventType::Dropout;
+    events[0].startFrame = 480;
+    events[1].channel = 1;
+
+    alignas(8) std::uint8_t buffer[128];
+    wire::Writer writer(buffer, sizeof(buffer));
+    writer.putEvents(wire::Field::Events, events, 2);
+    const std::size_t size = writer.finish();
+
+    wire::Reader reader;
+    REQUIRE(reader.open(buffer, size));
+    const auto records = reader.array<wire::EventRecord>(wire::Field::Events);
+    REQUIRE(records.count == 2);
+    REQUIRE(records[0].startFrame == 480);
+    REQUIRE(records[0].type == static_cast<std::uint8_t>(MeterEventType::Dropout));
+    REQUIRE(records[1].channel == 1);
+
+    wire::Writer small(buffer, 40);
+    small.putEvents(wire::Field::Events, events, 2);
+    REQUIRE(small.overflowed());
+    REQUIRE(small.finish() == 0);
+    REQUIRE_FALSE(reader.open(buffer, 8));
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstdint>
+
+namespace openmeters::ui {
+
+/**
+ * Built-in 5x7 bitmap font covering printable ASCII, for renderers that
+ * have no font engine (the software rasterizer).
+ */
+struct BitmapFont {
+    static constexpr int kGlyphWidth = 5;
+    static constexpr int kGlyphHeight = 7;
+    static constexpr int kAdvance = 6;      // Glyph plus one column of spacing
+    static constexpr int kCellHeight = 9;   // Glyph plus room above and below
+
+    /**
+     * Seven rows for @p c, bit 4 the leftmost column. Characters outside
+     * printable ASCII map to '?'.
+     */
+    [[nodiscard]] static const std::uint8_t* glyph(char c) noexcept;
+};
+
+} // namespace openmeters::ui
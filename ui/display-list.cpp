@@ -0,0 +1,164 @@
+#include "display-list.h"
+#include <algorithm>
+
+namespace openmeters::ui {
+
+namespace {
+
+constexpr std::uint64_t kFnvOffset = 14695981039346656037ull;
+constexpr std::uint64_t kFnvPrime = 1099511628211ull;
+
+std::uint64_t hashBytes(std::uint64_t hash, const void* data, std::size_t size) {
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    for (std::size_t i = 0; i < size; ++i) {
+        hash = (hash ^ bytes[i]) * kFnvPrime;
+    }
+    return hash;
+}
+
+std::uint64_t hashFields(std::uint64_t hash, const DrawCommand& command) {
+    const auto kind = static_cast<std::uint32_t>(command.kind);
+    hash = hashBytes(hash, &kind, sizeof(kind));
+    hash = hashBytes(hash, &command.bounds, sizeof(command.bounds));
+    hash = hashBytes(hash, &command.color, sizeof(command.color));
+    return hashBytes(hash, &command.size, sizeof(command.size));
+}
+
+/**
+ * Area a command touches, for damage tracking.
+ */
+RectF coverage(const DrawCommand& command) {
+    const RectF& b = command.bounds;
+    if (command.kind == DrawCommandKind::Line) {
+        const float pad = command.size * 0.5f + 1.0f;
+        return RectF{std::min(b.x0, b.x1) - pad, std::min(b.y0, b.y1) - pad,
+                     std::max(b.x0, b.x1) + pad, std::max(b.y0, b.y1) + pad};
+    }
+    return b;
+}
+
+bool sameCommand(const DisplayList& listA, const DrawCommand& a, const DisplayList& listB, const DrawCommand& b) {
+    return a.kind == b.kind && a.bounds == b.bounds && a.color == b.color && a.size == b.size &&
+           listA.text(a) == listB.text(b);
+}
+
+} // namespace
+
+RectF RectF::united(const RectF& other) const noexcept {
+    if (other.empty()) {
+        return *this;
+    }
+    if (empty()) {
+        return other;
+    }
+    return RectF{std::min(x0, other.x0), std::min(y0, other.y0), std::max(x1, other.x1), std::max(y1, other.y1)};
+}
+
+void DisplayList::clear() {
+    m_commands.clear();
+    m_text.clear();
+    m_hash = kFnvOffset;
+}
+
+void DisplayList::push(const DrawCommand& command, std::string_view text) {
+    m_commands.push_back(command);
+
+    // Field by field: the text offset depends on earlier runs, not this one
+    m_hash = hashFields(m_hash, command);
+    m_hash = hashBytes(m_hash, text.data(), text.size());
+}
+
+void DisplayList::addRect(const RectF& rect, Rgba color, float rounding) {
+    DrawCommand command;
+    command.kind = DrawCommandKind::Rect;
+    command.bounds = rect;
+    command.color = color;
+    command.size = rounding;
+    push(command);
+}
+
+void DisplayList::addLine(float x0, float y0, float x1, float y1, Rgba color, float thickness) {
+    DrawCommand command;
+    command.kind = DrawCommandKind::Line;
+    command.bounds = RectF{x0, y0, x1, y1};
+    command.color = color;
+    command.size = thickness;
+    push(command);
+}
+
+void DisplayList::addText(float x, float y, std::string_view text, Rgba color, float fontHeight, float width) {
+    DrawCommand command;
+    command.kind = DrawCommandKind::Text;
+    command.bounds = RectF{x, y, x + width, y + fontHeight};
+    command.color = color;
+    command.size = fontHeight;
+    command.textOffset = static_cast<std::uint32_t>(m_text.size());
+    command.textLength = static_cast<std::uint32_t>(text.size());
+    m_text.append(text);
+    push(command, text);
+}
+
+void DisplayList::addCommands(std::span<const DrawCommand> commands, std::uint64_t runHash) {
+    m_commands.insert(m_commands.end(), commands.begin(), commands.end());
+    m_hash = (m_hash ^ runHash) * kFnvPrime;
+}
+
+std::uint64_t DisplayList::hashCommands(std::span<const DrawCommand> commands) noexcept {
+    std::uint64_t hash = kFnvOffset;
+    for (const DrawCommand& command : commands) {
+        hash = hashFields(hash, command);
+    }
+    return hash;
+}
+
+std::string_view DisplayList::text(const DrawCommand& command) const noexcept {
+    if (command.kind != DrawCommandKind::Text || command.textOffset + command.textLength > m_text.size()) {
+        return {};
+    }
+    return std::string_view(m_text).substr(command.textOffset, command.textLength);
+}
+
+DisplayListDiff DisplayList::diff(const DisplayList& previous) const {
+    DisplayListDiff result;
+    // Matching hashes are trusted without a walk. A 64-bit collision would
+    // leave the changed frame undrawn until the next change is detected,
+    // since the window only redraws on change; at roughly 2^-64 per
+    // frame that is accepted
+    if (m_hash == previous.m_hash && m_commands.size() == previous.m_commands.size()) {
+        return result;
+    }
+
+    const std::size_t common = std::min(m_commands.size(), previous.m_commands.size());
+    for (std::size_t i = 0; i < common; ++i) {
+        const DrawCommand& now = m_commands[i];
+        const DrawCommand& before = previous.m_commands[i];
+        if (!sameCommand(*this, now, previous, before)) {
+            ++result.changedCommands;
+            result.damage = result.damage.united(coverage(now)).united(coverage(before));
+        }
+    }
+    for (std::size_t i = common; i < m_commands.size(); ++i) {
+        ++result.changedCommands;
+        result.damage = result.damage.united(coverage(m_commands[i]));
+    }
+    for (std::size_t i = common; i < previous.m_commands.size(); ++i) {
+        ++result.changedCommands;
+        result.damage = result.damage.united(coverage(previous.m_commands[i]));
+    }
+    result.identical = result.changedCommands == 0;
+    return result;
+}
+
+bool DisplayList::operator==(const DisplayList& other) const {
+    if (m_commands.size() != other.m_commands.size()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < m_commands.size(); ++i) {
+        if (!sameCommand(*this, m_commands[i], other, other.m_commands[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace openmeters::ui
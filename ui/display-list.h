@@ -0,0 +1,144 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace openmeters::ui {
+
+/**
+ * Packed 8-bit RGBA color, laid out like ImGui's IM_COL32 (R in the low
+ * byte) so adapters can pass it through unchanged.
+ */
+using Rgba = std::uint32_t;
+
+[[nodiscard]] constexpr Rgba packRgba(std::uint8_t r, std::uint8_t g, std::uint8_t b, std::uint8_t a = 255) noexcept {
+    return static_cast<Rgba>(r) | (static_cast<Rgba>(g) << 8) | (static_cast<Rgba>(b) << 16) |
+           (static_cast<Rgba>(a) << 24);
+}
+
+/**
+ * Axis-aligned rectangle in pixels, min corner inclusive.
+ */
+struct RectF {
+    float x0 = 0.0f;
+    float y0 = 0.0f;
+    float x1 = 0.0f;
+    float y1 = 0.0f;
+
+    [[nodiscard]] bool empty() const noexcept { return x1 <= x0 || y1 <= y0; }
+    [[nodiscard]] float width() const noexcept { return x1 - x0; }
+    [[nodiscard]] float height() const noexcept { return y1 - y0; }
+
+    /**
+     * Smallest rectangle covering both (an empty side is ignored).
+     */
+    [[nodiscard]] RectF united(const RectF& other) const noexcept;
+
+    bool operator==(const RectF&) const = default;
+};
+
+enum class DrawCommandKind : std::uint32_t {
+    Rect = 1,  // Filled rectangle, optionally rounded
+    Line = 2,  // Line from (x0, y0) to (x1, y1)
+    Text = 3   // Text run with its top-left corner at (x0, y0)
+};
+
+/**
+ * One display list entry. Fixed size; text runs refer to the list's
+ * string arena instead of owning their characters.
+ */
+struct DrawCommand {
+    DrawCommandKind kind = DrawCommandKind::Rect;
+    RectF bounds;              // Rect: the rectangle; Line: the endpoints; Text: position and extent
+    Rgba color = 0;
+    float size = 0.0f;         // Rect: corner rounding; Line: thickness; Text: font height
+    std::uint32_t textOffset = 0;
+    std::uint32_t textLength = 0;
+
+    bool operator==(const DrawCommand&) const = default;
+};
+
+/**
+ * Result of comparing two display lists.
+ */
+struct DisplayListDiff {
+    bool identical = true;
+    std::size_t changedCommands = 0;  // Positions whose command differs, plus added or removed ones
+    RectF damage;                     // Area covered by changed commands in either list
+};
+
+/**
+ * Renderer-agnostic drawing for one frame: colored rects, lines and text
+ * runs in painter's order.
+ *
+ * Lists are built fresh every frame (clear() keeps the storage) and can be
+ * compared with the previous frame's list to skip or limit redraws. A
+ * running hash is kept as commands are added; diff() treats lists of the
+ * same size and hash as unchanged without walking them.
+ *
+ * Thread safety: None; build and read on one thread.
+ */
+class DisplayList {
+public:
+    void clear();
+
+    void addRect(const RectF& rect, Rgba color, float rounding = 0.0f);
+    void addLine(float x0, float y0, float x1, float y1, Rgba color, float thickness = 1.0f);
+
+    /**
+     * Add a text run. Text is measured by the renderer; @p width is the
+     * layout's estimate and only feeds damage tracking.
+     */
+    void addText(float x, float y, std::string_view text, Rgba color, float fontHeight, float width = 0.0f);
+
+    /**
+     * Append prebuilt Rect and Line commands in one block (text runs need
+     * addText()). @p runHash, from hashCommands(), is mixed in once instead
+     * of hashing every command; the same commands added one by one hash
+     * differently, which only costs diff() its fast path.
+     */
+    void addCommands(std::span<const DrawCommand> commands, std::uint64_t runHash);
+
+    /**
+     * Hash of a run of commands, for addCommands().
+     */
+    [[nodiscard]] static std::uint64_t hashCommands(std::span<const DrawCommand> commands) noexcept;
+
+    [[nodiscard]] const std::vector<DrawCommand>& commands() const noexcept { return m_commands; }
+    [[nodiscard]] std::size_t size() const noexcept { return m_commands.size(); }
+    [[nodiscard]] bool empty() const noexcept { return m_commands.empty(); }
+
+    /**
+     * Characters of a Text command.
+     */
+    [[nodiscard]] std::string_view text(const DrawCommand& command) const noexcept;
+
+    /**
+     * Hash of every command and text run added since clear().
+     */
+    [[nodiscard]] std::uint64_t hash() const noexcept { return m_hash; }
+
+    /**
+     * Compare against an older list. Text is compared by content. Equal
+     * hashes and sizes short-circuit to identical, so a hash collision
+     * reports a changed list as unchanged and a caller that redraws only
+     * on change keeps showing the old frame until the next change. Use
+     * operator== where that matters.
+     */
+    [[nodiscard]] DisplayListDiff diff(const DisplayList& previous) const;
+
+    bool operator==(const DisplayList& other) const;
+
+private:
+    void push(const DrawCommand& command, std::string_view text = {});
+
+    std::vector<DrawCommand> m_commands;
+    std::string m_text;
+    std::uint64_t m_hash = 14695981039346656037ull; // FNV-1a offset basis
+};
+
+} // namespace openmeters::ui
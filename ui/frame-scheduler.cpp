@@ -0,0 +1,84 @@
+#include "frame-scheduler.h"
+#include "../common/fast-math.h"
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+
+namespace openmeters::ui {
+
+FrameScheduler::FrameScheduler(const FrameSchedulerSettings& settings)
+    : m_settings(settings) {
+}
+
+void FrameScheduler::requestAt(Clock::time_point deadline) noexcept {
+    if (!m_hasDeadline || deadline < m_deadline) {
+        m_deadline = deadline;
+        m_hasDeadline = true;
+    }
+}
+
+std::uint32_t FrameScheduler::due(Clock::time_point now) const noexcept {
+    std::uint32_t reasons = m_pending;
+    if (m_settleFramesLeft > 0) {
+        reasons |= FrameReasonInput;
+    }
+    if (m_hasDeadline && now >= m_deadline) {
+        reasons |= FrameReasonAnimation;
+    }
+    if (reasons == FrameReasonNone) {
+        return FrameReasonNone;
+    }
+    if (m_hasLastFrame && now - m_lastFrame < m_settings.minFrameInterval) {
+        return FrameReasonNone; // Requested, but too soon after the last frame
+    }
+    return reasons;
+}
+
+FrameScheduler::Clock::duration FrameScheduler::waitTime(Clock::time_point now) const noexcept {
+    Clock::time_point next = Clock::time_point::max();
+    if (m_pending != FrameReasonNone || m_settleFramesLeft > 0) {
+        next = m_hasLastFrame ? m_lastFrame + m_settings.minFrameInterval : now;
+    }
+    if (m_hasDeadline) {
+        const Clock::time_point paced = m_hasLastFrame ? std::max(m_deadline, m_lastFrame + m_settings.minFrameInterval)
+                                                       : m_deadline;
+        next = std::min(next, paced);
+    }
+    if (next == Clock::time_point::max()) {
+        return Clock::duration::max();
+    }
+    return next > now ? next - now : Clock::duration::zero();
+}
+
+void FrameScheduler::frameRendered(Clock::time_point now, std::uint32_t reasons) noexcept {
+    if (reasons & FrameReasonInput) {
+        // New input restarts the settle frames; settle frames count themselves down
+        m_settleFramesLeft = (m_pending & FrameReasonInput) ? m_settings.inputSettleFrames
+                                                             : std::max(m_settleFramesLeft - 1, 0);
+    }
+    m_pending &= ~reasons;
+    if (m_hasDeadline && now >= m_deadline) {
+        m_hasDeadline = false;
+    }
+    m_lastFrame = now;
+    m_hasLastFrame = true;
+    ++m_framesRendered;
+}
+
+bool FrameScheduler::meterChanged(const common::MeterSnapshot& drawn, const common::MeterSnapshot& next,
+                                  float thresholdDb, float floorDb) noexcept {
+    const float before[] = {drawn.peak.left, drawn.peak.right, drawn.rms.left, drawn.rms.right};
+    const float after[] = {next.peak.left, next.peak.right, next.rms.left, next.rms.right};
+    for (std::size_t i = 0; i < std::size(before); ++i) {
+        if (before[i] == after[i]) {
+            continue;
+        }
+        const float moved = common::fastLinearToDb(after[i], floorDb) - common::fastLinearToDb(before[i], floorDb);
+        if (std::fabs(moved) > thresholdDb) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace openmeters::ui
@@ -0,0 +1,101 @@
+#pragma once
+
+#include "../common/meter-values.h"
+#include <chrono>
+#include <cstdint>
+
+namespace openmeters::ui {
+
+/**
+ * Why a frame is drawn. Reasons accumulate until the frame is rendered.
+ */
+enum FrameReason : std::uint32_t {
+    FrameReasonNone = 0,
+    FrameReasonMeters = 1u << 0,     // Meter values moved past the perceptual threshold
+    FrameReasonInput = 1u << 1,      // Mouse, keyboard or window messages
+    FrameReasonAnimation = 1u << 2,  // A scheduled deadline passed (decay, indicator hold)
+    FrameReasonForced = 1u << 3      // Configuration change, resize, first frame
+};
+
+/**
+ * Scheduler settings.
+ */
+struct FrameSchedulerSettings {
+    std::chrono::microseconds minFrameInterval{16667};  // Redraw cap (meterUpdateRate)
+    int inputSettleFrames = 2;                          // Extra frames after input so hover states catch up
+};
+
+/**
+ * Decides when the overlay redraws.
+ *
+ * Instead of drawing at a fixed rate, frames are requested: by the meter
+ * feed when values move perceptibly, by input, or by a deadline for
+ * time-driven effects. due() says whether a frame should be drawn now
+ * (spacing frames at least minFrameInterval apart), and waitTime() how
+ * long the UI thread may block before the next one is needed. With no
+ * requests it blocks indefinitely, so a quiet or steady signal costs no
+ * frames at all.
+ *
+ * Thread safety: None; use from the UI thread. meterChanged() is a pure
+ * function and may be called from the audio thread to decide whether to
+ * wake the UI thread.
+ */
+class FrameScheduler {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit FrameScheduler(const FrameSchedulerSettings& settings = {});
+
+    void setSettings(const FrameSchedulerSettings& settings) noexcept { m_settings = settings; }
+    void setMinFrameInterval(std::chrono::microseconds interval) noexcept { m_settings.minFrameInterval = interval; }
+    [[nodiscard]] const FrameSchedulerSettings& settings() const noexcept { return m_settings; }
+
+    /**
+     * Ask for a frame as soon as pacing allows.
+     */
+    void request(FrameReason reason) noexcept { m_pending |= reason; }
+
+    /**
+     * Ask for an animation frame at @p deadline (the earliest request wins).
+     */
+    void requestAt(Clock::time_point deadline) noexcept;
+
+    /**
+     * Reasons to draw a frame now, or FrameReasonNone if none is due yet.
+     */
+    [[nodiscard]] std::uint32_t due(Clock::time_point now) const noexcept;
+
+    /**
+     * How long to wait for the next frame. Clock::duration::max() when
+     * nothing is requested.
+     */
+    [[nodiscard]] Clock::duration waitTime(Clock::time_point now) const noexcept;
+
+    /**
+     * Record a frame as it starts; clears the reasons it serves. Requests
+     * made while the frame is drawn stay pending.
+     */
+    void frameRendered(Clock::time_point now, std::uint32_t reasons) noexcept;
+
+    [[nodiscard]] std::uint64_t framesRendered() const noexcept { return m_framesRendered; }
+
+    /**
+     * Whether two snapshots differ by more than the threshold on any
+     * channel, compared in dB with everything under the floor treated as
+     * silence.
+     */
+    [[nodiscard]] static bool meterChanged(const common::MeterSnapshot& drawn, const common::MeterSnapshot& next,
+                                           float thresholdDb, float floorDb) noexcept;
+
+private:
+    FrameSchedulerSettings m_settings;
+    std::uint32_t m_pending = FrameReasonForced;
+    bool m_hasDeadline = false;
+    Clock::time_point m_deadline{};
+    Clock::time_point m_lastFrame{};
+    bool m_hasLastFrame = false;
+    int m_settleFramesLeft = 0;
+    std::uint64_t m_framesRendered = 0;
+};
+
+} // namespace openmeters::ui
@@ -0,0 +1,142 @@
+#include "frame-writer.h"
+#include "../common/logger.h"
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <fstream>
+
+namespace openmeters::ui {
+
+namespace {
+
+constexpr std::size_t kMaxStoredBlock = 65535;
+
+std::array<std::uint32_t, 256> makeCrcTable() {
+    std::array<std::uint32_t, 256> table{};
+    for (std::uint32_t n = 0; n < 256; ++n) {
+        std::uint32_t c = n;
+        for (int k = 0; k < 8; ++k) {
+            c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+        }
+        table[n] = c;
+    }
+    return table;
+}
+
+std::uint32_t crc32(const std::uint8_t* data, std::size_t size, std::uint32_t crc = 0) {
+    static const std::array<std::uint32_t, 256> table = makeCrcTable();
+    crc = ~crc;
+    for (std::size_t i = 0; i < size; ++i) {
+        crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+void putU32(std::vector<std::uint8_t>& out, std::uint32_t value) {
+    out.push_back(static_cast<std::uint8_t>(value >> 24));
+    out.push_back(static_cast<std::uint8_t>(value >> 16));
+    out.push_back(static_cast<std::uint8_t>(value >> 8));
+    out.push_back(static_cast<std::uint8_t>(value));
+}
+
+/**
+ * Fill in the length and append the CRC of the chunk begun at @p start.
+ */
+void finishChunk(std::vector<std::uint8_t>& out, std::size_t start) {
+    const auto length = static_cast<std::uint32_t>(out.size() - start - 8);
+    out[start] = static_cast<std::uint8_t>(length >> 24);
+    out[start + 1] = static_cast<std::uint8_t>(length >> 16);
+    out[start + 2] = static_cast<std::uint8_t>(length >> 8);
+    out[start + 3] = static_cast<std::uint8_t>(length);
+    putU32(out, crc32(out.data() + start + 4, out.size() - start - 4));
+}
+
+/**
+ * Start a chunk: placeholder length, then the type.
+ */
+std::size_t beginChunk(std::vector<std::uint8_t>& out, const char* type) {
+    const std::size_t start = out.size();
+    putU32(out, 0);
+    out.insert(out.end(), type, type + 4);
+    return start;
+}
+
+} // namespace
+
+void encodePng(const Rgba* pixels, int width, int height, std::vector<std::uint8_t>& out) {
+    static constexpr std::uint8_t kSignature[] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    out.assign(std::begin(kSignature), std::end(kSignature));
+
+    std::size_t chunk = beginChunk(out, "IHDR");
+    putU32(out, static_cast<std::uint32_t>(width));
+    putU32(out, static_cast<std::uint32_t>(height));
+    out.push_back(8);  // Bit depth
+    out.push_back(6);  // RGBA
+    out.push_back(0);  // Deflate
+    out.push_back(0);  // No filtering beyond per-row filter bytes
+    out.push_back(0);  // No interlace
+    finishChunk(out, chunk);
+
+    // Rows prefixed with filter type 0 (none)
+    const std::size_t rowBytes = static_cast<std::size_t>(width) * 4;
+    std::vector<std::uint8_t> raw((rowBytes + 1) * static_cast<std::size_t>(height));
+    const auto* bytes = reinterpret_cast<const std::uint8_t*>(pixels);
+    for (std::size_t row = 0; row < static_cast<std::size_t>(height); ++row) {
+        raw[row * (rowBytes + 1)] = 0;
+        std::memcpy(&raw[row * (rowBytes + 1) + 1], bytes + row * rowBytes, rowBytes);
+    }
+
+    // zlib stream of stored (uncompressed) deflate blocks
+    chunk = beginChunk(out, "IDAT");
+    out.push_back(0x78);
+    out.push_back(0x01);
+    std::size_t offset = 0;
+    do {
+        const std::size_t block = std::min(raw.size() - offset, kMaxStoredBlock);
+        const bool last = offset + block == raw.size();
+        out.push_back(last ? 1 : 0); // BFINAL, BTYPE 00
+        out.push_back(static_cast<std::uint8_t>(block));
+        out.push_back(static_cast<std::uint8_t>(block >> 8));
+        out.push_back(static_cast<std::uint8_t>(~block));
+        out.push_back(static_cast<std::uint8_t>(~block >> 8));
+        out.insert(out.end(), raw.begin() + static_cast<std::ptrdiff_t>(offset),
+                   raw.begin() + static_cast<std::ptrdiff_t>(offset + block));
+        offset += block;
+    } while (offset < raw.size());
+
+    // Adler-32, reducing once per 5552 bytes (the longest run that cannot overflow)
+    std::uint32_t adlerA = 1;
+    std::uint32_t adlerB = 0;
+    for (std::size_t start = 0; start < raw.size(); start += 5552) {
+        const std::size_t end = std::min(start + 5552, raw.size());
+        for (std::size_t i = start; i < end; ++i) {
+            adlerA += raw[i];
+            adlerB += adlerA;
+        }
+        adlerA %= 65521;
+        adlerB %= 65521;
+    }
+    putU32(out, (adlerB << 16) | adlerA);
+    finishChunk(out, chunk);
+
+    chunk = beginChunk(out, "IEND");
+    finishChunk(out, chunk);
+}
+
+bool writePng(const std::string& path, const SoftwareRasterizer& frame) {
+    std::vector<std::uint8_t> png;
+    encodePng(frame.pixels(), frame.width(), frame.height(), png);
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file || !file.write(reinterpret_cast<const char*>(png.data()), static_cast<std::streamsize>(png.size()))) {
+        LOG_WARNING("Failed to write frame {}", path);
+        return false;
+    }
+    return true;
+}
+
+bool writeRawFrame(std::FILE* out, const SoftwareRasterizer& frame) {
+    return std::fwrite(frame.pixels(), 1, frame.byteSize(), out) == frame.byteSize();
+}
+
+} // namespace openmeters::ui
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "software-rasterizer.h"
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace openmeters::ui {
+
+/**
+ * Encode an RGBA8 image as PNG (8-bit RGBA, no interlace).
+ *
+ * Image data goes into uncompressed deflate blocks: frames are written
+ * quickly and read by any decoder, at the cost of file size. Recompress
+ * with an external tool if size matters.
+ */
+void encodePng(const Rgba* pixels, int width, int height, std::vector<std::uint8_t>& out);
+
+/**
+ * Write the rasterizer's buffer as a PNG file.
+ *
+ * @return false if the file could not be written
+ */
+bool writePng(const std::string& path, const SoftwareRasterizer& frame);
+
+/**
+ * Write the buffer as one raw RGBA frame (e.g. to a pipe into
+ * `ffmpeg -f rawvideo -pix_fmt rgba -s WxH -i -`).
+ *
+ * @return false on a write error (such as the reader closing the pipe)
+ */
+bool writeRawFrame(std::FILE* out, const SoftwareRasterizer& frame);
+
+} // namespace openmeters::ui
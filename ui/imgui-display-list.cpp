@@ -0,0 +1,29 @@
+#include "imgui-display-list.h"
+#include <imgui.h>
+
+namespace openmeters::ui {
+
+void submitToImGui(const DisplayList& list, ImDrawList* drawList, float originX, float originY) {
+    for (const DrawCommand& command : list.commands()) {
+        if ((command.color >> 24) == 0) {
+            continue; // Fully transparent (e.g. unlit segments)
+        }
+        const ImVec2 min(originX + command.bounds.x0, originY + command.bounds.y0);
+        const ImVec2 max(originX + command.bounds.x1, originY + command.bounds.y1);
+        switch (command.kind) {
+            case DrawCommandKind::Rect:
+                drawList->AddRectFilled(min, max, command.color, command.size);
+                break;
+            case DrawCommandKind::Line:
+                drawList->AddLine(min, max, command.color, command.size);
+                break;
+            case DrawCommandKind::Text: {
+                const std::string_view text = list.text(command);
+                drawList->AddText(nullptr, command.size, min, command.color, text.data(), text.data() + text.size());
+                break;
+            }
+        }
+    }
+}
+
+} // namespace openmeters::ui
@@ -0,0 +1,14 @@
+#pragma once
+
+#include "display-list.h"
+
+struct ImDrawList;
+
+namespace openmeters::ui {
+
+/**
+ * Replay a display list into an ImGui draw list, offset by (originX, originY).
+ */
+void submitToImGui(const DisplayList& list, ImDrawList* drawList, float originX, float originY);
+
+} // namespace openmeters::ui
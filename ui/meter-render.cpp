@@ -0,0 +1,212 @@
+#include "meter-render.h"
+#include <algorithm>
+#include <string_view>
+
+namespace openmeters::ui {
+
+namespace {
+
+float appendLabel(DisplayList& list, float x, float y, std::string_view text, Rgba color, const MeterRenderStyle& style) {
+    list.addText(x, y, text, color, style.fontHeight, style.charWidth * static_cast<float>(text.size()));
+    return y + style.fontHeight + style.itemSpacing;
+}
+
+/**
+ * Segment rectangles of a bar; segmentWidth <= 0 means they do not fit.
+ */
+struct SegmentLayout {
+    float x0 = 0.0f;
+    float y0 = 0.0f;
+    float y1 = 0.0f;
+    float segmentWidth = 0.0f;
+    float step = 0.0f;
+
+    [[nodiscard]] RectF segment(int index) const noexcept {
+        const float x = x0 + static_cast<float>(index) * step;
+        return RectF{x, y0, x + segmentWidth, y1};
+    }
+};
+
+SegmentLayout layoutSegments(const RectF& bounds, const MeterRenderStyle& style) {
+    const int segments = style.scale.segments();
+    SegmentLayout layout;
+    layout.segmentWidth = (bounds.width() - style.framePaddingX * 2.0f -
+                           style.segmentSpacing * static_cast<float>(segments - 1)) / static_cast<float>(segments);
+    layout.x0 = bounds.x0 + style.framePaddingX;
+    layout.y0 = bounds.y0 + style.framePaddingY;
+    layout.y1 = bounds.y1 - style.framePaddingY;
+    layout.step = layout.segmentWidth + style.segmentSpacing;
+    return layout;
+}
+
+Rgba zoneColor(common::DbZone zone, const MeterRenderStyle& style) {
+    switch (zone) {
+        case common::DbZone::Over:    return style.redColor;
+        case common::DbZone::Warning: return style.yellowColor;
+        case common::DbZone::Normal:  break;
+    }
+    return style.greenColor;
+}
+
+/**
+ * Panel layout shared by the cached and uncached paths. @p bar is called
+ * as bar(index, bounds, value) for peak L/R then RMS L/R.
+ */
+template <typename BarFn>
+float layoutPanel(DisplayList& out, const MeterView& view, const MeterRenderStyle& style, float x, float y,
+                  float width, BarFn&& bar) {
+    const float top = y;
+    const auto appendBar = [&](int index, float value) {
+        bar(index, RectF{x, y, x + width, y + style.barHeight}, value);
+        y += style.barHeight + style.itemSpacing;
+    };
+
+    if (view.showPeak) {
+        y = appendLabel(out, x, y, "Peak", style.textColor, style);
+        appendBar(0, view.snapshot.peak.left);
+        appendBar(1, view.snapshot.peak.right);
+    }
+
+    y += style.itemSpacing;
+
+    if (view.showRms) {
+        y = appendLabel(out, x, y, "RMS", style.textColor, style);
+        appendBar(2, view.snapshot.rms.left);
+        appendBar(3, view.snapshot.rms.right);
+    }
+
+    // Clip indicator (held by the caller for a moment after the last clip or over)
+    if (view.clipLit) {
+        y = appendLabel(out, x, y, "CLIP", style.clipColor, style);
+    }
+    return y - top;
+}
+
+} // namespace
+
+void appendSegmentedBar(DisplayList& list, const RectF& bounds, float value, const MeterRenderStyle& style) {
+    list.addRect(bounds, style.frameColor, style.frameRounding);
+
+    const SegmentLayout layout = layoutSegments(bounds, style);
+    if (layout.segmentWidth <= 0.0f) {
+        return;
+    }
+
+    const common::DbScale& scale = style.scale;
+    const int lit = scale.litSegments(value);
+    const int drawn = (style.unlitColor >> 24) != 0 ? scale.segments() : lit;
+    for (int i = 0; i < drawn; ++i) {
+        const Rgba color = i < lit ? zoneColor(scale.zone(i), style) : style.unlitColor;
+        list.addRect(layout.segment(i), color, style.segmentRounding);
+    }
+}
+
+void SegmentedBarCache::build(const RectF& bounds, const MeterRenderStyle& style) {
+    m_bounds = bounds;
+    m_scale = style.scale;
+    m_lit.clear();
+    m_unlit.clear();
+
+    DrawCommand frame;
+    frame.kind = DrawCommandKind::Rect;
+    frame.bounds = bounds;
+    frame.color = style.frameColor;
+    frame.size = style.frameRounding;
+    m_lit.push_back(frame);
+
+    // A bar too narrow for its segments is just the frame, as in appendSegmentedBar()
+    const SegmentLayout layout = layoutSegments(bounds, style);
+    const int segments = layout.segmentWidth > 0.0f ? m_scale.segments() : 0;
+    const bool drawUnlit = (style.unlitColor >> 24) != 0;
+    for (int i = 0; i < segments; ++i) {
+        DrawCommand segment;
+        segment.kind = DrawCommandKind::Rect;
+        segment.bounds = layout.segment(i);
+        segment.size = style.segmentRounding;
+        segment.color = zoneColor(m_scale.zone(i), style);
+        m_lit.push_back(segment);
+        if (drawUnlit) {
+            segment.color = style.unlitColor;
+            m_unlit.push_back(segment);
+        }
+    }
+
+    // Run hashes for every split point
+    const std::span<const DrawCommand> lit(m_lit);
+    const std::span<const DrawCommand> unlit(m_unlit);
+    m_litHashes.resize(m_lit.size());
+    for (std::size_t n = 0; n < m_lit.size(); ++n) {
+        m_litHashes[n] = DisplayList::hashCommands(lit.first(n + 1));
+    }
+    m_unlitHashes.resize(m_unlit.empty() ? 0 : m_unlit.size() + 1);
+    for (std::size_t n = 0; n < m_unlitHashes.size(); ++n) {
+        m_unlitHashes[n] = DisplayList::hashCommands(unlit.subspan(n));
+    }
+}
+
+void SegmentedBarCache::append(DisplayList& list, float value) const {
+    if (m_lit.empty()) {
+        return;
+    }
+    const auto lit = std::min(static_cast<std::size_t>(m_scale.litSegments(value)), m_lit.size() - 1);
+    list.addCommands(std::span<const DrawCommand>(m_lit).first(lit + 1), m_litHashes[lit]);
+    if (!m_unlit.empty()) {
+        list.addCommands(std::span<const DrawCommand>(m_unlit).subspan(lit), m_unlitHashes[lit]);
+    }
+}
+
+float MeterPanelCache::append(DisplayList& out, const MeterView& view, const MeterRenderStyle& style, float x, float y,
+                              float width) {
+    const Key key{style, x, y, width, view.showPeak, view.showRms};
+    const bool rebuild = !m_valid || !(key == m_key);
+    if (rebuild) {
+        m_key = key;
+        m_valid = true;
+        ++m_rebuilds;
+    }
+    return layoutPanel(out, view, style, x, y, width, [&](int index, const RectF& bounds, float value) {
+        SegmentedBarCache& bar = m_bars[static_cast<std::size_t>(index)];
+        if (rebuild) {
+            bar.build(bounds, style);
+        }
+        bar.append(out, value);
+    });
+}
+
+float appendMeterPanel(DisplayList& out, const MeterView& view, const MeterRenderStyle& style, float x, float y,
+                       float width) {
+    return layoutPanel(out, view, style, x, y, width, [&](int, const RectF& bounds, float value) {
+        appendSegmentedBar(out, bounds, value, style);
+    });
+}
+
+float buildMeterDisplayList(const MeterView& view, const MeterRenderStyle& style, float width, DisplayList& out) {
+    out.clear();
+    return appendMeterPanel(out, view, style, 0.0f, 0.0f, width);
+}
+
+float buildMeterBridge(std::span<const MeterView> views, const MeterRenderStyle& style, float panelWidth, float gap,
+                       DisplayList& out) {
+    out.clear();
+    float height = 0.0f;
+    float x = 0.0f;
+    for (const MeterView& view : views) {
+        height = std::max(height, appendMeterPanel(out, view, style, x, 0.0f, panelWidth));
+        x += panelWidth + gap;
+    }
+    return height;
+}
+
+float buildMeterBridge(std::span<const MeterView> views, const MeterRenderStyle& style, float panelWidth, float gap,
+                       DisplayList& out, std::span<MeterPanelCache> caches) {
+    out.clear();
+    float height = 0.0f;
+    float x = 0.0f;
+    for (std::size_t i = 0; i < views.size(); ++i) {
+        height = std::max(height, caches[i].append(out, views[i], style, x, 0.0f, panelWidth));
+        x += panelWidth + gap;
+    }
+    return height;
+}
+
+} // namespace openmeters::ui
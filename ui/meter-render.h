@@ -0,0 +1,158 @@
+#pragma once
+
+#include "display-list.h"
+#include "../common/db-scale.h"
+#include "../common/meter-values.h"
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace openmeters::ui {
+
+/**
+ * Metrics and colors for meter drawing. Defaults match the overlay's
+ * ImGui style; the window fills in font and theme values each frame.
+ */
+struct MeterRenderStyle {
+    float fontHeight = 13.0f;
+    float charWidth = 7.0f;         // Text width estimate, for damage tracking only
+    float itemSpacing = 4.0f;       // Vertical gap between rows
+    float framePaddingX = 4.0f;
+    float framePaddingY = 3.0f;
+    float frameRounding = 4.0f;
+    float barHeight = 20.0f;
+
+    common::DbScale scale;          // Segment count, dB thresholds and color zones
+    float segmentSpacing = 2.0f;
+    float segmentRounding = 2.0f;
+
+    Rgba frameColor = packRgba(51, 51, 51, 138);
+    Rgba textColor = packRgba(255, 255, 255);
+    Rgba greenColor = packRgba(50, 255, 50);
+    Rgba yellowColor = packRgba(255, 200, 50);
+    Rgba redColor = packRgba(255, 50, 50);
+    Rgba unlitColor = 0;            // Transparent by default
+    Rgba clipColor = packRgba(255, 51, 51);
+
+    bool operator==(const MeterRenderStyle&) const = default;
+};
+
+/**
+ * What the meter panel shows this frame.
+ */
+struct MeterView {
+    common::MeterSnapshot snapshot;
+    bool showPeak = true;
+    bool showRms = true;
+    bool clipLit = false;
+};
+
+/**
+ * Append a segmented LED-style bar on the style's dB scale. Segments are
+ * lit while the linear @p value is above their threshold. Unlit segments
+ * are emitted in unlitColor only when it is visible; with the default
+ * transparent color a bar is its frame plus the lit segments.
+ */
+void appendSegmentedBar(DisplayList& list, const RectF& bounds, float value, const MeterRenderStyle& style);
+
+/**
+ * One segmented bar's commands, built once per layout or style change.
+ *
+ * append() emits the same commands as appendSegmentedBar() from one
+ * prebuilt run (the frame, then every segment lit in its zone color) cut
+ * at the lit count: one binary search and one block copy per bar per
+ * frame, with no segment layout, zone lookup or per-command hashing. A
+ * visible unlitColor adds a second run for the rest of the bar.
+ */
+class SegmentedBarCache {
+public:
+    void build(const RectF& bounds, const MeterRenderStyle& style);
+
+    [[nodiscard]] const RectF& bounds() const noexcept { return m_bounds; }
+
+    /**
+     * Append the bar for a linear @p value. Does nothing before build().
+     */
+    void append(DisplayList& list, float value) const;
+
+private:
+    RectF m_bounds;
+    common::DbScale m_scale;
+    std::vector<DrawCommand> m_lit;            // Frame, then every segment lit
+    std::vector<DrawCommand> m_unlit;          // Every segment unlit; empty if unlitColor is transparent
+    std::vector<std::uint64_t> m_litHashes;    // [n]: frame plus the first n lit segments
+    std::vector<std::uint64_t> m_unlitHashes;  // [n]: unlit segments from n on
+};
+
+/**
+ * Cached bars for one meter panel, for callers that draw the same panel
+ * every frame. Bars are rebuilt only when the panel moves, resizes, shows
+ * or hides a meter, or the style changes.
+ */
+class MeterPanelCache {
+public:
+    /**
+     * Same as appendMeterPanel(), using and refreshing the cache.
+     */
+    float append(DisplayList& out, const MeterView& view, const MeterRenderStyle& style, float x, float y, float width);
+
+    /**
+     * Number of times the bars were rebuilt, for diagnostics and tests.
+     */
+    [[nodiscard]] std::uint64_t rebuilds() const noexcept { return m_rebuilds; }
+
+private:
+    struct Key {
+        MeterRenderStyle style;
+        float x = 0.0f;
+        float y = 0.0f;
+        float width = 0.0f;
+        bool showPeak = false;
+        bool showRms = false;
+
+        bool operator==(const Key&) const = default;
+    };
+
+    Key m_key;
+    bool m_valid = false;
+    std::array<SegmentedBarCache, 4> m_bars;   // Peak L/R, RMS L/R
+    std::uint64_t m_rebuilds = 0;
+};
+
+/**
+ * Lay out the meter panel (labels, peak and RMS bars, clip indicator)
+ * from the top-left corner at (0, 0).
+ *
+ * @param width Panel width in pixels
+ * @param out Cleared and filled with the panel's commands
+ * @return Height used, so the caller can place controls below it
+ */
+float buildMeterDisplayList(const MeterView& view, const MeterRenderStyle& style, float width, DisplayList& out);
+
+/**
+ * Append one meter panel with its top-left corner at (x, y).
+ *
+ * @return Height used
+ */
+float appendMeterPanel(DisplayList& out, const MeterView& view, const MeterRenderStyle& style, float x, float y,
+                       float width);
+
+/**
+ * Lay out a meter bridge: one panel per view, side by side, separated by
+ * @p gap pixels, from (0, 0).
+ *
+ * @param out Cleared and filled with every panel's commands
+ * @return Height of the tallest panel
+ */
+float buildMeterBridge(std::span<const MeterView> views, const MeterRenderStyle& style, float panelWidth, float gap,
+                       DisplayList& out);
+
+/**
+ * Same as above with one cache per view (@p caches must be as long as
+ * @p views).
+ */
+float buildMeterBridge(std::span<const MeterView> views, const MeterRenderStyle& style, float panelWidth, float gap,
+                       DisplayList& out, std::span<MeterPanelCache> caches);
+
+} // namespace openmeters::ui
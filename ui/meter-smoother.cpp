@@ -0,0 +1,127 @@
+#include "meter-smoother.h"
+#include "../common/fast-math.h"
+#include <algorithm>
+#include <cmath>
+
+namespace openmeters::ui {
+
+namespace {
+
+std::array<float, 4> levels(const common::MeterSnapshot& s) {
+    return {s.peak.left, s.peak.right, s.rms.left, s.rms.right};
+}
+
+} // namespace
+
+void MeterSmoother::push(const common::MeterSnapshot& snapshot, Clock::time_point arrival) noexcept {
+    const std::size_t newest = (m_next + kHistory - 1) % kHistory;
+    const bool timed = m_count == 0 || snapshot.timestampMs > m_history[newest].snapshot.timestampMs;
+
+    Entry& entry = m_history[m_next];
+    entry.snapshot = snapshot;
+    m_arrivals[m_next] = arrival;
+    m_next = (m_next + 1) % kHistory;
+    m_count = std::min(m_count + 1, kHistory);
+
+    if (!timed || snapshot.timestampMs == 0) {
+        // No usable capture time: fall back to arrival times
+        for (std::size_t i = 0; i < m_count; ++i) {
+            m_history[i].time = m_arrivals[i];
+        }
+    } else {
+        // Capture time plus the smallest delivery delay in the window removes
+        // scheduling jitter while following slow clock drift
+        Clock::duration offset = Clock::duration::max();
+        for (std::size_t i = 0; i < m_count; ++i) {
+            const auto stream = std::chrono::milliseconds(m_history[i].snapshot.timestampMs);
+            offset = std::min(offset, m_arrivals[i].time_since_epoch() - stream);
+        }
+        for (std::size_t i = 0; i < m_count; ++i) {
+            m_history[i].time = Clock::time_point(offset + std::chrono::milliseconds(m_history[i].snapshot.timestampMs));
+        }
+    }
+
+    // Average spacing over the history sets the render delay
+    if (m_count >= 2) {
+        const std::size_t oldest = m_count < kHistory ? 0 : m_next;
+        const std::size_t latest = (m_next + kHistory - 1) % kHistory;
+        const auto span = m_history[latest].time - m_history[oldest].time;
+        m_packetInterval = std::clamp<Clock::duration>(span / static_cast<int>(m_count - 1), Clock::duration::zero(),
+                                                       m_ballistics.maxInterpolationDelay);
+    }
+}
+
+common::MeterSnapshot MeterSmoother::interpolate(Clock::time_point renderTime) const noexcept {
+    // Walk from oldest to newest for the pair around the render time
+    const std::size_t first = m_count < kHistory ? 0 : m_next;
+    const Entry* before = &m_history[first];
+    if (renderTime <= before->time) {
+        return before->snapshot;
+    }
+    for (std::size_t n = 1; n < m_count; ++n) {
+        const Entry* after = &m_history[(first + n) % kHistory];
+        if (renderTime < after->time) {
+            const auto span = std::chrono::duration<float>(after->time - before->time).count();
+            const float t = span > 0.0f ? std::chrono::duration<float>(renderTime - before->time).count() / span : 1.0f;
+            common::MeterSnapshot out = after->snapshot;
+            out.peak.left = before->snapshot.peak.left + (after->snapshot.peak.left - before->snapshot.peak.left) * t;
+            out.peak.right = before->snapshot.peak.right + (after->snapshot.peak.right - before->snapshot.peak.right) * t;
+            out.rms.left = before->snapshot.rms.left + (after->snapshot.rms.left - before->snapshot.rms.left) * t;
+            out.rms.right = before->snapshot.rms.right + (after->snapshot.rms.right - before->snapshot.rms.right) * t;
+            return out;
+        }
+        before = after;
+    }
+    return before->snapshot;
+}
+
+common::MeterSnapshot MeterSmoother::advance(Clock::time_point frameTime) noexcept {
+    if (m_count == 0) {
+        m_animating = false;
+        return {};
+    }
+
+    const Clock::time_point renderTime = frameTime - m_packetInterval;
+    const common::MeterSnapshot target = interpolate(renderTime);
+    const std::array<float, 4> targetLinear = levels(target);
+
+    const float dt = m_hasFrame ? std::max(std::chrono::duration<float>(frameTime - m_lastFrame).count(), 0.0f) : 0.0f;
+    const float release[4] = {m_ballistics.peakReleaseDbPerSecond, m_ballistics.peakReleaseDbPerSecond,
+                              m_ballistics.rmsReleaseDbPerSecond, m_ballistics.rmsReleaseDbPerSecond};
+
+    // Still moving while the display differs from the newest snapshot: the
+    // render time trails every packet, so being behind it alone says nothing
+    const std::array<float, 4> newestLinear = levels(m_history[(m_next + kHistory - 1) % kHistory].snapshot);
+    bool moving = false;
+    for (std::size_t i = 0; i < m_displayDb.size(); ++i) {
+        const float targetDb = common::fastLinearToDb(targetLinear[i], m_ballistics.floorDb);
+        if (!m_hasFrame || targetDb >= m_displayDb[i]) {
+            m_displayDb[i] = targetDb;
+        } else {
+            m_displayDb[i] = std::max(targetDb, m_displayDb[i] - release[i] * dt);
+        }
+        const float newestDb = common::fastLinearToDb(newestLinear[i], m_ballistics.floorDb);
+        moving = moving || std::fabs(m_displayDb[i] - newestDb) > m_ballistics.settledDb;
+    }
+    m_lastFrame = frameTime;
+    m_hasFrame = true;
+    m_animating = moving;
+
+    common::MeterSnapshot out = target;
+    out.peak.left = common::fastDbToLinear(m_displayDb[0], m_ballistics.floorDb);
+    out.peak.right = common::fastDbToLinear(m_displayDb[1], m_ballistics.floorDb);
+    out.rms.left = common::fastDbToLinear(m_displayDb[2], m_ballistics.floorDb);
+    out.rms.right = common::fastDbToLinear(m_displayDb[3], m_ballistics.floorDb);
+    return out;
+}
+
+void MeterSmoother::reset() noexcept {
+    m_count = 0;
+    m_next = 0;
+    m_packetInterval = {};
+    m_displayDb = {};
+    m_hasFrame = false;
+    m_animating = false;
+}
+
+} // namespace openmeters::ui
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "../common/meter-values.h"
+#include <array>
+#include <chrono>
+#include <cstddef>
+
+namespace openmeters::ui {
+
+/**
+ * Display ballistics. Rises are shown at once; falls are limited to a
+ * fixed rate in dB per second, independent of the frame rate.
+ */
+struct MeterBallistics {
+    float peakReleaseDbPerSecond = 20.0f;
+    float rmsReleaseDbPerSecond = 30.0f;
+    float floorDb = -60.0f;                                     // Displayed silence
+    std::chrono::milliseconds maxInterpolationDelay{100};       // Upper bound on the render delay
+    float settledDb = 0.5f;                                     // Closer to the newest snapshot than this is not motion
+};
+
+/**
+ * Turns snapshots arriving at the capture packet rate into values for
+ * each display frame.
+ *
+ * The last few snapshots are kept with their times. Each frame is shown
+ * one packet interval in the past, interpolating between the two
+ * snapshots around that moment, so bars move on every frame at 144/240 Hz
+ * instead of jumping once per packet. Ballistics are then applied at the
+ * frame's own time step.
+ *
+ * Snapshot times come from the capture timestamps (timestampMs), mapped
+ * onto the steady clock through the earliest arrival seen in the
+ * history; without timestamps the arrival time is used directly.
+ *
+ * No allocation after construction. Thread safety: None; the window calls
+ * push() and advance() under its meter mutex.
+ */
+class MeterSmoother {
+public:
+    using Clock = std::chrono::steady_clock;
+    static constexpr std::size_t kHistory = 4;
+
+    explicit MeterSmoother(const MeterBallistics& ballistics = {}) : m_ballistics(ballistics) {}
+
+    /**
+     * Record a snapshot received at @p arrival.
+     */
+    void push(const common::MeterSnapshot& snapshot, Clock::time_point arrival) noexcept;
+
+    /**
+     * Values to display at @p frameTime (linear, 0..1).
+     */
+    common::MeterSnapshot advance(Clock::time_point frameTime) noexcept;
+
+    /**
+     * Whether the last advance() left motion to show: a displayed value
+     * still differs from the newest snapshot, because interpolation has
+     * not caught up with it or a bar is still falling. Differences up to
+     * MeterBallistics::settledDb are ignored, so steady input (including
+     * the small jitter of real audio) settles to false while packets keep
+     * arriving.
+     */
+    [[nodiscard]] bool animating() const noexcept { return m_animating; }
+
+    /**
+     * Forget history and displayed values.
+     */
+    void reset() noexcept;
+
+private:
+    struct Entry {
+        common::MeterSnapshot snapshot;
+        Clock::time_point time;
+    };
+
+    [[nodiscard]] common::MeterSnapshot interpolate(Clock::time_point renderTime) const noexcept;
+
+    MeterBallistics m_ballistics;
+    std::array<Entry, kHistory> m_history{};
+    std::array<Clock::time_point, kHistory> m_arrivals{};
+    std::size_t m_count = 0;
+    std::size_t m_next = 0;
+    Clock::duration m_packetInterval{};
+
+    std::array<float, 4> m_displayDb{};     // Peak L/R, RMS L/R as shown last frame
+    Clock::time_point m_lastFrame{};
+    bool m_hasFrame = false;
+    bool m_animating = false;
+};
+
+} // namespace openmeters::ui
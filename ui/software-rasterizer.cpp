@@ -0,0 +1,209 @@
+#include "software-rasterizer.h"
+#include "bitmap-font.h"
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define OPENMETERS_RASTER_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace openmeters::ui {
+
+namespace {
+
+/**
+ * First pixel whose center is at or right of @p edge.
+ */
+int pixelFrom(float edge) {
+    return static_cast<int>(std::ceil(edge - 0.5f));
+}
+
+/**
+ * Glyph scale for a font height: whole pixels, at least 1.
+ */
+int fontScale(float fontHeight) {
+    return std::max(1, static_cast<int>(fontHeight / static_cast<float>(BitmapFont::kCellHeight) + 0.5f));
+}
+
+/**
+ * x / 255, rounded, for x up to 255 * 255. Same arithmetic as the SIMD path.
+ */
+std::uint32_t divide255(std::uint32_t x) {
+    x += 128;
+    return (x + (x >> 8)) >> 8;
+}
+
+Rgba blendPixel(Rgba dst, Rgba color, std::uint32_t alpha) {
+    const std::uint32_t inverse = 255 - alpha;
+    const std::uint32_t source[4] = {color & 0xFF, (color >> 8) & 0xFF, (color >> 16) & 0xFF, 255};
+    Rgba out = 0;
+    for (int c = 0; c < 4; ++c) {
+        const std::uint32_t d = (dst >> (8 * c)) & 0xFF;
+        out |= divide255(source[c] * alpha + d * inverse) << (8 * c);
+    }
+    return out;
+}
+
+} // namespace
+
+void SoftwareRasterizer::resize(int width, int height) {
+    m_width = std::max(width, 0);
+    m_height = std::max(height, 0);
+    m_pixels.assign(static_cast<std::size_t>(m_width) * static_cast<std::size_t>(m_height), 0);
+}
+
+void SoftwareRasterizer::clear(Rgba color) {
+    std::fill(m_pixels.begin(), m_pixels.end(), color);
+}
+
+void SoftwareRasterizer::fillSpan(int y, int x0, int x1, Rgba color) {
+    const std::uint32_t alpha = color >> 24;
+    Rgba* row = m_pixels.data() + static_cast<std::size_t>(y) * static_cast<std::size_t>(m_width);
+    if (alpha == 255) {
+        std::fill(row + x0, row + x1, color); // Vectorized by the compiler
+        return;
+    }
+
+    int x = x0;
+#ifdef OPENMETERS_RASTER_SSE2
+    // out = (source * alpha + dst * (255 - alpha)) / 255 per channel, with
+    // the source alpha channel taken as 255 so coverage accumulates
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i source = _mm_unpacklo_epi8(_mm_set1_epi32(static_cast<int>(color | 0xFF000000u)), zero);
+    const __m128i weighted = _mm_mullo_epi16(source, _mm_set1_epi16(static_cast<short>(alpha)));
+    const __m128i inverse = _mm_set1_epi16(static_cast<short>(255 - alpha));
+    const __m128i bias = _mm_set1_epi16(128);
+    const auto blend = [&](__m128i d) {
+        __m128i sum = _mm_add_epi16(_mm_add_epi16(weighted, _mm_mullo_epi16(d, inverse)), bias);
+        return _mm_srli_epi16(_mm_add_epi16(sum, _mm_srli_epi16(sum, 8)), 8);
+    };
+    for (; x + 4 <= x1; x += 4) {
+        const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row + x));
+        const __m128i lo = blend(_mm_unpacklo_epi8(d, zero));
+        const __m128i hi = blend(_mm_unpackhi_epi8(d, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(row + x), _mm_packus_epi16(lo, hi));
+    }
+#endif
+    for (; x < x1; ++x) {
+        row[x] = blendPixel(row[x], color, alpha);
+    }
+}
+
+void SoftwareRasterizer::fillRect(const RectF& rect, Rgba color, float rounding) {
+    if ((color >> 24) == 0 || rect.empty()) {
+        return;
+    }
+    const int top = std::max(pixelFrom(rect.y0), 0);
+    const int bottom = std::min(pixelFrom(rect.y1), m_height);
+    const float radius = std::clamp(rounding, 0.0f, std::min(rect.width(), rect.height()) * 0.5f);
+
+    for (int y = top; y < bottom; ++y) {
+        // Corner rows are inset along the corner circle
+        float inset = 0.0f;
+        if (radius > 0.0f) {
+            const float center = static_cast<float>(y) + 0.5f;
+            const float into = std::max(rect.y0 + radius - center, center - (rect.y1 - radius));
+            if (into > 0.0f) {
+                inset = radius - std::sqrt(std::max(radius * radius - into * into, 0.0f));
+            }
+        }
+        const int left = std::max(pixelFrom(rect.x0 + inset), 0);
+        const int right = std::min(pixelFrom(rect.x1 - inset), m_width);
+        if (left < right) {
+            fillSpan(y, left, right, color);
+        }
+    }
+}
+
+void SoftwareRasterizer::drawLine(float x0, float y0, float x1, float y1, Rgba color, float thickness) {
+    const float half = std::max(thickness, 1.0f) * 0.5f;
+    if (x0 == x1 || y0 == y1) {
+        fillRect(RectF{std::min(x0, x1) - (x0 == x1 ? half : 0.0f), std::min(y0, y1) - (y0 == y1 ? half : 0.0f),
+                       std::max(x0, x1) + (x0 == x1 ? half : 0.0f), std::max(y0, y1) + (y0 == y1 ? half : 0.0f)},
+                 color);
+        return;
+    }
+
+    // Diagonal: one run per row (or column) along the steeper axis
+    const float dx = x1 - x0;
+    const float dy = y1 - y0;
+    if (std::fabs(dy) >= std::fabs(dx)) {
+        const int top = std::max(pixelFrom(std::min(y0, y1)), 0);
+        const int bottom = std::min(pixelFrom(std::max(y0, y1)), m_height);
+        const float width = half * std::sqrt(1.0f + (dx / dy) * (dx / dy));
+        for (int y = top; y < bottom; ++y) {
+            const float x = x0 + dx * ((static_cast<float>(y) + 0.5f - y0) / dy);
+            const int left = std::max(pixelFrom(x - width), 0);
+            const int right = std::min(pixelFrom(x + width), m_width);
+            if (left < right) {
+                fillSpan(y, left, right, color);
+            }
+        }
+    } else {
+        const int left = std::max(pixelFrom(std::min(x0, x1)), 0);
+        const int right = std::min(pixelFrom(std::max(x0, x1)), m_width);
+        const float height = half * std::sqrt(1.0f + (dy / dx) * (dy / dx));
+        for (int x = left; x < right; ++x) {
+            const float y = y0 + dy * ((static_cast<float>(x) + 0.5f - x0) / dx);
+            const int top = std::max(pixelFrom(y - height), 0);
+            const int bottom = std::min(pixelFrom(y + height), m_height);
+            for (int row = top; row < bottom; ++row) {
+                fillSpan(row, x, x + 1, color);
+            }
+        }
+    }
+}
+
+void SoftwareRasterizer::drawText(float x, float y, std::string_view text, Rgba color, float fontHeight) {
+    if ((color >> 24) == 0) {
+        return;
+    }
+    const int scale = fontScale(fontHeight);
+    const int originX = pixelFrom(x);
+    // Center the glyph rows in the line
+    const int originY = pixelFrom(y + (fontHeight - static_cast<float>(BitmapFont::kGlyphHeight * scale)) * 0.5f);
+
+    for (std::size_t i = 0; i < text.size(); ++i) {
+        const std::uint8_t* rows = BitmapFont::glyph(text[i]);
+        const int glyphX = originX + static_cast<int>(i) * BitmapFont::kAdvance * scale;
+        for (int row = 0; row < BitmapFont::kGlyphHeight; ++row) {
+            for (int column = 0; column < BitmapFont::kGlyphWidth; ++column) {
+                if (!(rows[row] & (0x10 >> column))) {
+                    continue;
+                }
+                const int px = glyphX + column * scale;
+                const int left = std::max(px, 0);
+                const int right = std::min(px + scale, m_width);
+                for (int py = originY + row * scale; py < originY + (row + 1) * scale; ++py) {
+                    if (py >= 0 && py < m_height && left < right) {
+                        fillSpan(py, left, right, color);
+                    }
+                }
+            }
+        }
+    }
+}
+
+void SoftwareRasterizer::render(const DisplayList& list, float originX, float originY) {
+    for (const DrawCommand& command : list.commands()) {
+        const RectF& b = command.bounds;
+        switch (command.kind) {
+            case DrawCommandKind::Rect:
+                fillRect(RectF{b.x0 + originX, b.y0 + originY, b.x1 + originX, b.y1 + originY}, command.color, command.size);
+                break;
+            case DrawCommandKind::Line:
+                drawLine(b.x0 + originX, b.y0 + originY, b.x1 + originX, b.y1 + originY, command.color, command.size);
+                break;
+            case DrawCommandKind::Text:
+                drawText(b.x0 + originX, b.y0 + originY, list.text(command), command.color, command.size);
+                break;
+        }
+    }
+}
+
+float SoftwareRasterizer::textWidth(std::string_view text, float fontHeight) noexcept {
+    return static_cast<float>(text.size() * BitmapFont::kAdvance * fontScale(fontHeight));
+}
+
+} // namespace openmeters::ui
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "display-list.h"
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace openmeters::ui {
+
+/**
+ * CPU renderer for display lists, for machines without a GPU or window
+ * (frame dumps, streaming overlays, visual regression tests).
+ *
+ * Draws into an RGBA8 buffer (bytes R, G, B, A per pixel, i.e. packed
+ * Rgba values on little-endian machines) with source-over blending:
+ * filled and rounded rects, lines, and text in the built-in 5x7 bitmap
+ * font scaled to whole pixels. Spans are filled four pixels at a time
+ * with SSE2 where available. Edges are not antialiased; a pixel is
+ * covered when its center is inside the shape.
+ *
+ * Thread safety: None.
+ */
+class SoftwareRasterizer {
+public:
+    SoftwareRasterizer() = default;
+    SoftwareRasterizer(int width, int height) { resize(width, height); }
+
+    /**
+     * Resize the buffer; contents become transparent black.
+     */
+    void resize(int width, int height);
+
+    [[nodiscard]] int width() const noexcept { return m_width; }
+    [[nodiscard]] int height() const noexcept { return m_height; }
+
+    void clear(Rgba color);
+
+    void fillRect(const RectF& rect, Rgba color, float rounding = 0.0f);
+    void drawLine(float x0, float y0, float x1, float y1, Rgba color, float thickness = 1.0f);
+    void drawText(float x, float y, std::string_view text, Rgba color, float fontHeight);
+
+    /**
+     * Draw every command of @p list, offset by (originX, originY).
+     */
+    void render(const DisplayList& list, float originX = 0.0f, float originY = 0.0f);
+
+    [[nodiscard]] Rgba pixel(int x, int y) const noexcept {
+        return m_pixels[static_cast<std::size_t>(y) * static_cast<std::size_t>(m_width) + static_cast<std::size_t>(x)];
+    }
+    [[nodiscard]] const Rgba* pixels() const noexcept { return m_pixels.data(); }
+    [[nodiscard]] std::size_t byteSize() const noexcept { return m_pixels.size() * sizeof(Rgba); }
+
+    /**
+     * Width of @p text as drawText() lays it out, for layout estimates.
+     */
+    [[nodiscard]] static float textWidth(std::string_view text, float fontHeight) noexcept;
+
+private:
+    /**
+     * Blend @p color over pixels [x0, x1) of row @p y (already clipped).
+     */
+    void fillSpan(int y, int x0, int x1, Rgba color);
+
+    std::vector<Rgba> m_pixels;
+    int m_width = 0;
+    int m_height = 0;
+};
+
+} // namespace openmeters::ui
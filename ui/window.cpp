@@ -1,12 +1,15 @@
 #include "window.h"
 #include "../common/logger.h"
 #include "../common/config.h"
+#include "imgui-display-list.h"
 #include <imgui.h>
-#include <imgui_internal.h> // Required for direct DrawList access
 #include <imgui_impl_win32.h>
 #include <imgui_impl_dx11.h>
 #include <mutex>
 #include <algorithm>
+#include <chrono>
+#include <string>
+#include <utility>
 
 #ifdef _WIN32
 #include <windows.h>
@@ -18,8 +21,17 @@ extern IMGUI_IMPL_API LRESULT ImGui_ImplWin32_WndProcHandler(HWND hWnd, UINT msg
 
 namespace openmeters::ui {
 
+namespace {
+
+// Smaller meter movements do not wake the UI thread; the smoother settles at the same threshold
+constexpr float kRedrawThresholdDb = MeterBallistics{}.settledDb;
+constexpr float kRedrawFloorDb = -60.0f;    // Below this the meters read as silent
+constexpr auto kClipHold = std::chrono::seconds(2);
+
+} // namespace
+
 Window::Window() {
-    m_config = common::ConfigManager::get();
+    m_config = *m_configView;
 }
 
 Window::~Window() {
@@ -29,8 +41,18 @@ Window::~Window() {
 bool Window::initialize(HINSTANCE hInstance, int nCmdShow) {
     m_hInstance = hInstance;
     
+    // The window may be constructed before configuration is loaded
+    m_configView.refresh();
+    m_config = *m_configView;
+    
     LOG_INFO("Initializing window...");
     
+    m_wakeEvent = CreateEventA(nullptr, FALSE, FALSE, nullptr);
+    if (!m_wakeEvent) {
+        LOG_ERROR("Failed to create redraw event");
+        return false;
+    }
+    
     if (!createWindow(hInstance, nCmdShow)) {
         LOG_ERROR("Failed to create window");
         return false;
@@ -45,6 +67,7 @@ bool Window::initialize(HINSTANCE hInstance, int nCmdShow) {
         LOG_ERROR("Failed to initialize ImGui");
         return false;
     }
+    applyConfig();
     
     LOG_INFO("Window initialized successfully");
     return true;
@@ -175,28 +198,51 @@ void Window::run() {
     MSG msg = {};
     
     while (!m_shouldClose) {
-        // Process Windows messages
+        // Process Windows messages; any of them may change what is on screen
         while (PeekMessageA(&msg, nullptr, 0, 0, PM_REMOVE)) {
             TranslateMessage(&msg);
             DispatchMessageA(&msg);
             if (msg.message == WM_QUIT) {
                 m_shouldClose = true;
             }
+            m_frames.request(FrameReasonInput);
         }
         
         if (m_shouldClose) {
             break;
         }
         
-        // Render frame
-        renderFrame();
+        // Pick up configuration published elsewhere (e.g. config.json edited
+        // on disk), unless the user is in the middle of editing settings
+        if (!m_showSettings && m_configView.refresh()) {
+            m_config = *m_configView;
+            applyConfig();
+            m_frames.request(FrameReasonForced);
+        }
+        
+        if (m_metersDirty.exchange(false)) {
+            m_frames.request(FrameReasonMeters);
+        }
         
-        // Sleep to limit CPU usage
-        Sleep(16); // ~60 FPS
+        const auto now = FrameScheduler::Clock::now();
+        const std::uint32_t reasons = m_frames.due(now);
+        if (reasons != FrameReasonNone) {
+            // Recorded first, so requests made while drawing carry over to the next frame
+            m_frames.frameRendered(now, reasons);
+            renderFrame(reasons);
+            continue;
+        }
+        
+        // Nothing to draw yet: block until input, a meter change or the next deadline
+        const auto wait = m_frames.waitTime(now);
+        const DWORD timeout = wait == FrameScheduler::Clock::duration::max()
+            ? INFINITE
+            : static_cast<DWORD>(std::chrono::ceil<std::chrono::milliseconds>(wait).count());
+        MsgWaitForMultipleObjectsEx(1, &m_wakeEvent, timeout, QS_ALLINPUT, MWMO_INPUTAVAILABLE);
     }
 }
 
-void Window::renderFrame() {
+void Window::renderFrame(std::uint32_t reasons) {
     // Start ImGui frame
     ImGui_ImplDX11_NewFrame();
     ImGui_ImplWin32_NewFrame();
@@ -213,6 +259,11 @@ void Window::renderFrame() {
     // Render ImGui
     ImGui::Render();
     
+    // A meter or animation frame whose display list came out the same has nothing new to show
+    if ((reasons & ~(FrameReasonMeters | FrameReasonAnimation)) == 0 && m_meterDiff.identical) {
+        return;
+    }
+    
     // Clear render target
     const float clearColor[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
     m_context->OMSetRenderTargets(1, &m_renderTargetView, nullptr);
@@ -221,18 +272,29 @@ void Window::renderFrame() {
     // Draw ImGui
     ImGui_ImplDX11_RenderDrawData(ImGui::GetDrawData());
     
-    // Present
-    m_swapChain->Present(1, 0); // VSync
+    // Present without waiting for vblank: the frame scheduler paces frames,
+    // and the windowed swap chain is composed by DWM so it does not tear
+    m_swapChain->Present(0, 0);
 }
 
 void Window::renderMeters() {
     // Get current meter values (thread-safe)
     common::MeterSnapshot snapshot;
+    bool animating = false;
     {
         std::lock_guard<std::mutex> lock(m_meterMutex);
-        snapshot = m_currentSnapshot;
+        snapshot = m_smoother.advance(FrameScheduler::Clock::now());
+        animating = m_smoother.animating();
+        m_drawnSnapshot = m_currentSnapshot;
+    }
+    
+    // Keep drawing while bars interpolate toward the newest snapshot or fall
+    if (animating) {
+        m_frames.request(FrameReasonAnimation);
     }
     
+    drainEvents();
+    
     // Create main window (no title bar, no background)
     ImGuiWindowFlags flags = 
         ImGuiWindowFlags_NoTitleBar |
@@ -267,21 +329,30 @@ void Window::renderMeters() {
         }
     }
     
-    // Draw peak meters
-    if (m_config.showPeakMeter) {
-        ImGui::Text("Peak");
-        drawMeter("##PeakL", snapshot.peak.left, ImVec2(-1, 20));
-        drawMeter("##PeakR", snapshot.peak.right, ImVec2(-1, 20));
-    }
-    
-    ImGui::Spacing();
-    
-    // Draw RMS meters
-    if (m_config.showRmsMeter) {
-        ImGui::Text("RMS");
-        drawMeter("##RmsL", snapshot.rms.left, ImVec2(-1, 20));
-        drawMeter("##RmsR", snapshot.rms.right, ImVec2(-1, 20));
-    }
+    // Meter panel, laid out as a display list and replayed into ImGui
+    MeterView view;
+    view.snapshot = snapshot;
+    view.showPeak = m_config.showPeakMeter;
+    view.showRms = m_config.showRmsMeter;
+    view.clipLit = FrameScheduler::Clock::now() < m_clipIndicatorUntil;
+    
+    const ImGuiStyle& style = ImGui::GetStyle();
+    m_meterStyle.fontHeight = ImGui::GetFontSize();
+    m_meterStyle.itemSpacing = style.ItemSpacing.y;
+    m_meterStyle.framePaddingX = style.FramePadding.x;
+    m_meterStyle.framePaddingY = style.FramePadding.y;
+    m_meterStyle.frameRounding = style.FrameRounding;
+    m_meterStyle.frameColor = ImGui::GetColorU32(ImGuiCol_FrameBg);
+    m_meterStyle.textColor = ImGui::GetColorU32(ImGuiCol_Text);
+    
+    std::swap(m_meterList, m_previousMeterList);
+    const float width = ImGui::GetContentRegionAvail().x;
+    const ImVec2 origin = ImGui::GetCursorScreenPos();
+    m_meterList.clear();
+    const float height = m_meterCache.append(m_meterList, view, m_meterStyle, 0.0f, 0.0f, width);
+    m_meterDiff = m_meterList.diff(m_previousMeterList);
+    submitToImGui(m_meterList, ImGui::GetWindowDrawList(), origin.x, origin.y);
+    ImGui::Dummy(ImVec2(width, std::max(height - m_meterStyle.itemSpacing, 0.0f)));
     
     // Settings button
     if (ImGui::Button("Settings")) {
@@ -291,6 +362,21 @@ void Window::renderMeters() {
     ImGui::End();
 }
 
+void Window::applyConfig() {
+    SetWindowPos(m_hWnd, m_config.alwaysOnTop ? HWND_TOPMOST : HWND_NOTOPMOST, 0, 0, 0, 0,
+                 SWP_NOMOVE | SWP_NOSIZE | SWP_NOACTIVATE);
+    
+    if (m_config.darkMode) {
+        ImGui::StyleColorsDark();
+    } else {
+        ImGui::StyleColorsLight();
+    }
+    setupStyle();
+    
+    const float rate = std::clamp(m_config.meterUpdateRate, 1.0f, 1000.0f);
+    m_frames.setMinFrameInterval(std::chrono::microseconds(static_cast<std::int64_t>(1'000'000.0f / rate)));
+}
+
 void Window::setupStyle() {
     ImGuiStyle& style = ImGui::GetStyle();
     style.WindowRounding = 8.0f;
@@ -315,58 +401,32 @@ void Window::setupStyle() {
     colors[ImGuiCol_ButtonActive] = ImVec4(0.45f, 0.45f, 0.45f, 1.00f);
 }
 
-void Window::drawMeter(const char* label, float value, const ImVec2& size) {
-    ImGuiWindow* window = ImGui::GetCurrentWindow();
-    if (window->SkipItems) return;
-    
-    ImGuiContext& g = *GImGui;
-    const ImGuiStyle& style = g.Style;
-    const ImGuiID id = window->GetID(label);
-    
-    ImVec2 pos = window->DC.CursorPos;
-    ImVec2 actualSize = ImGui::CalcItemSize(size, ImGui::GetWindowWidth(), style.FramePadding.y * 2.0f);
-    const ImRect bb(pos, ImVec2(pos.x + actualSize.x, pos.y + actualSize.y));
-    
-    ImGui::ItemSize(actualSize, style.FramePadding.y);
-    if (!ImGui::ItemAdd(bb, id)) return;
-    
-    // Background
-    window->DrawList->AddRectFilled(bb.Min, bb.Max, ImGui::GetColorU32(ImGuiCol_FrameBg), style.FrameRounding);
-    
-    // Segments
-    // 20 segments total
-    const int segments = 20;
-    const float segmentSpacing = 2.0f;
-    const float segmentWidth = (actualSize.x - (style.FramePadding.x * 2) - (segmentSpacing * (segments - 1))) / segments;
-    const float segmentHeight = actualSize.y - (style.FramePadding.y * 2);
-    
-    // Clamp value 0-1
-    float v = std::clamp(value, 0.0f, 1.0f);
+void Window::drainEvents() {
+    if (!m_events) {
+        return;
+    }
     
-    for (int i = 0; i < segments; i++) {
-        float segmentThreshold = (float)i / (float)segments;
-        
-        if (v > segmentThreshold) {
-            float x = bb.Min.x + style.FramePadding.x + (i * (segmentWidth + segmentSpacing));
-            float y = bb.Min.y + style.FramePadding.y;
+    const std::uint64_t droppedBefore = m_eventCursor.dropped;
+    common::MeterEvent events[32];
+    std::size_t count = 0;
+    while ((count = m_events->read(m_eventCursor, events, std::size(events))) > 0) {
+        for (std::size_t i = 0; i < count; ++i) {
+            const common::MeterEvent& event = events[i];
+            LOG_WARNING("Meter event: {} on channel {} at frame {} ({} frames, peak {:.3f})",
+                        common::meterEventTypeName(event.type), event.channel, event.startFrame,
+                        event.lengthFrames, event.magnitude);
             
-            ImU32 color;
-            if (segmentThreshold >= 0.9f) { // Over -6dB -> Red
-                color = IM_COL32(255, 50, 50, 255);
-            } else if (segmentThreshold >= 0.7f) { // Over -18dB -> Yellow
-                color = IM_COL32(255, 200, 50, 255);
-            } else { // Normal -> Green
-                color = IM_COL32(50, 255, 50, 255);
+            if (event.type != common::MeterEventType::Dropout) {
+                // Redraw when the hold runs out so the indicator goes dark
+                m_clipIndicatorUntil = FrameScheduler::Clock::now() + kClipHold;
+                m_frames.requestAt(m_clipIndicatorUntil);
             }
-            
-            window->DrawList->AddRectFilled(
-                ImVec2(x, y), 
-                ImVec2(x + segmentWidth, y + segmentHeight), 
-                color,
-                2.0f // Rounding
-            );
         }
     }
+    
+    if (m_eventCursor.dropped != droppedBefore) {
+        LOG_WARNING("Meter event journal overrun, {} events lost", m_eventCursor.dropped - droppedBefore);
+    }
 }
 
 void Window::renderSettings() {
@@ -378,12 +438,12 @@ void Window::renderSettings() {
     ImGui::Checkbox("Dark Mode", &m_config.darkMode);
     
     ImGui::SliderFloat("UI Scale", &m_config.uiScale, 0.5f, 2.0f);
-    ImGui::SliderFloat("Meter Update Rate", &m_config.meterUpdateRate, 30.0f, 120.0f);
+    ImGui::SliderFloat("Meter Update Rate", &m_config.meterUpdateRate, 30.0f, 240.0f);
     
     if (ImGui::Button("Save")) {
-        common::ConfigManager::get() = m_config;
-        common::ConfigManager::save();
-        LOG_INFO("Settings saved");
+        common::ConfigManager::publish(m_config);
+        common::ConfigManager::saveAsync();
+        LOG_INFO("Settings applied; saving in the background");
     }
     
     ImGui::SameLine();
@@ -427,12 +487,34 @@ void Window::shutdown() {
         m_hWnd = nullptr;
     }
     
+    if (m_wakeEvent) {
+        CloseHandle(m_wakeEvent);
+        m_wakeEvent = nullptr;
+    }
+    
     LOG_INFO("Window shutdown complete");
 }
 
 void Window::updateMeters(const common::MeterSnapshot& snapshot) {
     std::lock_guard<std::mutex> lock(m_meterMutex);
     m_currentSnapshot = snapshot;
+    m_smoother.push(snapshot, FrameScheduler::Clock::now());
+    
+    // Wake the UI thread only for changes a viewer could see
+    if (!m_metersDirty.load(std::memory_order_relaxed) &&
+        FrameScheduler::meterChanged(m_drawnSnapshot, snapshot, kRedrawThresholdDb, kRedrawFloorDb)) {
+        m_metersDirty.store(true);
+        if (m_wakeEvent) {
+            SetEvent(m_wakeEvent);
+        }
+    }
+}
+
+void Window::setEventSource(const common::MeterEventRing* events) {
+    m_events = events;
+    if (m_events) {
+        m_eventCursor = m_events->tail();
+    }
 }
 
 bool Window::shouldClose() const {
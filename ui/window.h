@@ -2,15 +2,19 @@
 
 #include "../common/config.h"
 #include "../common/meter-values.h"
+#include "../common/meter-events.h"
+#include "meter-render.h"
+#include "frame-scheduler.h"
+#include "meter-smoother.h"
 #include <windows.h>
 #include <d3d11.h>
+#include <atomic>
 #include <memory>
 #include <mutex>
 
 // Forward declarations
 struct ImGuiContext;
 struct ImGuiIO;
-struct ImVec2;
 
 namespace openmeters::ui {
 
@@ -40,7 +44,9 @@ public:
     
     /**
      * Main message loop.
-     * Runs until the window is closed.
+     * Runs until the window is closed. Frames are drawn only when meters
+     * move, input arrives or an indicator times out; otherwise the thread
+     * blocks.
      */
     void run();
     
@@ -57,6 +63,15 @@ public:
      */
     void updateMeters(const common::MeterSnapshot& snapshot);
     
+    /**
+     * Attach the engine's event journal.
+     * Events are drained on the UI thread, written to the session log and
+     * shown as a clip indicator.
+     * 
+     * @param events Event ring (must outlive the window), or nullptr to detach
+     */
+    void setEventSource(const common::MeterEventRing* events);
+    
     /**
      * Check if window should close.
      */
@@ -80,28 +95,35 @@ private:
     
     /**
      * Render frame.
+     * 
+     * @param reasons FrameReason bits the frame was scheduled for
      */
-    void renderFrame();
+    void renderFrame(std::uint32_t reasons);
     
     /**
      * Render meter UI.
      */
     void renderMeters();
     
+    /**
+     * Drain new meter events into the session log and clip indicator.
+     */
+    void drainEvents();
+    
     /**
      * Render settings window.
      */
     void renderSettings();
     
     /**
-     * Setup custom ImGui style.
+     * Apply window-level settings (topmost, theme, redraw rate) from m_config.
      */
-    void setupStyle();
+    void applyConfig();
     
     /**
-     * Draw a segmented LED-style meter.
+     * Setup custom ImGui style.
      */
-    void drawMeter(const char* label, float value, const ImVec2& size);
+    void setupStyle();
     
     /**
      * Window procedure.
@@ -128,8 +150,29 @@ private:
     // Meter data (protected by mutex)
     std::mutex m_meterMutex;
     common::MeterSnapshot m_currentSnapshot;
-    
-    // Configuration
+    common::MeterSnapshot m_drawnSnapshot;  // Last snapshot a frame showed
+    MeterSmoother m_smoother;               // Per-frame interpolation and ballistics
+    
+    // Redraw scheduling: the audio thread flags perceptible meter changes
+    // and wakes the UI thread through the event
+    FrameScheduler m_frames;
+    std::atomic<bool> m_metersDirty{false};
+    HANDLE m_wakeEvent = nullptr;
+    
+    // Meter events (read on UI thread only)
+    const common::MeterEventRing* m_events = nullptr;
+    common::MeterEventRing::Cursor m_eventCursor;
+    FrameScheduler::Clock::time_point m_clipIndicatorUntil{}; // Indicator stays lit until then
+    
+    // Meter panel: cached bar geometry, this frame's and last frame's display lists (UI thread only)
+    MeterRenderStyle m_meterStyle;
+    MeterPanelCache m_meterCache;
+    DisplayList m_meterList;
+    DisplayList m_previousMeterList;
+    DisplayListDiff m_meterDiff;
+    
+    // Configuration: published snapshot, and the copy the settings UI edits
+    common::ConfigView m_configView;
     common::AppConfig m_config;
 };
 